@@ -0,0 +1,136 @@
+/*
+ * analysis_config.c
+ *
+ *  Frame length, sample rate and window of the spectrum analysis,
+ *  switchable at run time.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "arm_math.h"
+#include "analysis_config.h"
+#include "dsp_config.h"
+#include "fft_tables.h"
+#include "cqt.h"
+
+static const uint32_t sampleRates[] = { DSP_SAMPLE_RATES };
+
+// DSP_NUM_SAMPLE_RATES sizes the per-rate buffers, so it has to match
+typedef char analysisRateCount[
+		(sizeof(sampleRates) / sizeof(sampleRates[0]) == DSP_NUM_SAMPLE_RATES) ? 1 : -1];
+
+static uint32_t nextId;
+
+// Settings queued for the ADC ISR. The ISR only reads pendingConfig
+// while configPending is set, and the main loop only writes it while it
+// is clear.
+static volatile analysisConfig pendingConfig;
+static volatile bool configPending;
+
+uint32_t analysisSampleRate(uint32_t rateIndex)
+{
+	return sampleRates[rateIndex];
+}
+
+// Fills in config for the requested settings. Returns false, leaving
+// config untouched, if they have no generated tables or do not fit the
+// buffers and stages sized in dsp_config.h.
+bool analysisConfigure(analysisConfig *config, uint32_t fftSize,
+		uint32_t sampleRate, analysisWindow window, uint32_t sysClock)
+{
+	const arm_rfft_fast_instance_f32 *plan = fftPlanRfft(fftSize);
+	const arm_rfft_fast_instance_f32 *acfPlan = fftPlanRfft(2 * fftSize);
+	const bandsWeights *bands = fftBands(fftSize, sampleRate);
+	const float32_t *windowTable = 0;
+	uint32_t rateIndex;
+
+	for (rateIndex = 0; rateIndex < DSP_NUM_SAMPLE_RATES; rateIndex++)
+	{
+		if (sampleRates[rateIndex] == sampleRate)
+		{
+			break;
+		}
+	}
+
+	if (!plan || !acfPlan || !bands || rateIndex == DSP_NUM_SAMPLE_RATES ||
+			fftSize > DSP_MAX_FFT_SIZE || fftSize < DSP_ARBFFT_LENGTH)
+	{
+		return false;
+	}
+
+	// The constant-Q cascade takes whole blocks
+	if (fftSize % CQT_BLOCK)
+	{
+		return false;
+	}
+
+	// The longest pitch lag searched, one past the DSP_PITCH_MIN_HZ
+	// period, and the neighbour it is interpolated with have to fit in
+	// the half frame where the autocorrelation is unbiased
+	if (sampleRate / DSP_PITCH_MIN_HZ + 2 > fftSize / 2)
+	{
+		return false;
+	}
+
+	if (window == ANALYSIS_WINDOW_HANN)
+	{
+		windowTable = fftWindowHann(fftSize);
+		if (!windowTable)
+		{
+			return false;
+		}
+	}
+
+	config->id = ++nextId;
+	config->fftSize = fftSize;
+	config->sampleRate = sampleRate;
+	config->window = window;
+	config->plan = plan;
+	config->acfPlan = acfPlan;
+	config->windowTable = windowTable;
+	config->bands = bands;
+	config->rateIndex = rateIndex;
+	config->timerLoad = sysClock / sampleRate;
+	config->reportFrames = DSP_REPORT_SECONDS * sampleRate / fftSize;
+
+	return true;
+}
+
+// Queues settings for the ADC ISR to start its next frame with. Returns
+// false if they are not valid (see analysisConfigure()) or the last
+// request has not been taken yet.
+bool analysisRequest(uint32_t fftSize, uint32_t sampleRate,
+		analysisWindow window, uint32_t sysClock)
+{
+	analysisConfig config;
+
+	if (configPending ||
+			!analysisConfigure(&config, fftSize, sampleRate, window, sysClock))
+	{
+		return false;
+	}
+
+	// Both are volatile, so the compiler keeps the copy ahead of the flag.
+	// The ISR runs on this core, which sees its own stores in program
+	// order, so no DMB is needed for it to find the copy complete.
+	pendingConfig = config;
+	configPending = true;
+
+	return true;
+}
+
+// Copies the queued settings into config and returns true, once per
+// request. Called from the ADC ISR, which the main loop cannot interrupt.
+bool analysisTakeRequest(analysisConfig *config)
+{
+	if (!configPending)
+	{
+		return false;
+	}
+
+	*config = pendingConfig;
+	configPending = false;
+
+	return true;
+}
@@ -0,0 +1,59 @@
+/*
+ * analysis_config.h
+ *
+ *  Frame length, sample rate and window of the spectrum analysis,
+ *  switchable at run time.
+ *
+ *  analysisConfigure() resolves a request against the generated plans
+ *  and band weights (see fft_tables.h) up front, so applying it at a
+ *  frame boundary is only a copy of this struct. The main loop queues
+ *  one with analysisRequest(), the ADC ISR takes it with
+ *  analysisTakeRequest() when it starts a new frame, and each captured
+ *  frame carries the configuration it was sampled with, so a frame is
+ *  never processed with a size or rate it was not captured at.
+ */
+
+#ifndef ANALYSIS_CONFIG_H_
+#define ANALYSIS_CONFIG_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "arm_math.h"
+#include "bands.h"
+
+typedef enum
+{
+	ANALYSIS_WINDOW_RECTANGULAR,
+	ANALYSIS_WINDOW_HANN
+} analysisWindow;
+
+typedef struct
+{
+	uint32_t id;                    // changes with every configuration
+	uint32_t fftSize;
+	uint32_t sampleRate;
+	analysisWindow window;
+
+	// Resolved from the above
+	const arm_rfft_fast_instance_f32 *plan;
+	const arm_rfft_fast_instance_f32 *acfPlan;  // twice fftSize, see autocorr.h
+	const float32_t *windowTable;   // 0 for rectangular
+	const bandsWeights *bands;
+	uint32_t rateIndex;             // into DSP_SAMPLE_RATES
+	uint32_t timerLoad;             // TIMER1 reload at the system clock
+	uint32_t reportFrames;          // frames per DSP_REPORT_SECONDS
+} analysisConfig;
+
+uint32_t analysisSampleRate(uint32_t rateIndex);
+bool analysisConfigure(analysisConfig *config, uint32_t fftSize,
+		uint32_t sampleRate, analysisWindow window, uint32_t sysClock);
+
+// Main loop side
+bool analysisRequest(uint32_t fftSize, uint32_t sampleRate,
+		analysisWindow window, uint32_t sysClock);
+
+// ADC ISR side
+bool analysisTakeRequest(analysisConfig *config);
+
+#endif /* ANALYSIS_CONFIG_H_ */
@@ -0,0 +1,209 @@
+/*
+ * arbfft.c
+ *
+ *  FFT of real frames of arbitrary length.
+ *
+ *  The mixed-radix path recurses once per factor of N, which keeps the
+ *  stack use small (a few words per level) and avoids a separate
+ *  reordering pass: the leaves read the input in digit-reversed order.
+ */
+
+#include <stdint.h>
+
+#include "arm_math.h"
+#include "arbfft.h"
+
+typedef struct
+{
+	float32_t re;
+	float32_t im;
+} arbfftComplex;
+
+// Generic butterfly inputs, shared since the FFT is not reentrant
+static arbfftComplex scratch[ARBFFT_MAX_RADIX];
+
+static void butterfly2(arbfftComplex *out, const arbfftComplex *twiddle,
+		uint32_t stride, uint32_t m)
+{
+	arbfftComplex *out2 = out + m;
+	arbfftComplex t;
+
+	do
+	{
+		t.re = out2->re * twiddle->re - out2->im * twiddle->im;
+		t.im = out2->re * twiddle->im + out2->im * twiddle->re;
+		twiddle += stride;
+
+		out2->re = out->re - t.re;
+		out2->im = out->im - t.im;
+		out->re += t.re;
+		out->im += t.im;
+
+		out++;
+		out2++;
+	} while (--m);
+}
+
+static void butterfly4(arbfftComplex *out, const arbfftComplex *twiddle,
+		uint32_t stride, uint32_t m)
+{
+	const arbfftComplex *tw1 = twiddle, *tw2 = twiddle, *tw3 = twiddle;
+	arbfftComplex s0, s1, s2, s3, s4, s5;
+	uint32_t k = m;
+
+	do
+	{
+		s0.re = out[m].re * tw1->re - out[m].im * tw1->im;
+		s0.im = out[m].re * tw1->im + out[m].im * tw1->re;
+		s1.re = out[2 * m].re * tw2->re - out[2 * m].im * tw2->im;
+		s1.im = out[2 * m].re * tw2->im + out[2 * m].im * tw2->re;
+		s2.re = out[3 * m].re * tw3->re - out[3 * m].im * tw3->im;
+		s2.im = out[3 * m].re * tw3->im + out[3 * m].im * tw3->re;
+
+		s5.re = out->re - s1.re;
+		s5.im = out->im - s1.im;
+		out->re += s1.re;
+		out->im += s1.im;
+
+		s3.re = s0.re + s2.re;
+		s3.im = s0.im + s2.im;
+		s4.re = s0.re - s2.re;
+		s4.im = s0.im - s2.im;
+
+		out[2 * m].re = out->re - s3.re;
+		out[2 * m].im = out->im - s3.im;
+		out->re += s3.re;
+		out->im += s3.im;
+
+		out[m].re = s5.re + s4.im;
+		out[m].im = s5.im - s4.re;
+		out[3 * m].re = s5.re - s4.im;
+		out[3 * m].im = s5.im + s4.re;
+
+		tw1 += stride;
+		tw2 += 2 * stride;
+		tw3 += 3 * stride;
+		out++;
+	} while (--k);
+}
+
+static void butterflyGeneric(arbfftComplex *out, const arbfftComplex *twiddle,
+		uint32_t stride, uint32_t m, uint32_t p, uint32_t length)
+{
+	uint32_t u, q, q1, k, index;
+	arbfftComplex t;
+
+	for (u = 0; u < m; u++)
+	{
+		for (q1 = 0, k = u; q1 < p; q1++, k += m)
+		{
+			scratch[q1] = out[k];
+		}
+
+		for (q1 = 0, k = u; q1 < p; q1++, k += m)
+		{
+			index = 0;
+			out[k] = scratch[0];
+			for (q = 1; q < p; q++)
+			{
+				index += stride * k;
+				if (index >= length)
+				{
+					index -= length;
+				}
+				t.re = scratch[q].re * twiddle[index].re - scratch[q].im * twiddle[index].im;
+				t.im = scratch[q].re * twiddle[index].im + scratch[q].im * twiddle[index].re;
+				out[k].re += t.re;
+				out[k].im += t.im;
+			}
+		}
+	}
+}
+
+// Transforms the length p * m sequence input[0], input[stride], ... into
+// out, given the remaining radices
+static void mixedRadix(const arbfftPlan *plan, arbfftComplex *out,
+		const float32_t *input, uint32_t stride, const uint16_t *factors)
+{
+	const arbfftComplex *twiddle = (const arbfftComplex *)plan->twiddle;
+	uint32_t p = factors[0];
+	uint32_t m, i;
+
+	// Product of the radices still to come
+	for (m = 1, i = 1; &factors[i] < &plan->factors[plan->numFactors]; i++)
+	{
+		m *= factors[i];
+	}
+
+	if (m == 1)
+	{
+		for (i = 0; i < p; i++)
+		{
+			out[i].re = input[i * stride];
+			out[i].im = 0.0f;
+		}
+	}
+	else
+	{
+		for (i = 0; i < p; i++)
+		{
+			mixedRadix(plan, &out[i * m], &input[i * stride], stride * p,
+					&factors[1]);
+		}
+	}
+
+	switch (p)
+	{
+	case 2:
+		butterfly2(out, twiddle, stride, m);
+		break;
+	case 4:
+		butterfly4(out, twiddle, stride, m);
+		break;
+	default:
+		butterflyGeneric(out, twiddle, stride, m, p, plan->length);
+		break;
+	}
+}
+
+static void bluestein(const arbfftPlan *plan, const float32_t *input,
+		float32_t *output, float32_t *work)
+{
+	uint32_t n;
+	uint32_t length = plan->length;
+	uint32_t cfftLength = plan->cfft->fftLen;
+	const float32_t *chirp = plan->chirp;
+
+	// Modulate by the chirp and zero-pad to M
+	for (n = 0; n < length; n++)
+	{
+		work[2 * n] = input[n] * chirp[2 * n];
+		work[2 * n + 1] = input[n] * chirp[2 * n + 1];
+	}
+	arm_fill_f32(0.0f, &work[2 * length], 2 * (cfftLength - length));
+
+	// Circular convolution with the conjugate chirp
+	arm_cfft_f32(plan->cfft, work, 0, 1);
+	arm_cmplx_mult_cmplx_f32(work, (float32_t *)plan->chirpSpectrum, work,
+			cfftLength);
+	arm_cfft_f32(plan->cfft, work, 1, 1);
+
+	// Demodulate
+	arm_cmplx_mult_cmplx_f32(work, (float32_t *)chirp, output, length);
+}
+
+// Writes the N complex bins of the real length N input to output (2N
+// floats). work must hold 2M floats for a Bluestein plan and is unused
+// otherwise.
+void arbfftRun(const arbfftPlan *plan, const float32_t *input, float32_t *output,
+		float32_t *work)
+{
+	if (plan->method == ARBFFT_BLUESTEIN)
+	{
+		bluestein(plan, input, output, work);
+	}
+	else
+	{
+		mixedRadix(plan, (arbfftComplex *)output, input, 1, plan->factors);
+	}
+}
@@ -0,0 +1,52 @@
+/*
+ * arbfft.h
+ *
+ *  FFT of real frames of arbitrary length.
+ *
+ *  Lengths whose prime factors are all at most ARBFFT_MAX_RADIX use a
+ *  mixed-radix decimation in time (radix 4 and 2 butterflies, a generic
+ *  one for odd factors). Any other length N uses Bluestein's chirp-z
+ *  transform on a power-of-two CMSIS CFFT of size M >= 2N - 1.
+ *
+ *  Plans, including their twiddles, chirp and chirp spectrum, are
+ *  generated into flash by tools/gen_fft_tables.py like the RFFT plans.
+ */
+
+#ifndef ARBFFT_H_
+#define ARBFFT_H_
+
+#include <stdint.h>
+
+#include "arm_math.h"
+
+#define ARBFFT_MAX_RADIX 13
+#define ARBFFT_MAX_FACTORS 12
+
+typedef enum
+{
+	ARBFFT_MIXED_RADIX,
+	ARBFFT_BLUESTEIN
+} arbfftMethod;
+
+typedef struct
+{
+	uint16_t length;                    // N
+	arbfftMethod method;
+
+	// Mixed radix: radices in the order they are applied, and
+	// exp(-2 pi i k / N) for k < N
+	uint16_t numFactors;
+	uint16_t factors[ARBFFT_MAX_FACTORS];
+	const float32_t *twiddle;
+
+	// Bluestein: exp(-i pi n^2 / N) for n < N, and the CFFT of its
+	// conjugate wrapped around a length M buffer
+	const float32_t *chirp;
+	const float32_t *chirpSpectrum;
+	const arm_cfft_instance_f32 *cfft;
+} arbfftPlan;
+
+void arbfftRun(const arbfftPlan *plan, const float32_t *input, float32_t *output,
+		float32_t *work);
+
+#endif /* ARBFFT_H_ */
@@ -95,7 +95,6 @@
 
 
 #include "arm_math.h"
-#include "arm_const_structs.h"
 
 #include <stdbool.h>
 
@@ -109,15 +108,34 @@
 #include "inc/hw_memmap.h"
 #include "inc/tm4c1294ncpdt.h"
 
-#define TEST_LENGTH_SAMPLES 256
-
-// Rate to sample analog input
-#define SAMPLING_RATE 44100
-//#define SAMPLING_RATE 16000
+#include "dsp_config.h"
+#include "dsp_arena.h"
+#include "report.h"
+#include "stack_monitor.h"
+#include "ramfunc.h"
+#include "dsp_profile.h"
+#include "fft_tables.h"
+#include "fastconv.h"
+#include "fir_design.h"
+#include "autocorr.h"
+#include "bands.h"
+#include "telemetry.h"
+#include "distortion.h"
+#include "analysis_config.h"
+#include "cqt.h"
 
 // Forward declaration of functions
 void configureADC();
-void runFFT();
+void allocateDSPMemory();
+void configureFilter();
+void configureAnalysis();
+void compareConstantQ();
+static void switchAnalysis(const analysisConfig *config);
+void serviceFrame();
+bool processFrame(float32_t *frame, const analysisConfig *config);
+void runFFT(float32_t *frame);
+void reportResults();
+static void filteredBlock(const float32_t *samples, uint32_t count, void *context);
 void TIMER1_Handler();
 void ADC0_SampleHandler();
 
@@ -128,13 +146,77 @@ void ADC0_SampleHandler();
 //extern float32_t testInput_f32_44khz_256[TEST_LENGTH_SAMPLES];
 
 uint32_t inputIndex;
-float32_t inputData[2];
-
-static float32_t rfftOutput[TEST_LENGTH_SAMPLES];
-static float32_t testOutput_44khz[TEST_LENGTH_SAMPLES/2];
 
-// Used to get ADC data from sequencer
-uint32_t adc_value[1];
+// Working buffers, carved out of the DSP arena by allocateDSPMemory()
+static float32_t *acquireBuffers[2];
+static float32_t *rfftOutput;
+static float32_t *testOutput_44khz;
+static float32_t *firHistory;
+static float32_t *firSpectra[DSP_NUM_SAMPLE_RATES];
+static float32_t *firWork;
+static float32_t *acf;
+static float32_t *acfWork;
+static float32_t *arbOutput;
+static float32_t *arbWork;
+static float32_t *bandEnergy;
+static float32_t *distortionPower;
+static float32_t *cqtWork;
+
+// Frame being filled by the ADC ISR, and the index of its buffer
+static float32_t *inputData;
+static uint32_t acquireIndex;
+
+// Completed frame handed from the ADC ISR to the main loop, and the
+// settings it was captured with. The ISR does not touch either again
+// until the main loop clears frameReady.
+static float32_t *volatile readyFrame;
+static const analysisConfig *volatile readyConfig;
+static volatile bool frameReady;
+
+// Analysis settings of each acquisition buffer. New ones come in
+// through analysisRequest(), see analysis_config.h.
+static analysisConfig acquireConfig[2];
+
+// Settings of the frame the main loop is working on
+static analysisConfig current;
+
+// Overlap-save filter run over the sampled stream
+static fastconvInstance fir;
+static float32_t filteredPower;
+static uint32_t filteredCount;
+
+// Latest autocorrelation period estimate
+static autocorrPeriod pitch;
+static bool pitchValid;
+
+// Frames processed since the last report
+static uint32_t frameCount;
+
+// RFFT instance for the current size, generated into flash by
+// tools/gen_fft_tables.py
+static arm_rfft_fast_instance_f32 *fft;
+
+// Arbitrary-length FFT plan and its latest peak bin, see arbfft.h
+static const arbfftPlan *arbFft;
+static uint32_t arbIndex;
+
+// Tone quality measurement and its latest results
+static distortionInstance distortion;
+static distortionResult quality;
+static bool qualityValid;
+
+// Constant-Q style spectrum from the decimation cascade, see cqt.h
+static cqtInstance cqt;
+
+// Set once the first frame has been processed
+static bool firstResult;
+
+// TIMER1 reload value, for the ISR latency measured from the trigger
+static uint32_t sampleTimerLoad;
+
+// Linker symbols bounding the stack, see tm4c1294ncpdt.cmd
+extern uint32_t __stack;
+extern uint32_t __STACK_TOP;
 
 /* ------------------------------------------------------------------
  * Global variable for system clock
@@ -145,7 +227,7 @@ uint32_t g_ui32SysClock;
  * Global variables for FFT Bin Example
  * ------------------------------------------------------------------- */
 //uint32_t fftSize = 1024;
-uint32_t fftSize = TEST_LENGTH_SAMPLES;
+uint32_t fftSize = TEST_LENGTH_SAMPLES;     // of the current frame
 
 uint32_t ifftFlag = 0;
 uint32_t doBitReverse = 1;
@@ -159,6 +241,15 @@ uint32_t refIndex = 213, testIndex = 0;
 
 int32_t main(void)
 {
+	// The cycle counter was started by ResetISR()
+	uint32_t bootCycles = PROFILE_NOW();
+
+	// Copy the hot code and tables into SRAM before anything calls them,
+	// profileRecord() included
+	ramfuncInit();
+
+	// Reset to main(), leaving out the copy
+	profileRecord(PROFILE_BOOT_TO_MAIN, PROFILE_NOW() - bootCycles);
 
 	g_ui32SysClock = ROM_SysCtlClockFreqSet(SYSCTL_USE_PLL | SYSCTL_XTAL_25MHZ | SYSCTL_OSC_MAIN | SYSCTL_CFG_VCO_480, 120000000);
 
@@ -168,10 +259,224 @@ int32_t main(void)
 	MAP_FPULazyStackingEnable();
 	MAP_FPUEnable();
 
+	stackMonitorInit(&__stack, &__STACK_TOP);
+
+	reportInit(g_ui32SysClock);
+	ramfuncReport();
+
+#if DSP_CQT_REFERENCE_SIZE
+	compareConstantQ();
+#endif
+
+	allocateDSPMemory();
+	dspArenaReport();
+
+	configureFilter();
+	configureAnalysis();
+
 	// Set up ADC sampling and interrupt
 	configureADC();
 
-	while(1);                             /* main function does not return */
+	while(1)                              /* main function does not return */
+	{
+		serviceFrame();
+		stackCheckGuard();
+	}
+}
+
+// One pass of the main loop over a captured frame. Only the DSP stages
+// are timed against the frame period; the report blocks on the UART for
+// far longer than a frame, so it runs after the buffer is handed back
+// and any frames it holds up show as drops rather than deadline misses.
+void serviceFrame()
+{
+	uint32_t frameStart;
+	bool reportDue;
+
+	if (!frameReady)
+	{
+		return;
+	}
+
+	frameStart = PROFILE_NOW();
+	reportDue = processFrame(readyFrame, readyConfig);
+	telemetryFrameCompleted(PROFILE_NOW() - frameStart,
+			current.fftSize * current.timerLoad);
+
+	// Hand the buffer back to the ADC ISR
+	frameReady = false;
+
+	if (reportDue)
+	{
+		reportResults();
+	}
+}
+
+void allocateDSPMemory()
+{
+	uint32_t rate;
+
+	dspArenaReset();
+
+	acquireBuffers[0] = dspArenaAlloc("frame 0", DSP_ARENA_FRAME_BYTES);
+	acquireBuffers[1] = dspArenaAlloc("frame 1", DSP_ARENA_FRAME_BYTES);
+	acquireIndex = 0;
+	inputData = acquireBuffers[0];
+
+	rfftOutput = dspArenaAlloc("rfft", DSP_ARENA_SPECTRUM_BYTES);
+
+	// The magnitude of bin k only depends on rfftOutput[2k] and
+	// rfftOutput[2k+1], so it can be written in place
+	testOutput_44khz = dspArenaReuse("magnitude", rfftOutput,
+			(DSP_MAX_FFT_SIZE / 2) * sizeof(float32_t));
+
+	firHistory = dspArenaAlloc("fir history", DSP_ARENA_FIR_HISTORY_BYTES);
+	firSpectra[0] = dspArenaAlloc("fir spectra", DSP_ARENA_FIR_SPECTRUM_BYTES);
+	for (rate = 1; rate < DSP_NUM_SAMPLE_RATES; rate++)
+	{
+		firSpectra[rate] = firSpectra[rate - 1] +
+				DSP_ARENA_FIR_SPECTRUM_BYTES / DSP_NUM_SAMPLE_RATES / sizeof(float32_t);
+	}
+	firWork = dspArenaAlloc("fir work", DSP_ARENA_FIR_WORK_BYTES);
+
+	// The filter is done with its scratch by the time the spectrum path
+	// runs, so the autocorrelation pads the frame and transforms it there
+	acf = dspArenaReuse("acf", firWork,
+			2 * DSP_MAX_FFT_SIZE * sizeof(float32_t));
+	acfWork = dspArenaReuse("acf work", firWork + 2 * DSP_MAX_FFT_SIZE,
+			2 * DSP_MAX_FFT_SIZE * sizeof(float32_t));
+
+#if DSP_ARBFFT_LENGTH
+	arbOutput = dspArenaAlloc("arb fft", DSP_ARENA_ARBFFT_BYTES);
+	arbWork = dspArenaReuse("arb work", firWork,
+			FFT_ARB_WORK_FLOATS * sizeof(float32_t));
+	arbFft = fftPlanArb(DSP_ARBFFT_LENGTH);
+#endif
+
+	bandEnergy = dspArenaAlloc("bands", DSP_ARENA_BANDS_BYTES);
+
+	// Also done with the FIR scratch by the time it runs
+	distortionPower = dspArenaReuse("distortion power", firWork,
+			(DSP_MAX_FFT_SIZE / 2 + 1) * sizeof(float32_t));
+
+	cqtWork = dspArenaAlloc("cqt", DSP_ARENA_CQT_BYTES);
+}
+
+void configureFilter()
+{
+	arm_rfft_fast_instance_f32 *firPlan =
+			(arm_rfft_fast_instance_f32 *)fftPlanRfft(DSP_FIR_FFT_SIZE);
+	float32_t *taps = &firWork[DSP_FIR_FFT_SIZE];
+	float32_t nyquist;
+	uint32_t rate;
+
+	// Design the taps into the upper half of the FIR scratch and use the
+	// lower half as RFFT input for their spectrum. Each sample rate gets
+	// its own spectrum so switching rate needs no redesign; band edges
+	// above Nyquist are clipped to it, which leaves no taps at all for a
+	// band the rate cannot represent.
+	for (rate = 0; rate < DSP_NUM_SAMPLE_RATES; rate++)
+	{
+		nyquist = analysisSampleRate(rate) / 2.0f;
+		firDesignBandPass(taps, DSP_FIR_TAPS,
+				(DSP_FIR_LOW_HZ < nyquist) ? DSP_FIR_LOW_HZ : nyquist,
+				(DSP_FIR_HIGH_HZ < nyquist) ? DSP_FIR_HIGH_HZ : nyquist,
+				analysisSampleRate(rate));
+		fastconvFilterSpectrum(firPlan, taps, DSP_FIR_TAPS, firSpectra[rate],
+				firWork);
+	}
+
+	fastconvInit(&fir, firPlan, firSpectra[0], DSP_FIR_TAPS, firHistory,
+			firWork, filteredBlock, 0);
+}
+
+void configureAnalysis()
+{
+	if (!analysisConfigure(&acquireConfig[0], TEST_LENGTH_SAMPLES,
+			SAMPLING_RATE, DSP_WINDOW, g_ui32SysClock))
+	{
+		// The start-up settings are not among the generated ones. Enter
+		// an infinite loop, preserving the system state for examination
+		// by a debugger.
+		while(1)
+		{
+		}
+	}
+
+	// The cascade keeps one RFFT size whatever the frame size
+	cqtInit(&cqt, (arm_rfft_fast_instance_f32 *)fftPlanRfft(DSP_CQT_FFT_SIZE),
+			fftWindowHann(DSP_CQT_FFT_SIZE), DSP_CQT_OCTAVES,
+			DSP_CQT_BINS_PER_OCTAVE, DSP_CQT_DECIMATOR_TAPS, cqtWork);
+
+	acquireConfig[1] = acquireConfig[0];
+	switchAnalysis(&acquireConfig[0]);
+}
+
+#if DSP_CQT_REFERENCE_SIZE
+// Times, once, the single RFFT that gives the lowest constant-Q octave
+// the same resolution: window, transform and bin powers of
+// DSP_CQT_REFERENCE_SIZE samples, in the "cqt reference" profile stage.
+// For the same update rate of that octave it has to run every
+// DSP_CQT_REFERENCE_SIZE / 2 samples, against the "cqt" stage every
+// frame. Its buffers borrow the arena before allocateDSPMemory().
+void compareConstantQ()
+{
+	arm_rfft_fast_instance_f32 *plan =
+			(arm_rfft_fast_instance_f32 *)fftPlanRfft(DSP_CQT_REFERENCE_SIZE);
+	float32_t *input, *output;
+	uint32_t stageStart;
+
+	dspArenaReset();
+	input = dspArenaAlloc("cqt reference", DSP_ARENA_CQT_REFERENCE_BYTES / 2);
+	output = dspArenaAlloc("cqt reference out", DSP_ARENA_CQT_REFERENCE_BYTES / 2);
+
+	// The RFFT does the same work whatever the samples
+	arm_fill_f32(1.0f, input, DSP_CQT_REFERENCE_SIZE);
+
+	stageStart = PROFILE_NOW();
+	arm_mult_f32(input, (float32_t *)fftWindowHann(DSP_CQT_REFERENCE_SIZE),
+			input, DSP_CQT_REFERENCE_SIZE);
+	arm_rfft_fast_f32(plan, input, output, 0);
+	arm_cmplx_mag_squared_f32(output, output, DSP_CQT_REFERENCE_SIZE / 2);
+	profileRecord(PROFILE_CQT_REFERENCE, stageStart);
+
+	// SRAM of each, and the flash tables only the reference needs:
+	// twiddles, split twiddles and window
+	reportString("Constant-Q: cascade bytes ");
+	reportUint(DSP_ARENA_CQT_BYTES + sizeof(cqt));
+	reportString(", single rfft bytes ");
+	reportUint(DSP_ARENA_CQT_REFERENCE_BYTES);
+	reportString(" + tables ");
+	reportUint(3 * DSP_CQT_REFERENCE_SIZE * sizeof(float32_t));
+	reportString("\n");
+}
+#endif
+
+// Points the main loop stages at the settings of the frame about to be
+// processed. Everything was resolved in analysisConfigure(), so this is
+// a handful of pointer and field updates.
+static void switchAnalysis(const analysisConfig *config)
+{
+	if (config->rateIndex != current.rateIndex || current.id == 0)
+	{
+		fastconvSetFilter(&fir, firSpectra[config->rateIndex]);
+		cqtReset(&cqt);
+	}
+
+	current = *config;
+	fftSize = current.fftSize;
+
+	// The plans are const; CMSIS only takes a non-const pointer
+	fft = (arm_rfft_fast_instance_f32 *)current.plan;
+
+	// Measurements restart at the new resolution
+	distortionInit(&distortion, current.fftSize, current.sampleRate,
+			current.windowTable ? &distortionWindowHannApplied :
+					&DSP_DISTORTION_WINDOW,
+			DSP_DISTORTION_HARMONICS, distortionPower);
+	pitchValid = false;
+	qualityValid = false;
+	frameCount = 0;
 }
 
 void configureADC()
@@ -196,7 +501,8 @@ void configureADC()
 	MAP_TimerConfigure(TIMER1_BASE, TIMER_CFG_PERIODIC);
 
 	// Load timer for periodic sampling of ADC
-	MAP_TimerLoadSet(TIMER1_BASE, TIMER_A, g_ui32SysClock/SAMPLING_RATE);
+	sampleTimerLoad = acquireConfig[acquireIndex].timerLoad;
+	MAP_TimerLoadSet(TIMER1_BASE, TIMER_A, sampleTimerLoad);
 
 	// Enable ADC triggering
 	MAP_TimerControlTrigger(TIMER1_BASE, TIMER_A, true);
@@ -242,59 +548,249 @@ void configureADC()
 
 void ADC0_SampleHandler()
 {
+	// Used to get ADC data from sequencer
+	uint32_t adc_value[1];
+	uint32_t startCycles = PROFILE_NOW();
+	uint32_t latency;
+	bool overflow, underflow;
+
+	stackIsrEnter(STACK_ISR_ADC0);
+
+	// The timer counts down from its reload value after triggering the
+	// conversion, so what it has counted is the time since the trigger
+	latency = sampleTimerLoad - MAP_TimerValueGet(TIMER1_BASE, TIMER_A);
+
 	MAP_ADCIntClear(ADC0_BASE, 3);
 
 	MAP_ADCSequenceDataGet(ADC0_BASE, 3, adc_value);
 
+	// A conversion completed before the last one was read overflows
+	// the one-deep sequencer 3 FIFO, and that sample is lost
+	overflow = MAP_ADCSequenceOverflow(ADC0_BASE, 3) != 0;
+	underflow = MAP_ADCSequenceUnderflow(ADC0_BASE, 3) != 0;
+	if (overflow)
+	{
+		MAP_ADCSequenceOverflowClear(ADC0_BASE, 3);
+	}
+	if (underflow)
+	{
+		MAP_ADCSequenceUnderflowClear(ADC0_BASE, 3);
+	}
+	telemetrySample(latency, overflow, underflow);
+
 	inputData[inputIndex++] = (float) adc_value[0];
 
-	if (inputIndex > TEST_LENGTH_SAMPLES - 1)
+	if (inputIndex >= acquireConfig[acquireIndex].fftSize)
 	{
 		inputIndex = 0;
 
-		// 'Permanently disable interrupt'
-		// We will only run the fft once for now
-		MAP_ADCIntDisable(ADC0_BASE, 3);
-		MAP_TimerDisable(TIMER1_BASE, TIMER_A);
+		// Hand the frame to the main loop and continue in the other
+		// buffer. If the main loop still owns the other buffer, the
+		// frame is dropped and this buffer is filled again.
+		if (!frameReady)
+		{
+			readyFrame = inputData;
+			readyConfig = &acquireConfig[acquireIndex];
+			frameReady = true;
+
+			acquireIndex ^= 1;
+			inputData = acquireBuffers[acquireIndex];
+			acquireConfig[acquireIndex] = acquireConfig[acquireIndex ^ 1];
+		}
+		else
+		{
+			telemetryFrameDropped();
+		}
+
+		// Start the next frame with any requested settings. Reloading
+		// the timer restarts its count, so the first sample of the frame
+		// is already a full period of the new rate away.
+		if (analysisTakeRequest(&acquireConfig[acquireIndex]))
+		{
+			sampleTimerLoad = acquireConfig[acquireIndex].timerLoad;
+			MAP_TimerLoadSet(TIMER1_BASE, TIMER_A, sampleTimerLoad);
+		}
+	}
 
-		runFFT();
+	profileRecord(PROFILE_ADC_ISR, startCycles);
 
-		// Delay for 1 second
-		MAP_SysCtlDelay(g_ui32SysClock / 3);
+	stackIsrExit(STACK_ISR_ADC0);
+}
 
-		//Re-enable timer and ADC interrupts to run another FFT
-		MAP_ADCIntEnable(ADC0_BASE, 3);
-		MAP_TimerEnable(TIMER1_BASE, TIMER_A);
+// Returns true once every DSP_REPORT_SECONDS of frames, when the
+// results are due to be reported
+bool processFrame(float32_t *frame, const analysisConfig *config)
+{
+	uint32_t stageStart;
 
+	// First frame captured with new settings
+	if (config->id != current.id)
+	{
+		switchAnalysis(config);
 	}
 
+	// The filter has to see the frame before the RFFT clobbers it
+	stageStart = PROFILE_NOW();
+	fastconvProcess(&fir, frame, current.fftSize);
+	profileRecord(PROFILE_FIR, stageStart);
+
+	// So does the constant-Q cascade
+	stageStart = PROFILE_NOW();
+	cqtProcess(&cqt, frame, current.fftSize);
+	profileRecord(PROFILE_CQT, stageStart);
+
+	runFFT(frame);
+
+	if (++frameCount >= current.reportFrames)
+	{
+		frameCount = 0;
+		return true;
+	}
+	return false;
 }
 
-void runFFT()
+// Consumer for the overlap-save filter output
+static void filteredBlock(const float32_t *samples, uint32_t count, void *context)
 {
-	int32_t startTime, stopTime, totalTime;
-	float32_t maxValue;
+	float32_t power;
 
-	// Setup timer
-	// This is just used for timing during test!!
-//	ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER0);
-//	ROM_TimerConfigure(TIMER0_BASE, TIMER_CFG_PERIODIC);
-//	ROM_TimerLoadSet(TIMER0_BASE, TIMER_A, g_ui32SysClock); // 1 second
+	arm_power_f32((float32_t *)samples, count, &power);
+	filteredPower += power;
+	filteredCount += count;
+}
 
-	// Create a RFFT instance
-	arm_rfft_fast_instance_f32 fft;
-	arm_rfft_fast_init_f32(&fft,fftSize);
+void reportResults()
+{
+	float32_t rms = 0.0f;
+	uint32_t band;
 
-	// Run FFT
-//	ROM_TimerEnable(TIMER0_BASE, TIMER_A);
-//	startTime = TIMER0_TAR_R;
+	if (filteredCount)
+	{
+		arm_sqrt_f32(filteredPower / filteredCount, &rms);
+	}
+	filteredPower = 0.0f;
+	filteredCount = 0;
+
+	reportString("Peak Hz ");
+	reportUint(testIndex * current.sampleRate / current.fftSize);
+	reportString(", filtered RMS ");
+	reportUint((uint32_t)rms);
+	reportString(", period Hz ");
+	reportUint(pitchValid ? (uint32_t)(current.sampleRate / pitch.lag) : 0);
+#if DSP_ARBFFT_LENGTH
+	reportString(", exact peak Hz ");
+	reportUint(arbIndex * current.sampleRate / DSP_ARBFFT_LENGTH);
+#endif
+	reportString("\n");
+
+	// One level per band instead of every bin
+	reportString("Bands dB");
+	for (band = 0; band < current.bands->numBands; band++)
+	{
+		reportString(" ");
+		reportInt(bandEnergy[band] > 0.0f ?
+				(int32_t)(10.0f * log10f(bandEnergy[band])) : 0);
+	}
+	reportString("\n");
+
+	// Constant-Q levels from the lowest bin, DSP_CQT_BINS_PER_OCTAVE per
+	// octave starting at cqtBinHz(0)
+	reportString("CQ dB from Hz ");
+	reportUint((uint32_t)cqtBinHz(&cqt, current.sampleRate, 0));
+	reportString(":");
+	for (band = 0; band < DSP_CQT_OCTAVES * DSP_CQT_BINS_PER_OCTAVE; band++)
+	{
+		reportString(" ");
+		reportInt(cqt.spectrum[band] > 0.0f ?
+				(int32_t)(10.0f * log10f(cqt.spectrum[band])) : 0);
+	}
+	reportString("\n");
+
+#if DSP_DISTORTION_AVERAGE
+	qualityValid = distortionResults(&distortion, &quality);
+#endif
+	if (qualityValid)
+	{
+		reportString("Tone Hz ");
+		reportUint((uint32_t)quality.fundamentalHz);
+		reportString(", THD dB ");
+		reportLevel(quality.thd);
+		reportString(", SNR dB ");
+		reportLevel(quality.snr);
+		reportString(", SINAD dB ");
+		reportLevel(quality.sinad);
+		reportString(", ENOB x100 ");
+		reportLevel(100.0f * quality.enob);
+		reportString("\n");
+	}
+
+	telemetryReport();
+	stackReport();
+	profileReport();
+}
+
+void runFFT(float32_t *frame)
+{
+	uint32_t frameStart, stageStart;
+	float32_t maxValue;
+
+	// Per-stage cycle counts, see dsp_profile.h
+	frameStart = PROFILE_NOW();
+
+#if DSP_ARBFFT_LENGTH
+	/* Bins at exact multiples of the rate / DSP_ARBFFT_LENGTH from
+	  the start of the frame, before the RFFT clobbers it. Compare its
+	  cycles with the rfft stage at the next power of two. */
+	stageStart = PROFILE_NOW();
+	arbfftRun(arbFft, frame, arbOutput, arbWork);
+	profileRecord(PROFILE_ARBFFT, stageStart);
+
+	arm_cmplx_mag_f32(arbOutput, arbOutput, DSP_ARBFFT_LENGTH / 2 + 1);
+	arm_max_f32(&arbOutput[1], DSP_ARBFFT_LENGTH / 2, &maxValue, &arbIndex);
+	arbIndex++;
+#endif
+
+	/* Autocorrelation of the unwindowed frame for the period estimate.
+	  It pads a copy to twice the frame, so the lags are not aliased.
+	  The search runs one lag past the DSP_PITCH_MIN_HZ period, which
+	  is not a whole number of samples, so that its peak is inside */
+	stageStart = PROFILE_NOW();
+	autocorrCompute((arm_rfft_fast_instance_f32 *)current.acfPlan, frame,
+			acfWork, acf);
+	pitchValid = autocorrFindPeriod(acf, current.sampleRate / DSP_PITCH_MAX_HZ,
+			current.sampleRate / DSP_PITCH_MIN_HZ + 1, DSP_PITCH_MIN_CLARITY, &pitch);
+	profileRecord(PROFILE_AUTOCORR, stageStart);
+
+	if (current.windowTable)
+	{
+		arm_mult_f32(frame, (float32_t *)current.windowTable, frame,
+				current.fftSize);
+	}
 
 	/* Process the real data through the RFFT module */
-	arm_rfft_fast_f32(&fft, inputData, rfftOutput, ifftFlag);
+	stageStart = PROFILE_NOW();
+	arm_rfft_fast_f32(fft, frame, rfftOutput, ifftFlag);
+	profileRecord(PROFILE_RFFT, stageStart);
+
+	/* Band energies from the spectrum, before the magnitude stage
+	  overwrites it */
+	stageStart = PROFILE_NOW();
+	bandsApply(current.bands, rfftOutput, bandEnergy);
+	profileRecord(PROFILE_BANDS, stageStart);
+
+	/* Tone quality from the same spectrum, windowed on the fly */
+	stageStart = PROFILE_NOW();
+	distortionMeasure(&distortion, rfftOutput);
+#if !DSP_DISTORTION_AVERAGE
+	qualityValid = distortionResults(&distortion, &quality);
+#endif
+	profileRecord(PROFILE_DISTORTION, stageStart);
 
 	/* Process the data through the Complex Magnitude Module for
 	  calculating the magnitude at each bin */
+	stageStart = PROFILE_NOW();
 	arm_cmplx_mag_f32(rfftOutput, testOutput_44khz, fftSize / 2);
+	profileRecord(PROFILE_MAGNITUDE, stageStart);
 
 	// The 0 index of FFT output is the DC component of
 	// the input signal. We don't want to consider this when
@@ -302,7 +798,17 @@ void runFFT()
 	testOutput_44khz[0] = 0;
 
 	/* Calculates maxValue and returns corresponding BIN value */
-	arm_max_f32(testOutput_44khz, TEST_LENGTH_SAMPLES / 2, &maxValue, &testIndex);
+	stageStart = PROFILE_NOW();
+	arm_max_f32(testOutput_44khz, fftSize / 2, &maxValue, &testIndex);
+	profileRecord(PROFILE_PEAK, stageStart);
+
+	profileRecord(PROFILE_FRAME, frameStart);
+
+	if (!firstResult)
+	{
+		profileRecord(PROFILE_BOOT_TO_RESULT, 0);
+		firstResult = true;
+	}
 
 //	stopTime = TIMER0_TAR_R;
 
@@ -310,7 +816,7 @@ void runFFT()
 
 //	int totalTimeUs = totalTime / 120;
 	//int peakFrequency = testIndex * 22050 / 128;
-	int peakFrequency = testIndex * SAMPLING_RATE / TEST_LENGTH_SAMPLES;
+	int peakFrequency = testIndex * current.sampleRate / fftSize;
 
 	MAP_SysCtlDelay(1);
 
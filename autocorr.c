@@ -0,0 +1,126 @@
+/*
+ * autocorr.c
+ *
+ *  Fundamental period estimate from the autocorrelation of a frame.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "arm_math.h"
+#include "autocorr.h"
+
+// plan is the RFFT of twice the frame length N. frame is left intact;
+// work (2N floats) is clobbered, and acf (2N floats) receives the
+// autocorrelation of the frame minus its mean, unbiased for lags up to
+// N / 2.
+void autocorrCompute(arm_rfft_fast_instance_f32 *plan, const float32_t *frame,
+		float32_t *work, float32_t *acf)
+{
+	uint32_t k;
+	uint32_t paddedSize = plan->fftLenRFFT;
+	uint32_t frameSize = paddedSize / 2;
+	float32_t mean = 0.0f;
+
+	// Removing the mean drops the ADC offset, which would otherwise
+	// dominate every lag
+	for (k = 0; k < frameSize; k++)
+	{
+		mean += frame[k];
+	}
+	mean /= frameSize;
+
+	for (k = 0; k < frameSize; k++)
+	{
+		acf[k] = frame[k] - mean;
+	}
+	arm_fill_f32(0.0f, &acf[frameSize], frameSize);
+
+	arm_rfft_fast_f32(plan, acf, work, 0);
+
+	// Power spectrum in place. The DC and Nyquist bins are real.
+	work[0] = work[0] * work[0];
+	work[1] = work[1] * work[1];
+	for (k = 1; k < paddedSize / 2; k++)
+	{
+		work[2 * k] = work[2 * k] * work[2 * k] +
+				work[2 * k + 1] * work[2 * k + 1];
+		work[2 * k + 1] = 0.0f;
+	}
+
+	arm_rfft_fast_f32(plan, work, acf, 1);
+
+	for (k = 1; k <= frameSize / 2; k++)
+	{
+		acf[k] *= (float32_t)frameSize / (float32_t)(frameSize - k);
+	}
+}
+
+// Searches lags minLag .. maxLag inclusive; acf must hold maxLag + 2
+// values, as the peak is interpolated with its neighbours
+bool autocorrFindPeriod(const float32_t *acf, uint32_t minLag, uint32_t maxLag,
+		float32_t minClarity, autocorrPeriod *period)
+{
+	uint32_t lag, start, best;
+	float32_t before, after, curvature, offset;
+
+	if (acf[0] <= 0.0f || minLag < 1 || maxLag <= minLag)
+	{
+		return false;
+	}
+
+	// Skip the lobe around lag 0
+	start = 1;
+	while (start <= maxLag && acf[start] > 0.0f)
+	{
+		start++;
+	}
+	if (start < minLag)
+	{
+		start = minLag;
+	}
+
+	if (start > maxLag)
+	{
+		return false;
+	}
+
+	best = start;
+	for (lag = start; lag <= maxLag; lag++)
+	{
+		if (acf[lag] > acf[best])
+		{
+			best = lag;
+		}
+	}
+
+	// Take the first local maximum close to the highest one
+	for (lag = start; lag <= maxLag; lag++)
+	{
+		if (acf[lag] >= AUTOCORR_PEAK_FRACTION * acf[best] &&
+				acf[lag] >= acf[lag - 1] && acf[lag] >= acf[lag + 1])
+		{
+			break;
+		}
+	}
+	if (lag > maxLag)
+	{
+		return false;
+	}
+
+	period->clarity = acf[lag] / acf[0];
+	if (period->clarity < minClarity)
+	{
+		return false;
+	}
+
+	// Parabolic interpolation through the peak and its neighbours
+	before = acf[lag - 1];
+	after = acf[lag + 1];
+	curvature = before - 2.0f * acf[lag] + after;
+	offset = (curvature < 0.0f) ? 0.5f * (before - after) / curvature : 0.0f;
+
+	period->lag = lag + offset;
+
+	return true;
+}
@@ -0,0 +1,45 @@
+/*
+ * autocorr.h
+ *
+ *  Fundamental period estimate from the autocorrelation of a frame.
+ *
+ *  The autocorrelation is the inverse RFFT of the power spectrum, so it
+ *  takes O(N log N) instead of O(N^2). The frame is zero-padded to 2N
+ *  first, so that lag t is not aliased with lag N - t as in the
+ *  circular autocorrelation of N points, and lags up to N / 2 are
+ *  scaled by N / (N - t) to undo the taper of the shrinking overlap.
+ *
+ *  The padding means the stage no longer shares the spectrum path's
+ *  RFFT and buffers: each frame runs a 2N-point forward RFFT of its own
+ *  as well as the inverse, the 2048-point plan for DSP_MAX_FFT_SIZE 1024
+ *  takes about 20 KB of flash, and the zero-padded frame and its
+ *  spectrum grow the shared FIR scratch from 4 KB to 16 KB (see
+ *  dsp_arena.h). tests/host/test_autocorr.c times it against a direct
+ *  autocorrelation; on the host, with its plain radix-2 FFT, it is about
+ *  1.5x faster than the direct one over only the searched lags.
+ */
+
+#ifndef AUTOCORR_H_
+#define AUTOCORR_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "arm_math.h"
+
+// A candidate peak must reach this fraction of the highest peak in the
+// search range, so that the fundamental wins over its multiples
+#define AUTOCORR_PEAK_FRACTION 0.9f
+
+typedef struct
+{
+	float32_t lag;          // period in samples, interpolated
+	float32_t clarity;      // peak value normalised by lag 0
+} autocorrPeriod;
+
+void autocorrCompute(arm_rfft_fast_instance_f32 *plan, const float32_t *frame,
+		float32_t *work, float32_t *acf);
+bool autocorrFindPeriod(const float32_t *acf, uint32_t minLag, uint32_t maxLag,
+		float32_t minClarity, autocorrPeriod *period);
+
+#endif /* AUTOCORR_H_ */
@@ -0,0 +1,32 @@
+/*
+ * bands.c
+ *
+ *  Band energies (octave, 1/3-octave or mel) from the power spectrum.
+ */
+
+#include <stdint.h>
+
+#include "arm_math.h"
+#include "bands.h"
+
+// spectrum is the packed arm_rfft_fast_f32 output; the power of each
+// referenced bin is formed on the fly, so the spectrum is read in one
+// pass without a separate power buffer. energy receives numBands values.
+void bandsApply(const bandsWeights *bands, const float32_t *spectrum,
+		float32_t *energy)
+{
+	uint32_t band, i, bin;
+	float32_t sum;
+
+	for (band = 0; band < bands->numBands; band++)
+	{
+		sum = 0.0f;
+		for (i = bands->rowStart[band]; i < bands->rowStart[band + 1]; i++)
+		{
+			bin = bands->column[i];
+			sum += bands->weight[i] * (spectrum[2 * bin] * spectrum[2 * bin] +
+					spectrum[2 * bin + 1] * spectrum[2 * bin + 1]);
+		}
+		energy[band] = sum;
+	}
+}
@@ -0,0 +1,32 @@
+/*
+ * bands.h
+ *
+ *  Band energies (octave, 1/3-octave or mel) from the power spectrum.
+ *
+ *  The weights of every band over the RFFT bins are precomputed by
+ *  tools/gen_fft_tables.py for the configured FFT size and sample rate
+ *  and stored in compressed sparse row form, so each frame costs one
+ *  multiply-accumulate per non-zero weight instead of one per band and
+ *  bin.
+ */
+
+#ifndef BANDS_H_
+#define BANDS_H_
+
+#include <stdint.h>
+
+#include "arm_math.h"
+
+typedef struct
+{
+	uint16_t numBands;
+	const uint16_t *rowStart;       // numBands + 1 offsets into column/weight
+	const uint16_t *column;         // RFFT bin, 1 .. N/2 - 1
+	const float32_t *weight;
+	const uint16_t *centerHz;       // numBands centre frequencies
+} bandsWeights;
+
+void bandsApply(const bandsWeights *bands, const float32_t *spectrum,
+		float32_t *energy);
+
+#endif /* BANDS_H_ */
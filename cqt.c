@@ -0,0 +1,167 @@
+/*
+ * cqt.c
+ *
+ *  Constant-Q style spectrum from a halving decimation cascade.
+ */
+
+#include <stdint.h>
+#include <math.h>
+
+#include "arm_math.h"
+#include "cqt.h"
+#include "fir_design.h"
+
+void cqtInit(cqtInstance *S, arm_rfft_fast_instance_f32 *plan,
+		const float32_t *window, uint32_t numOctaves, uint32_t binsPerOctave,
+		uint32_t numTaps, float32_t *workspace)
+{
+	uint32_t fftSize = plan->fftLenRFFT;
+	uint32_t octave, bin, edge;
+	float32_t *state;
+
+	S->plan = plan;
+	S->window = window;
+	S->numOctaves = numOctaves;
+	S->binsPerOctave = binsPerOctave;
+
+	S->history = workspace;
+	state = S->history + numOctaves * fftSize;
+	S->decimated = state + (numOctaves - 1) * (numTaps + CQT_BLOCK - 1);
+	S->scratch = S->decimated + CQT_BLOCK;
+	S->taps = S->scratch + 2 * fftSize;
+	S->spectrum = S->taps + numTaps;
+
+	// One half-band low-pass serves every stage, since each runs at
+	// twice the rate of the next
+	firDesignBandPass(S->taps, numTaps, 0.0f, CQT_DECIMATOR_CUTOFF, 1.0f);
+	for (octave = 0; octave + 1 < numOctaves; octave++)
+	{
+		arm_fir_decimate_init_f32(&S->decimators[octave], numTaps, 2, S->taps,
+				state + octave * (numTaps + CQT_BLOCK - 1), CQT_BLOCK);
+	}
+
+	// Geometric bin edges over the top octave of the RFFT, kept at least
+	// one RFFT bin apart
+	S->binEdges[0] = fftSize / 4;
+	for (bin = 1; bin <= binsPerOctave; bin++)
+	{
+		edge = (uint32_t)(fftSize / 4 * powf(2.0f, (float32_t)bin / binsPerOctave) + 0.5f);
+		S->binEdges[bin] = (edge > S->binEdges[bin - 1]) ? edge :
+				(uint32_t)S->binEdges[bin - 1] + 1;
+	}
+	S->binEdges[binsPerOctave] = fftSize / 2;
+
+	cqtReset(S);
+}
+
+// Restart every octave as if preceded by silence
+void cqtReset(cqtInstance *S)
+{
+	uint32_t octave;
+
+	for (octave = 0; octave < S->numOctaves; octave++)
+	{
+		S->fill[octave] = 0;
+		if (octave + 1 < S->numOctaves)
+		{
+			arm_fill_f32(0.0f, S->decimators[octave].pState,
+					S->decimators[octave].numTaps + CQT_BLOCK - 1);
+		}
+	}
+	arm_fill_f32(0.0f, S->spectrum, S->numOctaves * S->binsPerOctave);
+}
+
+// Transforms a full octave history and updates its bins
+static void analyseOctave(cqtInstance *S, uint32_t octave)
+{
+	uint32_t fftSize = S->plan->fftLenRFFT;
+	float32_t *timeDomain = S->scratch;
+	float32_t *spectrum = S->scratch + fftSize;
+	float32_t *out = &S->spectrum[(S->numOctaves - 1 - octave) * S->binsPerOctave];
+	uint32_t bin, k;
+	float32_t sum;
+
+	arm_mult_f32(&S->history[octave * fftSize], (float32_t *)S->window,
+			timeDomain, fftSize);
+	arm_rfft_fast_f32(S->plan, timeDomain, spectrum, 0);
+
+	for (bin = 0; bin < S->binsPerOctave; bin++)
+	{
+		sum = 0.0f;
+		for (k = S->binEdges[bin]; k < S->binEdges[bin + 1]; k++)
+		{
+			sum += spectrum[2 * k] * spectrum[2 * k] +
+					spectrum[2 * k + 1] * spectrum[2 * k + 1];
+		}
+		out[bin] = sum;
+	}
+}
+
+// Appends count samples to an octave, analysing every N/2 of them
+static void pushOctave(cqtInstance *S, uint32_t octave, const float32_t *samples,
+		uint32_t count)
+{
+	uint32_t fftSize = S->plan->fftLenRFFT;
+	float32_t *history = &S->history[octave * fftSize];
+	uint32_t chunk;
+
+	while (count)
+	{
+		chunk = fftSize - S->fill[octave];
+		if (chunk > count)
+		{
+			chunk = count;
+		}
+
+		arm_copy_f32((float32_t *)samples, &history[S->fill[octave]], chunk);
+		S->fill[octave] += chunk;
+		samples += chunk;
+		count -= chunk;
+
+		if (S->fill[octave] == fftSize)
+		{
+			analyseOctave(S, octave);
+
+			// Half overlap: the newer half starts the next window
+			arm_copy_f32(&history[fftSize / 2], history, fftSize / 2);
+			S->fill[octave] = fftSize / 2;
+		}
+	}
+}
+
+void cqtProcess(cqtInstance *S, const float32_t *input, uint32_t count)
+{
+	uint32_t octave, length;
+	const float32_t *block;
+	float32_t *next;
+
+	for (; count >= CQT_BLOCK; count -= CQT_BLOCK, input += CQT_BLOCK)
+	{
+		block = input;
+		length = CQT_BLOCK;
+
+		for (octave = 0; octave < S->numOctaves; octave++)
+		{
+			pushOctave(S, octave, block, length);
+
+			if (octave + 1 < S->numOctaves)
+			{
+				// Alternate halves, so a stage never reads what it writes
+				next = &S->decimated[(octave & 1) * (CQT_BLOCK / 2)];
+				arm_fir_decimate_f32(&S->decimators[octave], (float32_t *)block,
+						next, length);
+				block = next;
+				length /= 2;
+			}
+		}
+	}
+}
+
+// Lower edge of bin of the spectrum, counted from the lowest frequency
+float32_t cqtBinHz(const cqtInstance *S, float32_t sampleRate, uint32_t bin)
+{
+	uint32_t octave = S->numOctaves - 1 - bin / S->binsPerOctave;
+
+	return sampleRate / (float32_t)(1u << octave) *
+			S->binEdges[bin % S->binsPerOctave] / S->plan->fftLenRFFT;
+}
@@ -0,0 +1,65 @@
+/*
+ * cqt.h
+ *
+ *  Constant-Q style spectrum from a halving decimation cascade.
+ *
+ *  Octave 0 is the input stream; each further octave is the previous one
+ *  low-pass filtered and decimated by two. Every octave keeps the last N
+ *  samples at its own rate and, every N/2 of them, runs the same cached
+ *  N-point RFFT and keeps the bins of its top octave, N/4 .. N/2, grouped
+ *  into binsPerOctave geometrically spaced bins. The lowest octave so
+ *  gets the resolution of one RFFT 2^(numOctaves - 1) times longer, for
+ *  a fraction of the cycles and memory.
+ */
+
+#ifndef CQT_H_
+#define CQT_H_
+
+#include <stdint.h>
+
+#include "arm_math.h"
+
+// The last decimator of CQT_MAX_OCTAVES still gets an even block
+#define CQT_MAX_OCTAVES 7
+#define CQT_MAX_BINS_PER_OCTAVE 24
+
+// Input samples handled per pass down the cascade; cqtProcess() counts
+// must be a multiple of it
+#define CQT_BLOCK 64
+
+// Transition band of the decimators ends at the new Nyquist, so the top
+// of each octave below the first sees some aliasing from just above it
+#define CQT_DECIMATOR_CUTOFF 0.225f
+
+// Workspace cqtInit() needs, in floats
+#define CQT_WORK_FLOATS(octaves, fftSize, taps, bins) \
+	((octaves) * (fftSize) + ((octaves) - 1) * ((taps) + CQT_BLOCK - 1) + \
+	 CQT_BLOCK + 2 * (fftSize) + (taps) + (octaves) * (bins))
+
+typedef struct
+{
+	arm_rfft_fast_instance_f32 *plan;   // N
+	const float32_t *window;            // N, Hann
+	uint32_t numOctaves;
+	uint32_t binsPerOctave;
+	uint16_t binEdges[CQT_MAX_BINS_PER_OCTAVE + 1]; // RFFT bins N/4 .. N/2
+
+	arm_fir_decimate_instance_f32 decimators[CQT_MAX_OCTAVES - 1];
+	float32_t *taps;
+	float32_t *history;                 // numOctaves * N
+	uint32_t fill[CQT_MAX_OCTAVES];     // samples in each history
+	float32_t *decimated;               // 2 * CQT_BLOCK / 2, ping-pong
+	float32_t *scratch;                 // 2N of RFFT input and output
+
+	// numOctaves * binsPerOctave powers, in ascending frequency
+	float32_t *spectrum;
+} cqtInstance;
+
+void cqtInit(cqtInstance *S, arm_rfft_fast_instance_f32 *plan,
+		const float32_t *window, uint32_t numOctaves, uint32_t binsPerOctave,
+		uint32_t numTaps, float32_t *workspace);
+void cqtReset(cqtInstance *S);
+void cqtProcess(cqtInstance *S, const float32_t *input, uint32_t count);
+float32_t cqtBinHz(const cqtInstance *S, float32_t sampleRate, uint32_t bin);
+
+#endif /* CQT_H_ */
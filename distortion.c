@@ -0,0 +1,250 @@
+/*
+ * distortion.c
+ *
+ *  THD, SNR, SINAD and ENOB of a single tone from the RFFT spectrum.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "arm_math.h"
+#include "distortion.h"
+
+// Marks a bin already counted as DC or tone energy. Power is never
+// negative, so this cannot be mistaken for a noise bin.
+#define CLAIMED -1.0f
+
+void distortionInit(distortionInstance *S, uint32_t fftSize,
+		float32_t sampleRate, const distortionWindow *window,
+		uint32_t numHarmonics, float32_t *power)
+{
+	S->window = window;
+	S->fftSize = fftSize;
+	S->sampleRate = sampleRate;
+	S->numHarmonics = numHarmonics;
+	S->power = power;
+
+	S->fundamentalPower = 0.0f;
+	S->harmonicPower = 0.0f;
+	S->noisePower = 0.0f;
+	S->fundamentalBin = 0.0f;
+	S->frames = 0;
+}
+
+// Cosine-sum windows w[n] = sum (-1)^m a[m] cos(2 pi m n / N), periodic
+const distortionWindow distortionWindowHann =
+{
+	2, { 0.5f, 0.5f }, 3
+};
+const distortionWindow distortionWindowBlackmanHarris =
+{
+	4, { 0.35875f, 0.48829f, 0.14128f, 0.01168f }, 5
+};
+const distortionWindow distortionWindowHannApplied =
+{
+	1, { 1.0f }, 3
+};
+
+// Bin j of the unwindowed spectrum for any j, from the packed RFFT
+// output. Bins above N/2 mirror as conjugates, and DC is taken as 0:
+// removing the ADC offset before windowing keeps its leakage out of the
+// low bins.
+static void binAt(const float32_t *spectrum, int32_t j, int32_t fftSize,
+		float32_t *re, float32_t *im)
+{
+	float32_t sign = 1.0f;
+
+	if (j < 0)
+	{
+		j += fftSize;
+	}
+	if (j > fftSize / 2)
+	{
+		j = fftSize - j;
+		sign = -1.0f;
+	}
+
+	if (j == 0)
+	{
+		*re = 0.0f;
+		*im = 0.0f;
+	}
+	else if (j == fftSize / 2)
+	{
+		*re = spectrum[1];
+		*im = 0.0f;
+	}
+	else
+	{
+		*re = spectrum[2 * j];
+		*im = sign * spectrum[2 * j + 1];
+	}
+}
+
+// Power of bins 0 .. N/2 of the windowed frame. Each cosine term of the
+// window shifts the spectrum by m bins either way:
+// Xw[k] = a[0] X[k] + sum (-1)^m a[m] / 2 (X[k - m] + X[k + m])
+static void windowedPower(const distortionWindow *window,
+		const float32_t *spectrum, float32_t *power, int32_t fftSize)
+{
+	int32_t k, m;
+	float32_t re, im, binRe, binIm, gain;
+
+	for (k = 0; k <= fftSize / 2; k++)
+	{
+		binAt(spectrum, k, fftSize, &re, &im);
+		re *= window->coeffs[0];
+		im *= window->coeffs[0];
+
+		for (m = 1; m < window->numTerms; m++)
+		{
+			gain = ((m & 1) ? -0.5f : 0.5f) * window->coeffs[m];
+
+			binAt(spectrum, k - m, fftSize, &binRe, &binIm);
+			re += gain * binRe;
+			im += gain * binIm;
+			binAt(spectrum, k + m, fftSize, &binRe, &binIm);
+			re += gain * binRe;
+			im += gain * binIm;
+		}
+
+		power[k] = re * re + im * im;
+	}
+}
+
+// Sums and claims the unclaimed bins within leakage bins of centre,
+// clipped to 0 .. N/2
+static float32_t claimBins(float32_t *power, int32_t centre, int32_t leakage,
+		int32_t half)
+{
+	int32_t k;
+	float32_t sum = 0.0f;
+
+	for (k = centre - leakage; k <= centre + leakage; k++)
+	{
+		if (k >= 0 && k <= half && power[k] != CLAIMED)
+		{
+			sum += power[k];
+			power[k] = CLAIMED;
+		}
+	}
+
+	return sum;
+}
+
+void distortionMeasure(distortionInstance *S, const float32_t *spectrum)
+{
+	int32_t half = S->fftSize / 2;
+	int32_t leakage = S->window->leakageBins;
+	int32_t k, peak, claimed;
+	uint32_t harmonic;
+	float32_t *power = S->power;
+	float32_t fundamental, weighted, total, noise, bin, folded;
+
+	windowedPower(S->window, spectrum, power, S->fftSize);
+
+	// DC and its leakage are neither signal nor noise
+	claimBins(power, 0, leakage, half);
+
+	peak = 0;
+	for (k = 1; k <= half; k++)
+	{
+		if (power[k] != CLAIMED && (peak == 0 || power[k] > power[peak]))
+		{
+			peak = k;
+		}
+	}
+	if (peak == 0)
+	{
+		return;
+	}
+
+	// Power weighted centre of the main lobe refines the frequency
+	// between bins, so the harmonics land where they should
+	fundamental = 0.0f;
+	weighted = 0.0f;
+	for (k = peak - leakage; k <= peak + leakage; k++)
+	{
+		if (k > 0 && k <= half && power[k] != CLAIMED)
+		{
+			fundamental += power[k];
+			weighted += power[k] * k;
+		}
+	}
+
+	// A frame with nothing left outside the DC lobe has no tone to
+	// measure, and would make the bin 0 / 0
+	if (fundamental <= 0.0f)
+	{
+		return;
+	}
+
+	bin = weighted / fundamental;
+	claimBins(power, peak, leakage, half);
+
+	total = 0.0f;
+	for (harmonic = 2; harmonic <= S->numHarmonics + 1; harmonic++)
+	{
+		// Harmonics above Nyquist alias back, mirrored about multiples of
+		// the sample rate
+		folded = fmodf(harmonic * bin, (float32_t)S->fftSize);
+		if (folded > half)
+		{
+			folded = S->fftSize - folded;
+		}
+		total += claimBins(power, (int32_t)(folded + 0.5f), leakage, half);
+	}
+
+	// What is left is noise. Scale it up to the whole band, as if the
+	// claimed bins held the same noise density.
+	noise = 0.0f;
+	claimed = 0;
+	for (k = 0; k <= half; k++)
+	{
+		if (power[k] == CLAIMED)
+		{
+			claimed++;
+		}
+		else
+		{
+			noise += power[k];
+		}
+	}
+	if (claimed <= half)
+	{
+		noise *= (float32_t)(half + 1) / (float32_t)(half + 1 - claimed);
+	}
+
+	S->fundamentalPower += fundamental;
+	S->harmonicPower += total;
+	S->noisePower += noise;
+	S->fundamentalBin += bin;
+	S->frames++;
+}
+
+// Metrics over the frames measured since the last call, which starts a
+// new average either way. Returns false, leaving result untouched, if no
+// frame held a tone.
+bool distortionResults(distortionInstance *S, distortionResult *result)
+{
+	bool valid = S->frames != 0 && S->fundamentalPower > 0.0f;
+
+	if (valid)
+	{
+		result->fundamentalHz = S->fundamentalBin / S->frames * S->sampleRate /
+				S->fftSize;
+		result->thd = 10.0f * log10f(S->harmonicPower / S->fundamentalPower);
+		result->snr = 10.0f * log10f(S->fundamentalPower / S->noisePower);
+		result->sinad = 10.0f * log10f(S->fundamentalPower /
+				(S->noisePower + S->harmonicPower));
+		result->enob = (result->sinad - 1.76f) / 6.02f;
+	}
+
+	S->fundamentalPower = 0.0f;
+	S->harmonicPower = 0.0f;
+	S->noisePower = 0.0f;
+	S->fundamentalBin = 0.0f;
+	S->frames = 0;
+
+	return valid;
+}
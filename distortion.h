@@ -0,0 +1,75 @@
+/*
+ * distortion.h
+ *
+ *  THD, SNR, SINAD and ENOB of a single tone from the RFFT spectrum.
+ *
+ *  The frame is analysed through a cosine-sum window applied in the
+ *  frequency domain, as a short convolution of the unwindowed RFFT
+ *  output, so the other stages still see the plain spectrum. Tone
+ *  energy is integrated over the window's leakage bins either side of
+ *  the fundamental and of each harmonic, with harmonics above Nyquist
+ *  folded back into the band, and everything else except DC counts as
+ *  noise.
+ *
+ *  Energies accumulate until distortionResults() is called, which gives
+ *  per-frame metrics when called every frame and averages otherwise.
+ */
+
+#ifndef DISTORTION_H_
+#define DISTORTION_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "arm_math.h"
+
+#define DISTORTION_MAX_WINDOW_TERMS 4
+
+typedef struct
+{
+	int32_t numTerms;
+	float32_t coeffs[DISTORTION_MAX_WINDOW_TERMS];
+	int32_t leakageBins;            // main lobe half-width plus one
+} distortionWindow;
+
+// Hann's sidelobes limit the measurable SNR to about 70 dB; the
+// Blackman-Harris sidelobes are below -92 dB at the cost of a wider lobe
+extern const distortionWindow distortionWindowHann;
+extern const distortionWindow distortionWindowBlackmanHarris;
+
+// For a frame already Hann windowed before the RFFT: no further
+// windowing, only the Hann leakage bins
+extern const distortionWindow distortionWindowHannApplied;
+
+typedef struct
+{
+	const distortionWindow *window;
+	uint32_t fftSize;
+	float32_t sampleRate;
+	uint32_t numHarmonics;          // harmonics after the fundamental
+	float32_t *power;               // N/2 + 1 floats of scratch
+
+	// Accumulated since the last distortionResults()
+	float32_t fundamentalPower;
+	float32_t harmonicPower;
+	float32_t noisePower;
+	float32_t fundamentalBin;       // sum of interpolated bins
+	uint32_t frames;
+} distortionInstance;
+
+typedef struct
+{
+	float32_t fundamentalHz;
+	float32_t thd;                  // dB relative to the fundamental
+	float32_t snr;                  // dB
+	float32_t sinad;                // dB
+	float32_t enob;                 // bits
+} distortionResult;
+
+void distortionInit(distortionInstance *S, uint32_t fftSize,
+		float32_t sampleRate, const distortionWindow *window,
+		uint32_t numHarmonics, float32_t *power);
+void distortionMeasure(distortionInstance *S, const float32_t *spectrum);
+bool distortionResults(distortionInstance *S, distortionResult *result);
+
+#endif /* DISTORTION_H_ */
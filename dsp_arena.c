@@ -0,0 +1,114 @@
+/*
+ * dsp_arena.c
+ *
+ *  Static arena holding all DSP working memory.
+ *
+ *  Allocation is a bump pointer over a statically sized block; nothing is
+ *  ever freed individually. Stages that can share storage call
+ *  dspArenaReuse() so the overlap shows up in the memory report.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "dsp_arena.h"
+#include "report.h"
+
+typedef struct
+{
+	const char *stage;
+	uint32_t offset;
+	uint32_t bytes;
+	bool reused;
+} dspArenaStage;
+
+// uint64_t storage keeps the base DSP_ARENA_ALIGN aligned
+static uint64_t arenaStorage[DSP_ARENA_BYTES / sizeof(uint64_t)];
+static uint32_t arenaUsed;
+
+static dspArenaStage arenaStages[DSP_ARENA_MAX_STAGES];
+static uint32_t arenaStageCount;
+
+static void recordStage(const char *stage, uint32_t offset, uint32_t bytes, bool reused)
+{
+	if (arenaStageCount < DSP_ARENA_MAX_STAGES)
+	{
+		arenaStages[arenaStageCount].stage = stage;
+		arenaStages[arenaStageCount].offset = offset;
+		arenaStages[arenaStageCount].bytes = bytes;
+		arenaStages[arenaStageCount].reused = reused;
+		arenaStageCount++;
+	}
+}
+
+void dspArenaReset(void)
+{
+	arenaUsed = 0;
+	arenaStageCount = 0;
+}
+
+void *dspArenaAlloc(const char *stage, uint32_t bytes)
+{
+	uint8_t *buffer;
+
+	bytes = DSP_ARENA_ALIGN_UP(bytes);
+
+	// The arena is sized at compile time from the same configuration as
+	// the requests, so running out is a programming error. Enter an
+	// infinite loop, preserving the system state for examination by a
+	// debugger.
+	if (bytes > sizeof(arenaStorage) - arenaUsed)
+	{
+		while(1)
+		{
+		}
+	}
+
+	buffer = (uint8_t *)arenaStorage + arenaUsed;
+	recordStage(stage, arenaUsed, bytes, false);
+	arenaUsed += bytes;
+
+	return buffer;
+}
+
+void *dspArenaReuse(const char *stage, void *buffer, uint32_t bytes)
+{
+	recordStage(stage, (uint32_t)((uint8_t *)buffer - (uint8_t *)arenaStorage),
+			DSP_ARENA_ALIGN_UP(bytes), true);
+
+	return buffer;
+}
+
+uint32_t dspArenaUsed(void)
+{
+	return arenaUsed;
+}
+
+void dspArenaReport(void)
+{
+	uint32_t i;
+
+	reportString("DSP arena: stage, offset, bytes\n");
+	for (i = 0; i < arenaStageCount; i++)
+	{
+		reportString("  ");
+		reportString(arenaStages[i].stage);
+		reportString(", ");
+		reportUint(arenaStages[i].offset);
+		reportString(", ");
+		reportUint(arenaStages[i].bytes);
+		if (arenaStages[i].reused)
+		{
+			reportString(" (reused)");
+		}
+		reportString("\n");
+	}
+
+	reportString("DSP arena: used ");
+	reportUint(arenaUsed);
+	reportString(" of ");
+	reportUint(sizeof(arenaStorage));
+	reportString(", SRAM budget ");
+	reportUint(DSP_SRAM_BUDGET);
+	reportString("\n");
+}
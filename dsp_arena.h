@@ -0,0 +1,116 @@
+/*
+ * dsp_arena.h
+ *
+ *  Static arena holding all DSP working memory.
+ *
+ *  Each pipeline stage gets an aligned sub-allocation from a single
+ *  statically sized block. The block size is the sum of the per-stage
+ *  sizes below, derived from the configured FFT size and channel count,
+ *  and the build fails if it does not fit in DSP_SRAM_BUDGET.
+ */
+
+#ifndef DSP_ARENA_H_
+#define DSP_ARENA_H_
+
+#include <stdint.h>
+
+#include "arm_math.h"
+#include "dsp_config.h"
+#include "fft_tables.h"
+#include "cqt.h"
+
+// Alignment of every sub-allocation, enough for doubleword loads
+#define DSP_ARENA_ALIGN 8
+#define DSP_ARENA_ALIGN_UP(n) \
+	(((uint32_t)(n) + DSP_ARENA_ALIGN - 1) & ~(uint32_t)(DSP_ARENA_ALIGN - 1))
+
+// Maximum number of stages recorded for the memory report
+#define DSP_ARENA_MAX_STAGES 16
+
+/* ------------------------------------------------------------------
+ * Per-stage sizes
+ * ------------------------------------------------------------------- */
+// Samples captured by the ADC ISR, consumed (and clobbered) by the RFFT.
+// Two of them are used ping-pong so sampling never stops. Sized, like
+// every per-frame buffer, for the largest run-time FFT size.
+#define DSP_ARENA_FRAME_BYTES \
+	DSP_ARENA_ALIGN_UP(DSP_NUM_CHANNELS * DSP_MAX_FFT_SIZE * sizeof(float32_t))
+#define DSP_ARENA_ACQUIRE_BYTES (2 * DSP_ARENA_FRAME_BYTES)
+
+// RFFT output; the bin magnitudes are written in place over it
+#define DSP_ARENA_SPECTRUM_BYTES \
+	DSP_ARENA_ALIGN_UP(DSP_MAX_FFT_SIZE * sizeof(float32_t))
+
+// Overlap-save FIR: input history, a filter spectrum per sample rate
+// and 2N of FFT scratch
+#define DSP_ARENA_FIR_HISTORY_BYTES \
+	DSP_ARENA_ALIGN_UP(DSP_FIR_FFT_SIZE * sizeof(float32_t))
+#define DSP_ARENA_FIR_SPECTRUM_BYTES \
+	(DSP_NUM_SAMPLE_RATES * DSP_ARENA_ALIGN_UP(DSP_FIR_FFT_SIZE * sizeof(float32_t)))
+// The FIR scratch is shared with the spectrum path; the autocorrelation
+// needs the most of it, a zero-padded frame and its spectrum.
+#define DSP_ARENA_FIR_WORK_FLOATS \
+	((2 * DSP_FIR_FFT_SIZE > 4 * DSP_MAX_FFT_SIZE) ? \
+	 2 * DSP_FIR_FFT_SIZE : 4 * DSP_MAX_FFT_SIZE)
+#define DSP_ARENA_FIR_WORK_BYTES \
+	DSP_ARENA_ALIGN_UP(DSP_ARENA_FIR_WORK_FLOATS * sizeof(float32_t))
+
+// Arbitrary-length FFT output, N complex bins; the magnitudes are
+// written in place over it
+#define DSP_ARENA_ARBFFT_BYTES \
+	DSP_ARENA_ALIGN_UP(2 * DSP_ARBFFT_LENGTH * sizeof(float32_t))
+
+// Band energies of the latest frame
+#define DSP_ARENA_BANDS_BYTES \
+	DSP_ARENA_ALIGN_UP(FFT_BANDS_MAX * sizeof(float32_t))
+
+// Constant-Q cascade: per-octave history and decimator state, RFFT
+// scratch, the decimator taps and the spectrum
+#define DSP_ARENA_CQT_BYTES \
+	DSP_ARENA_ALIGN_UP(CQT_WORK_FLOATS(DSP_CQT_OCTAVES, DSP_CQT_FFT_SIZE, \
+			DSP_CQT_DECIMATOR_TAPS, DSP_CQT_BINS_PER_OCTAVE) * sizeof(float32_t))
+
+#define DSP_ARENA_BYTES \
+	(DSP_ARENA_ACQUIRE_BYTES + DSP_ARENA_SPECTRUM_BYTES + \
+	 DSP_ARENA_FIR_HISTORY_BYTES + DSP_ARENA_FIR_SPECTRUM_BYTES + \
+	 DSP_ARENA_FIR_WORK_BYTES + DSP_ARENA_ARBFFT_BYTES + \
+	 DSP_ARENA_BANDS_BYTES + DSP_ARENA_CQT_BYTES)
+
+// The single-RFFT reference for the constant-Q cascade, input and
+// output, borrows the whole arena at start-up
+#define DSP_ARENA_CQT_REFERENCE_BYTES \
+	(2 * DSP_ARENA_ALIGN_UP(DSP_CQT_REFERENCE_SIZE * sizeof(float32_t)))
+
+// The overlap-save hop, DSP_FIR_FFT_SIZE - DSP_FIR_TAPS + 1, has to be
+// positive
+typedef char dspFirTapsFitFft[(DSP_FIR_TAPS < DSP_FIR_FFT_SIZE) ? 1 : -1];
+
+// The distortion measurement keeps its windowed power spectrum in the
+// FIR scratch too
+typedef char dspDistortionFitsFirWork[(DSP_MAX_FFT_SIZE / 2 + 1 <= DSP_ARENA_FIR_WORK_FLOATS) ? 1 : -1];
+
+// The arbitrary-length FFT runs on the start of a frame and reuses the
+// FIR scratch for its Bluestein work buffer
+typedef char dspArbfftFitsFrame[(DSP_ARBFFT_LENGTH <= TEST_LENGTH_SAMPLES) ? 1 : -1];
+typedef char dspArbfftFitsFirWork[(FFT_ARB_WORK_FLOATS <= DSP_ARENA_FIR_WORK_FLOATS) ? 1 : -1];
+
+// The cascade takes whole frames of CQT_BLOCK samples, and each octave
+// needs at least one RFFT bin per constant-Q bin
+typedef char dspCqtFrameBlocks[(TEST_LENGTH_SAMPLES % CQT_BLOCK == 0) ? 1 : -1];
+typedef char dspCqtOctaves[(DSP_CQT_OCTAVES >= 1 && DSP_CQT_OCTAVES <= CQT_MAX_OCTAVES) ? 1 : -1];
+typedef char dspCqtBins[(DSP_CQT_BINS_PER_OCTAVE <= CQT_MAX_BINS_PER_OCTAVE &&
+		DSP_CQT_BINS_PER_OCTAVE <= DSP_CQT_FFT_SIZE / 4) ? 1 : -1];
+typedef char dspCqtReferenceSize[(DSP_CQT_REFERENCE_SIZE == 0 ||
+		DSP_CQT_REFERENCE_SIZE == DSP_CQT_FFT_SIZE << (DSP_CQT_OCTAVES - 1)) ? 1 : -1];
+typedef char dspCqtReferenceFitsArena[(DSP_ARENA_CQT_REFERENCE_BYTES <= DSP_ARENA_BYTES) ? 1 : -1];
+
+// Fails to compile when the arena outgrows the SRAM budget
+typedef char dspArenaFitsInSram[(DSP_ARENA_BYTES <= DSP_SRAM_BUDGET) ? 1 : -1];
+
+void dspArenaReset(void);
+void *dspArenaAlloc(const char *stage, uint32_t bytes);
+void *dspArenaReuse(const char *stage, void *buffer, uint32_t bytes);
+uint32_t dspArenaUsed(void);
+void dspArenaReport(void);
+
+#endif /* DSP_ARENA_H_ */
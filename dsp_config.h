@@ -0,0 +1,107 @@
+/*
+ * dsp_config.h
+ *
+ *  Compile-time configuration of the sampling and FFT pipeline.
+ */
+
+#ifndef DSP_CONFIG_H_
+#define DSP_CONFIG_H_
+
+// Length of one acquisition frame and of the RFFT run over it
+#define TEST_LENGTH_SAMPLES 256
+
+// Rate to sample analog input
+#define SAMPLING_RATE 44100
+//#define SAMPLING_RATE 16000
+
+// Frame lengths and sample rates analysisRequest() can switch to at run
+// time, see analysis_config.h. Each size gets a generated plan and band
+// weights per rate, and each rate its own precomputed FIR spectrum. The
+// start-up values above must be in the lists, and buffers are sized for
+// DSP_MAX_FFT_SIZE.
+#define DSP_FFT_SIZES 256, 512, 1024
+#define DSP_MAX_FFT_SIZE 1024
+#define DSP_SAMPLE_RATES 44100, 16000
+#define DSP_NUM_SAMPLE_RATES 2
+
+// DSP_RUNTIME_FFT_INIT is a benchmark switch, off (0) by default. Build
+// with --define=DSP_RUNTIME_FFT_INIT=1 to have fftPlanRfft() build its
+// plans with arm_rfft_fast_init_f32() on first use, as the firmware did
+// before tools/gen_fft_tables.py, and read the "before" boot to first
+// result from the same profile report.
+#ifndef DSP_RUNTIME_FFT_INIT
+#define DSP_RUNTIME_FFT_INIT 0
+#endif
+
+// Analysis window at start-up, ANALYSIS_WINDOW_RECTANGULAR or
+// ANALYSIS_WINDOW_HANN
+#define DSP_WINDOW ANALYSIS_WINDOW_RECTANGULAR
+
+// Number of ADC channels captured per frame
+#define DSP_NUM_CHANNELS 1
+
+// Overlap-save FIR run on the sampled stream. Each block consumes
+// DSP_FIR_FFT_SIZE - DSP_FIR_TAPS + 1 new samples, one frame by default.
+#define DSP_FIR_FFT_SIZE 512
+#define DSP_FIR_TAPS 257
+#define DSP_FIR_LOW_HZ 9000
+#define DSP_FIR_HIGH_HZ 11000
+
+// Range and minimum normalised peak for the autocorrelation period
+// estimate. The longest period has to fit in half a frame.
+#define DSP_PITCH_MIN_HZ 400
+#define DSP_PITCH_MAX_HZ 5000
+#define DSP_PITCH_MIN_CLARITY 0.5f
+
+// Length of the arbitrary-length FFT run on the start of each frame,
+// chosen so that its bins fall on exact frequencies: 245 = 5 * 7 * 7
+// gives 180 Hz bins at 44.1 kHz, 441 with a 512-sample frame would give
+// 100 Hz. Lengths with a prime factor above 13 use Bluestein. Frame
+// sizes shorter than this are refused; 0 disables the stage.
+#define DSP_ARBFFT_LENGTH 245
+
+// Band energies reported per frame instead of the raw bins. Weights
+// are generated for DSP_FFT_SIZES at DSP_SAMPLE_RATES; mel uses
+// DSP_BANDS_MEL_COUNT triangles from 0 Hz to Nyquist.
+#define DSP_BANDS_OCTAVE 0
+#define DSP_BANDS_THIRD_OCTAVE 1
+#define DSP_BANDS_MEL 2
+#define DSP_BANDS_SCALE DSP_BANDS_THIRD_OCTAVE
+#define DSP_BANDS_MEL_COUNT 24
+
+// Single-tone THD, SNR, SINAD and ENOB: harmonics after the
+// fundamental, the analysis window (see distortion.h), and whether the
+// report averages every frame since the last one or shows the latest
+#define DSP_DISTORTION_HARMONICS 5
+#define DSP_DISTORTION_WINDOW distortionWindowBlackmanHarris
+#define DSP_DISTORTION_AVERAGE 1
+
+// Constant-Q style spectrum from a halving decimation cascade, see
+// cqt.h: DSP_CQT_OCTAVES octaves of DSP_CQT_BINS_PER_OCTAVE bins, each
+// from a DSP_CQT_FFT_SIZE RFFT at its own rate.
+//
+// DSP_CQT_REFERENCE_SIZE is a benchmark switch, off (0) by default. Set
+// it to DSP_CQT_FFT_SIZE << (DSP_CQT_OCTAVES - 1), the single RFFT with
+// the same lowest-octave resolution, and rerun tools/gen_fft_tables.py
+// to time that RFFT once at start-up against the cascade. Its tables
+// add about 40 KB of flash.
+#define DSP_CQT_OCTAVES 5
+#define DSP_CQT_BINS_PER_OCTAVE 12
+#define DSP_CQT_FFT_SIZE 256
+#define DSP_CQT_DECIMATOR_TAPS 63
+#define DSP_CQT_REFERENCE_SIZE 0
+
+// Seconds between reports over UART. Reporting blocks the main loop,
+// so keep it rare.
+#define DSP_REPORT_SECONDS 1
+
+// SRAM available to the DSP arena. Mirrors the SRAM region and
+// .stack size in tm4c1294ncpdt.cmd / the project linker options, and
+// keeps DSP_SRAM_RESERVED back for .vtable, .data, the rest of .bss and
+// the code and tables relocated into .ramfunc / .ramconst.
+#define DSP_SRAM_SIZE       0x00040000
+#define DSP_STACK_SIZE      0x00000400
+#define DSP_SRAM_RESERVED   0x00004000
+#define DSP_SRAM_BUDGET     (DSP_SRAM_SIZE - DSP_STACK_SIZE - DSP_SRAM_RESERVED)
+
+#endif /* DSP_CONFIG_H_ */
@@ -0,0 +1,77 @@
+/*
+ * dsp_profile.c
+ *
+ *  Per-stage cycle counts from the DWT cycle counter.
+ */
+
+#include <stdint.h>
+
+#include "dsp_profile.h"
+#include "report.h"
+
+static const char * const stageNames[PROFILE_STAGE_COUNT] =
+{
+	"adc isr",
+	"fir",
+	"rfft",
+	"arb fft",
+	"autocorr",
+	"bands",
+	"distortion",
+	"magnitude",
+	"peak",
+	"cqt",
+	"cqt reference",
+	"frame",
+	"boot to main",
+	"boot to first result",
+};
+
+static uint32_t lastCycles[PROFILE_STAGE_COUNT];
+static uint32_t maxCycles[PROFILE_STAGE_COUNT];
+
+void profileInit(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+void profileRecord(profileStage stage, uint32_t startCycles)
+{
+	// Unsigned subtraction handles the counter wrapping
+	uint32_t cycles = PROFILE_NOW() - startCycles;
+
+	lastCycles[stage] = cycles;
+	if (cycles > maxCycles[stage])
+	{
+		maxCycles[stage] = cycles;
+	}
+}
+
+uint32_t profileLast(profileStage stage)
+{
+	return lastCycles[stage];
+}
+
+uint32_t profileMax(profileStage stage)
+{
+	return maxCycles[stage];
+}
+
+void profileReport(void)
+{
+	uint32_t i;
+
+	reportString("Cycles: stage, last, max\n");
+	for (i = 0; i < PROFILE_STAGE_COUNT; i++)
+	{
+		reportString("  ");
+		reportString(stageNames[i]);
+		reportString(", ");
+		reportUint(lastCycles[i]);
+		reportString(", ");
+		reportUint(maxCycles[i]);
+		reportString("\n");
+	}
+}
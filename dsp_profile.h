@@ -0,0 +1,43 @@
+/*
+ * dsp_profile.h
+ *
+ *  Per-stage cycle counts from the DWT cycle counter.
+ */
+
+#ifndef DSP_PROFILE_H_
+#define DSP_PROFILE_H_
+
+#include <stdint.h>
+
+#include "arm_math.h"
+
+typedef enum
+{
+	PROFILE_ADC_ISR,
+	PROFILE_FIR,
+	PROFILE_RFFT,
+	PROFILE_ARBFFT,
+	PROFILE_AUTOCORR,
+	PROFILE_BANDS,
+	PROFILE_DISTORTION,
+	PROFILE_MAGNITUDE,
+	PROFILE_PEAK,
+	PROFILE_CQT,
+	PROFILE_CQT_REFERENCE,
+	PROFILE_FRAME,
+	PROFILE_BOOT_TO_MAIN,
+	PROFILE_BOOT_TO_RESULT,
+	PROFILE_STAGE_COUNT
+} profileStage;
+
+// Current value of the free running cycle counter. It is started by
+// ResetISR(), so a start of 0 measures from reset.
+#define PROFILE_NOW() (DWT->CYCCNT)
+
+void profileInit(void);
+void profileRecord(profileStage stage, uint32_t startCycles);
+uint32_t profileLast(profileStage stage);
+uint32_t profileMax(profileStage stage);
+void profileReport(void);
+
+#endif /* DSP_PROFILE_H_ */
@@ -0,0 +1,131 @@
+/*
+ * fastconv.c
+ *
+ *  Overlap-save fast convolution on top of the CMSIS RFFT.
+ */
+
+#include <stdint.h>
+
+#include "arm_math.h"
+#include "fastconv.h"
+
+// Multiply two spectra in the packed arm_rfft_fast_f32 layout: element 0
+// is the real DC bin, element 1 the real Nyquist bin, and the rest are
+// complex bins 1 .. N/2 - 1. The result may overwrite either input.
+static void multiplyPacked(float32_t *a, const float32_t *b, float32_t *result,
+		uint32_t fftSize)
+{
+	result[0] = a[0] * b[0];
+	result[1] = a[1] * b[1];
+
+	arm_cmplx_mult_cmplx_f32(&a[2], (float32_t *)&b[2], &result[2],
+			fftSize / 2 - 1);
+}
+
+// Computes the spectrum of the zero-padded filter once, so that each block
+// only needs the multiply. scratch must hold N floats.
+void fastconvFilterSpectrum(arm_rfft_fast_instance_f32 *plan,
+		const float32_t *taps, uint32_t numTaps, float32_t *spectrum,
+		float32_t *scratch)
+{
+	uint32_t i;
+
+	for (i = 0; i < plan->fftLenRFFT; i++)
+	{
+		scratch[i] = (i < numTaps) ? taps[i] : 0.0f;
+	}
+
+	arm_rfft_fast_f32(plan, scratch, spectrum, 0);
+}
+
+// The filter must be shorter than the FFT, leaving a hop of at least
+// two samples
+void fastconvInit(fastconvInstance *S, arm_rfft_fast_instance_f32 *plan,
+		const float32_t *filterSpectrum, uint32_t numTaps,
+		float32_t *history, float32_t *work,
+		fastconvConsumer consumer, void *context)
+{
+	if (numTaps == 0 || numTaps >= plan->fftLenRFFT)
+	{
+		// The hop would be zero or wrap around. Enter an infinite loop,
+		// preserving the system state for examination by a debugger.
+		while(1)
+		{
+		}
+	}
+
+	S->plan = plan;
+	S->filterSpectrum = filterSpectrum;
+	S->numTaps = numTaps;
+	S->hop = plan->fftLenRFFT - numTaps + 1;
+	S->history = history;
+	S->work = work;
+	S->consumer = consumer;
+	S->context = context;
+
+	fastconvReset(S);
+}
+
+// Restart the stream as if preceded by silence
+void fastconvReset(fastconvInstance *S)
+{
+	arm_fill_f32(0.0f, S->history, S->plan->fftLenRFFT);
+	S->fill = 0;
+}
+
+// Switch to another filter of the same length, e.g. one designed for a
+// new sample rate. The stream restarts as after fastconvReset().
+void fastconvSetFilter(fastconvInstance *S, const float32_t *filterSpectrum)
+{
+	S->filterSpectrum = filterSpectrum;
+	fastconvReset(S);
+}
+
+static void filterBlock(fastconvInstance *S)
+{
+	uint32_t fftSize = S->plan->fftLenRFFT;
+	uint32_t saved = S->numTaps - 1;
+	float32_t *timeDomain = S->work;
+	float32_t *spectrum = S->work + fftSize;
+
+	// The RFFT uses its input as scratch, so keep history intact
+	arm_copy_f32(S->history, timeDomain, fftSize);
+
+	arm_rfft_fast_f32(S->plan, timeDomain, spectrum, 0);
+	multiplyPacked(spectrum, S->filterSpectrum, spectrum, fftSize);
+	arm_rfft_fast_f32(S->plan, spectrum, timeDomain, 1);
+
+	// The first M - 1 outputs are wrapped around by the circular
+	// convolution; the remaining L are the filtered block
+	S->consumer(&timeDomain[saved], S->hop, S->context);
+
+	// The last M - 1 inputs become the start of the next block
+	arm_copy_f32(&S->history[S->hop], S->history, saved);
+	S->fill = 0;
+}
+
+void fastconvProcess(fastconvInstance *S, const float32_t *input,
+		uint32_t count)
+{
+	uint32_t saved = S->numTaps - 1;
+	uint32_t chunk;
+
+	while (count)
+	{
+		chunk = S->hop - S->fill;
+		if (chunk > count)
+		{
+			chunk = count;
+		}
+
+		arm_copy_f32((float32_t *)input, &S->history[saved + S->fill], chunk);
+		S->fill += chunk;
+		input += chunk;
+		count -= chunk;
+
+		if (S->fill == S->hop)
+		{
+			filterBlock(S);
+		}
+	}
+}
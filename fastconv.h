@@ -0,0 +1,48 @@
+/*
+ * fastconv.h
+ *
+ *  Overlap-save fast convolution on top of the CMSIS RFFT.
+ *
+ *  With an FFT size N and an M tap filter, every block of L = N - M + 1
+ *  new samples costs one forward RFFT, one complex multiply by the
+ *  precomputed filter spectrum and one inverse RFFT, instead of M
+ *  multiply-accumulates per sample for a direct-form FIR.
+ */
+
+#ifndef FASTCONV_H_
+#define FASTCONV_H_
+
+#include <stdint.h>
+
+#include "arm_math.h"
+
+// Receives each block of filtered samples
+typedef void (*fastconvConsumer)(const float32_t *samples, uint32_t count,
+		void *context);
+
+typedef struct
+{
+	arm_rfft_fast_instance_f32 *plan;
+	const float32_t *filterSpectrum;    // N floats, CMSIS packed RFFT
+	uint32_t numTaps;                   // M
+	uint32_t hop;                       // L = N - M + 1
+	uint32_t fill;                      // new samples in history
+	float32_t *history;                 // N floats, M - 1 saved + L new
+	float32_t *work;                    // 2N floats of FFT scratch
+	fastconvConsumer consumer;
+	void *context;
+} fastconvInstance;
+
+void fastconvFilterSpectrum(arm_rfft_fast_instance_f32 *plan,
+		const float32_t *taps, uint32_t numTaps, float32_t *spectrum,
+		float32_t *scratch);
+void fastconvInit(fastconvInstance *S, arm_rfft_fast_instance_f32 *plan,
+		const float32_t *filterSpectrum, uint32_t numTaps,
+		float32_t *history, float32_t *work,
+		fastconvConsumer consumer, void *context);
+void fastconvReset(fastconvInstance *S);
+void fastconvSetFilter(fastconvInstance *S, const float32_t *filterSpectrum);
+void fastconvProcess(fastconvInstance *S, const float32_t *input,
+		uint32_t count);
+
+#endif /* FASTCONV_H_ */
@@ -0,0 +1,3573 @@
+/*
+ * fft_tables.c
+ *
+ *  Generated by tools/gen_fft_tables.py for RFFT sizes 256, 512, 1024, 2048 and arbitrary length 245,
+ *  bands at 44100, 16000 Hz.
+ *  Do not edit; rerun the generator instead.
+ */
+
+#include <stdint.h>
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+#include "fft_tables.h"
+#include "dsp_config.h"
+
+#pragma DATA_SECTION(fftTwiddle128, ".const:fftTwiddle128")
+const float32_t fftTwiddle128[256] =
+{
+	1.000000000e+00f, 0.000000000e+00f, 9.987954562e-01f, 4.906767433e-02f,
+	9.951847267e-01f, 9.801714033e-02f, 9.891765100e-01f, 1.467304745e-01f,
+	9.807852804e-01f, 1.950903220e-01f, 9.700312532e-01f, 2.429801799e-01f,
+	9.569403357e-01f, 2.902846773e-01f, 9.415440652e-01f, 3.368898534e-01f,
+	9.238795325e-01f, 3.826834324e-01f, 9.039892931e-01f, 4.275550934e-01f,
+	8.819212643e-01f, 4.713967368e-01f, 8.577286100e-01f, 5.141027442e-01f,
+	8.314696123e-01f, 5.555702330e-01f, 8.032075315e-01f, 5.956993045e-01f,
+	7.730104534e-01f, 6.343932842e-01f, 7.409511254e-01f, 6.715589548e-01f,
+	7.071067812e-01f, 7.071067812e-01f, 6.715589548e-01f, 7.409511254e-01f,
+	6.343932842e-01f, 7.730104534e-01f, 5.956993045e-01f, 8.032075315e-01f,
+	5.555702330e-01f, 8.314696123e-01f, 5.141027442e-01f, 8.577286100e-01f,
+	4.713967368e-01f, 8.819212643e-01f, 4.275550934e-01f, 9.039892931e-01f,
+	3.826834324e-01f, 9.238795325e-01f, 3.368898534e-01f, 9.415440652e-01f,
+	2.902846773e-01f, 9.569403357e-01f, 2.429801799e-01f, 9.700312532e-01f,
+	1.950903220e-01f, 9.807852804e-01f, 1.467304745e-01f, 9.891765100e-01f,
+	9.801714033e-02f, 9.951847267e-01f, 4.906767433e-02f, 9.987954562e-01f,
+	6.123233996e-17f, 1.000000000e+00f, -4.906767433e-02f, 9.987954562e-01f,
+	-9.801714033e-02f, 9.951847267e-01f, -1.467304745e-01f, 9.891765100e-01f,
+	-1.950903220e-01f, 9.807852804e-01f, -2.429801799e-01f, 9.700312532e-01f,
+	-2.902846773e-01f, 9.569403357e-01f, -3.368898534e-01f, 9.415440652e-01f,
+	-3.826834324e-01f, 9.238795325e-01f, -4.275550934e-01f, 9.039892931e-01f,
+	-4.713967368e-01f, 8.819212643e-01f, -5.141027442e-01f, 8.577286100e-01f,
+	-5.555702330e-01f, 8.314696123e-01f, -5.956993045e-01f, 8.032075315e-01f,
+	-6.343932842e-01f, 7.730104534e-01f, -6.715589548e-01f, 7.409511254e-01f,
+	-7.071067812e-01f, 7.071067812e-01f, -7.409511254e-01f, 6.715589548e-01f,
+	-7.730104534e-01f, 6.343932842e-01f, -8.032075315e-01f, 5.956993045e-01f,
+	-8.314696123e-01f, 5.555702330e-01f, -8.577286100e-01f, 5.141027442e-01f,
+	-8.819212643e-01f, 4.713967368e-01f, -9.039892931e-01f, 4.275550934e-01f,
+	-9.238795325e-01f, 3.826834324e-01f, -9.415440652e-01f, 3.368898534e-01f,
+	-9.569403357e-01f, 2.902846773e-01f, -9.700312532e-01f, 2.429801799e-01f,
+	-9.807852804e-01f, 1.950903220e-01f, -9.891765100e-01f, 1.467304745e-01f,
+	-9.951847267e-01f, 9.801714033e-02f, -9.987954562e-01f, 4.906767433e-02f,
+	-1.000000000e+00f, 1.224646799e-16f, -9.987954562e-01f, -4.906767433e-02f,
+	-9.951847267e-01f, -9.801714033e-02f, -9.891765100e-01f, -1.467304745e-01f,
+	-9.807852804e-01f, -1.950903220e-01f, -9.700312532e-01f, -2.429801799e-01f,
+	-9.569403357e-01f, -2.902846773e-01f, -9.415440652e-01f, -3.368898534e-01f,
+	-9.238795325e-01f, -3.826834324e-01f, -9.039892931e-01f, -4.275550934e-01f,
+	-8.819212643e-01f, -4.713967368e-01f, -8.577286100e-01f, -5.141027442e-01f,
+	-8.314696123e-01f, -5.555702330e-01f, -8.032075315e-01f, -5.956993045e-01f,
+	-7.730104534e-01f, -6.343932842e-01f, -7.409511254e-01f, -6.715589548e-01f,
+	-7.071067812e-01f, -7.071067812e-01f, -6.715589548e-01f, -7.409511254e-01f,
+	-6.343932842e-01f, -7.730104534e-01f, -5.956993045e-01f, -8.032075315e-01f,
+	-5.555702330e-01f, -8.314696123e-01f, -5.141027442e-01f, -8.577286100e-01f,
+	-4.713967368e-01f, -8.819212643e-01f, -4.275550934e-01f, -9.039892931e-01f,
+	-3.826834324e-01f, -9.238795325e-01f, -3.368898534e-01f, -9.415440652e-01f,
+	-2.902846773e-01f, -9.569403357e-01f, -2.429801799e-01f, -9.700312532e-01f,
+	-1.950903220e-01f, -9.807852804e-01f, -1.467304745e-01f, -9.891765100e-01f,
+	-9.801714033e-02f, -9.951847267e-01f, -4.906767433e-02f, -9.987954562e-01f,
+	-1.836970199e-16f, -1.000000000e+00f, 4.906767433e-02f, -9.987954562e-01f,
+	9.801714033e-02f, -9.951847267e-01f, 1.467304745e-01f, -9.891765100e-01f,
+	1.950903220e-01f, -9.807852804e-01f, 2.429801799e-01f, -9.700312532e-01f,
+	2.902846773e-01f, -9.569403357e-01f, 3.368898534e-01f, -9.415440652e-01f,
+	3.826834324e-01f, -9.238795325e-01f, 4.275550934e-01f, -9.039892931e-01f,
+	4.713967368e-01f, -8.819212643e-01f, 5.141027442e-01f, -8.577286100e-01f,
+	5.555702330e-01f, -8.314696123e-01f, 5.956993045e-01f, -8.032075315e-01f,
+	6.343932842e-01f, -7.730104534e-01f, 6.715589548e-01f, -7.409511254e-01f,
+	7.071067812e-01f, -7.071067812e-01f, 7.409511254e-01f, -6.715589548e-01f,
+	7.730104534e-01f, -6.343932842e-01f, 8.032075315e-01f, -5.956993045e-01f,
+	8.314696123e-01f, -5.555702330e-01f, 8.577286100e-01f, -5.141027442e-01f,
+	8.819212643e-01f, -4.713967368e-01f, 9.039892931e-01f, -4.275550934e-01f,
+	9.238795325e-01f, -3.826834324e-01f, 9.415440652e-01f, -3.368898534e-01f,
+	9.569403357e-01f, -2.902846773e-01f, 9.700312532e-01f, -2.429801799e-01f,
+	9.807852804e-01f, -1.950903220e-01f, 9.891765100e-01f, -1.467304745e-01f,
+	9.951847267e-01f, -9.801714033e-02f, 9.987954562e-01f, -4.906767433e-02f,
+};
+
+#pragma DATA_SECTION(fftTwiddleRfft256, ".const:fftTwiddleRfft256")
+const float32_t fftTwiddleRfft256[256] =
+{
+	0.000000000e+00f, 1.000000000e+00f, 2.454122852e-02f, 9.996988187e-01f,
+	4.906767433e-02f, 9.987954562e-01f, 7.356456360e-02f, 9.972904567e-01f,
+	9.801714033e-02f, 9.951847267e-01f, 1.224106752e-01f, 9.924795346e-01f,
+	1.467304745e-01f, 9.891765100e-01f, 1.709618888e-01f, 9.852776424e-01f,
+	1.950903220e-01f, 9.807852804e-01f, 2.191012402e-01f, 9.757021300e-01f,
+	2.429801799e-01f, 9.700312532e-01f, 2.667127575e-01f, 9.637760658e-01f,
+	2.902846773e-01f, 9.569403357e-01f, 3.136817404e-01f, 9.495281806e-01f,
+	3.368898534e-01f, 9.415440652e-01f, 3.598950365e-01f, 9.329927988e-01f,
+	3.826834324e-01f, 9.238795325e-01f, 4.052413140e-01f, 9.142097557e-01f,
+	4.275550934e-01f, 9.039892931e-01f, 4.496113297e-01f, 8.932243012e-01f,
+	4.713967368e-01f, 8.819212643e-01f, 4.928981922e-01f, 8.700869911e-01f,
+	5.141027442e-01f, 8.577286100e-01f, 5.349976199e-01f, 8.448535652e-01f,
+	5.555702330e-01f, 8.314696123e-01f, 5.758081914e-01f, 8.175848132e-01f,
+	5.956993045e-01f, 8.032075315e-01f, 6.152315906e-01f, 7.883464276e-01f,
+	6.343932842e-01f, 7.730104534e-01f, 6.531728430e-01f, 7.572088465e-01f,
+	6.715589548e-01f, 7.409511254e-01f, 6.895405447e-01f, 7.242470830e-01f,
+	7.071067812e-01f, 7.071067812e-01f, 7.242470830e-01f, 6.895405447e-01f,
+	7.409511254e-01f, 6.715589548e-01f, 7.572088465e-01f, 6.531728430e-01f,
+	7.730104534e-01f, 6.343932842e-01f, 7.883464276e-01f, 6.152315906e-01f,
+	8.032075315e-01f, 5.956993045e-01f, 8.175848132e-01f, 5.758081914e-01f,
+	8.314696123e-01f, 5.555702330e-01f, 8.448535652e-01f, 5.349976199e-01f,
+	8.577286100e-01f, 5.141027442e-01f, 8.700869911e-01f, 4.928981922e-01f,
+	8.819212643e-01f, 4.713967368e-01f, 8.932243012e-01f, 4.496113297e-01f,
+	9.039892931e-01f, 4.275550934e-01f, 9.142097557e-01f, 4.052413140e-01f,
+	9.238795325e-01f, 3.826834324e-01f, 9.329927988e-01f, 3.598950365e-01f,
+	9.415440652e-01f, 3.368898534e-01f, 9.495281806e-01f, 3.136817404e-01f,
+	9.569403357e-01f, 2.902846773e-01f, 9.637760658e-01f, 2.667127575e-01f,
+	9.700312532e-01f, 2.429801799e-01f, 9.757021300e-01f, 2.191012402e-01f,
+	9.807852804e-01f, 1.950903220e-01f, 9.852776424e-01f, 1.709618888e-01f,
+	9.891765100e-01f, 1.467304745e-01f, 9.924795346e-01f, 1.224106752e-01f,
+	9.951847267e-01f, 9.801714033e-02f, 9.972904567e-01f, 7.356456360e-02f,
+	9.987954562e-01f, 4.906767433e-02f, 9.996988187e-01f, 2.454122852e-02f,
+	1.000000000e+00f, 6.123233996e-17f, 9.996988187e-01f, -2.454122852e-02f,
+	9.987954562e-01f, -4.906767433e-02f, 9.972904567e-01f, -7.356456360e-02f,
+	9.951847267e-01f, -9.801714033e-02f, 9.924795346e-01f, -1.224106752e-01f,
+	9.891765100e-01f, -1.467304745e-01f, 9.852776424e-01f, -1.709618888e-01f,
+	9.807852804e-01f, -1.950903220e-01f, 9.757021300e-01f, -2.191012402e-01f,
+	9.700312532e-01f, -2.429801799e-01f, 9.637760658e-01f, -2.667127575e-01f,
+	9.569403357e-01f, -2.902846773e-01f, 9.495281806e-01f, -3.136817404e-01f,
+	9.415440652e-01f, -3.368898534e-01f, 9.329927988e-01f, -3.598950365e-01f,
+	9.238795325e-01f, -3.826834324e-01f, 9.142097557e-01f, -4.052413140e-01f,
+	9.039892931e-01f, -4.275550934e-01f, 8.932243012e-01f, -4.496113297e-01f,
+	8.819212643e-01f, -4.713967368e-01f, 8.700869911e-01f, -4.928981922e-01f,
+	8.577286100e-01f, -5.141027442e-01f, 8.448535652e-01f, -5.349976199e-01f,
+	8.314696123e-01f, -5.555702330e-01f, 8.175848132e-01f, -5.758081914e-01f,
+	8.032075315e-01f, -5.956993045e-01f, 7.883464276e-01f, -6.152315906e-01f,
+	7.730104534e-01f, -6.343932842e-01f, 7.572088465e-01f, -6.531728430e-01f,
+	7.409511254e-01f, -6.715589548e-01f, 7.242470830e-01f, -6.895405447e-01f,
+	7.071067812e-01f, -7.071067812e-01f, 6.895405447e-01f, -7.242470830e-01f,
+	6.715589548e-01f, -7.409511254e-01f, 6.531728430e-01f, -7.572088465e-01f,
+	6.343932842e-01f, -7.730104534e-01f, 6.152315906e-01f, -7.883464276e-01f,
+	5.956993045e-01f, -8.032075315e-01f, 5.758081914e-01f, -8.175848132e-01f,
+	5.555702330e-01f, -8.314696123e-01f, 5.349976199e-01f, -8.448535652e-01f,
+	5.141027442e-01f, -8.577286100e-01f, 4.928981922e-01f, -8.700869911e-01f,
+	4.713967368e-01f, -8.819212643e-01f, 4.496113297e-01f, -8.932243012e-01f,
+	4.275550934e-01f, -9.039892931e-01f, 4.052413140e-01f, -9.142097557e-01f,
+	3.826834324e-01f, -9.238795325e-01f, 3.598950365e-01f, -9.329927988e-01f,
+	3.368898534e-01f, -9.415440652e-01f, 3.136817404e-01f, -9.495281806e-01f,
+	2.902846773e-01f, -9.569403357e-01f, 2.667127575e-01f, -9.637760658e-01f,
+	2.429801799e-01f, -9.700312532e-01f, 2.191012402e-01f, -9.757021300e-01f,
+	1.950903220e-01f, -9.807852804e-01f, 1.709618888e-01f, -9.852776424e-01f,
+	1.467304745e-01f, -9.891765100e-01f, 1.224106752e-01f, -9.924795346e-01f,
+	9.801714033e-02f, -9.951847267e-01f, 7.356456360e-02f, -9.972904567e-01f,
+	4.906767433e-02f, -9.987954562e-01f, 2.454122852e-02f, -9.996988187e-01f,
+};
+
+#pragma DATA_SECTION(fftWindowHann256, ".const:fftWindowHann256")
+const float32_t fftWindowHann256[256] =
+{
+	0.000000000e+00f, 1.505906519e-04f, 6.022718974e-04f, 1.354771661e-03f,
+	2.407636664e-03f, 3.760232701e-03f, 5.411745018e-03f, 7.361178806e-03f,
+	9.607359798e-03f, 1.214893498e-02f, 1.498437340e-02f, 1.811196710e-02f,
+	2.152983213e-02f, 2.523590970e-02f, 2.922796741e-02f, 3.350360058e-02f,
+	3.806023374e-02f, 4.289512215e-02f, 4.800535344e-02f, 5.338784940e-02f,
+	5.903936783e-02f, 6.495650445e-02f, 7.113569500e-02f, 7.757321738e-02f,
+	8.426519385e-02f, 9.120759342e-02f, 9.839623426e-02f, 1.058267862e-01f,
+	1.134947733e-01f, 1.213955767e-01f, 1.295244373e-01f, 1.378764585e-01f,
+	1.464466094e-01f, 1.552297276e-01f, 1.642205226e-01f, 1.734135785e-01f,
+	1.828033579e-01f, 1.923842047e-01f, 2.021503478e-01f, 2.120959043e-01f,
+	2.222148835e-01f, 2.325011901e-01f, 2.429486279e-01f, 2.535509039e-01f,
+	2.643016316e-01f, 2.751943352e-01f, 2.862224533e-01f, 2.973793430e-01f,
+	3.086582838e-01f, 3.200524817e-01f, 3.315550733e-01f, 3.431591298e-01f,
+	3.548576614e-01f, 3.666436213e-01f, 3.785099100e-01f, 3.904493799e-01f,
+	4.024548390e-01f, 4.145190556e-01f, 4.266347628e-01f, 4.387946624e-01f,
+	4.509914298e-01f, 4.632177182e-01f, 4.754661628e-01f, 4.877293857e-01f,
+	5.000000000e-01f, 5.122706143e-01f, 5.245338372e-01f, 5.367822818e-01f,
+	5.490085702e-01f, 5.612053376e-01f, 5.733652372e-01f, 5.854809444e-01f,
+	5.975451610e-01f, 6.095506201e-01f, 6.214900900e-01f, 6.333563787e-01f,
+	6.451423386e-01f, 6.568408702e-01f, 6.684449267e-01f, 6.799475183e-01f,
+	6.913417162e-01f, 7.026206570e-01f, 7.137775467e-01f, 7.248056648e-01f,
+	7.356983684e-01f, 7.464490961e-01f, 7.570513721e-01f, 7.674988099e-01f,
+	7.777851165e-01f, 7.879040957e-01f, 7.978496522e-01f, 8.076157953e-01f,
+	8.171966421e-01f, 8.265864215e-01f, 8.357794774e-01f, 8.447702724e-01f,
+	8.535533906e-01f, 8.621235415e-01f, 8.704755627e-01f, 8.786044233e-01f,
+	8.865052267e-01f, 8.941732138e-01f, 9.016037657e-01f, 9.087924066e-01f,
+	9.157348062e-01f, 9.224267826e-01f, 9.288643050e-01f, 9.350434956e-01f,
+	9.409606322e-01f, 9.466121506e-01f, 9.519946466e-01f, 9.571048779e-01f,
+	9.619397663e-01f, 9.664963994e-01f, 9.707720326e-01f, 9.747640903e-01f,
+	9.784701679e-01f, 9.818880329e-01f, 9.850156266e-01f, 9.878510650e-01f,
+	9.903926402e-01f, 9.926388212e-01f, 9.945882550e-01f, 9.962397673e-01f,
+	9.975923633e-01f, 9.986452283e-01f, 9.993977281e-01f, 9.998494093e-01f,
+	1.000000000e+00f, 9.998494093e-01f, 9.993977281e-01f, 9.986452283e-01f,
+	9.975923633e-01f, 9.962397673e-01f, 9.945882550e-01f, 9.926388212e-01f,
+	9.903926402e-01f, 9.878510650e-01f, 9.850156266e-01f, 9.818880329e-01f,
+	9.784701679e-01f, 9.747640903e-01f, 9.707720326e-01f, 9.664963994e-01f,
+	9.619397663e-01f, 9.571048779e-01f, 9.519946466e-01f, 9.466121506e-01f,
+	9.409606322e-01f, 9.350434956e-01f, 9.288643050e-01f, 9.224267826e-01f,
+	9.157348062e-01f, 9.087924066e-01f, 9.016037657e-01f, 8.941732138e-01f,
+	8.865052267e-01f, 8.786044233e-01f, 8.704755627e-01f, 8.621235415e-01f,
+	8.535533906e-01f, 8.447702724e-01f, 8.357794774e-01f, 8.265864215e-01f,
+	8.171966421e-01f, 8.076157953e-01f, 7.978496522e-01f, 7.879040957e-01f,
+	7.777851165e-01f, 7.674988099e-01f, 7.570513721e-01f, 7.464490961e-01f,
+	7.356983684e-01f, 7.248056648e-01f, 7.137775467e-01f, 7.026206570e-01f,
+	6.913417162e-01f, 6.799475183e-01f, 6.684449267e-01f, 6.568408702e-01f,
+	6.451423386e-01f, 6.333563787e-01f, 6.214900900e-01f, 6.095506201e-01f,
+	5.975451610e-01f, 5.854809444e-01f, 5.733652372e-01f, 5.612053376e-01f,
+	5.490085702e-01f, 5.367822818e-01f, 5.245338372e-01f, 5.122706143e-01f,
+	5.000000000e-01f, 4.877293857e-01f, 4.754661628e-01f, 4.632177182e-01f,
+	4.509914298e-01f, 4.387946624e-01f, 4.266347628e-01f, 4.145190556e-01f,
+	4.024548390e-01f, 3.904493799e-01f, 3.785099100e-01f, 3.666436213e-01f,
+	3.548576614e-01f, 3.431591298e-01f, 3.315550733e-01f, 3.200524817e-01f,
+	3.086582838e-01f, 2.973793430e-01f, 2.862224533e-01f, 2.751943352e-01f,
+	2.643016316e-01f, 2.535509039e-01f, 2.429486279e-01f, 2.325011901e-01f,
+	2.222148835e-01f, 2.120959043e-01f, 2.021503478e-01f, 1.923842047e-01f,
+	1.828033579e-01f, 1.734135785e-01f, 1.642205226e-01f, 1.552297276e-01f,
+	1.464466094e-01f, 1.378764585e-01f, 1.295244373e-01f, 1.213955767e-01f,
+	1.134947733e-01f, 1.058267862e-01f, 9.839623426e-02f, 9.120759342e-02f,
+	8.426519385e-02f, 7.757321738e-02f, 7.113569500e-02f, 6.495650445e-02f,
+	5.903936783e-02f, 5.338784940e-02f, 4.800535344e-02f, 4.289512215e-02f,
+	3.806023374e-02f, 3.350360058e-02f, 2.922796741e-02f, 2.523590970e-02f,
+	2.152983213e-02f, 1.811196710e-02f, 1.498437340e-02f, 1.214893498e-02f,
+	9.607359798e-03f, 7.361178806e-03f, 5.411745018e-03f, 3.760232701e-03f,
+	2.407636664e-03f, 1.354771661e-03f, 6.022718974e-04f, 1.505906519e-04f,
+};
+
+const arm_rfft_fast_instance_f32 fftPlan256 =
+{
+	{ 128, fftTwiddle128, armBitRevIndexTable128, ARMBITREVINDEXTABLE_128_TABLE_LENGTH },
+	256,
+	(float32_t *)fftTwiddleRfft256
+};
+
+#pragma DATA_SECTION(fftTwiddle256, ".const:fftTwiddle256")
+const float32_t fftTwiddle256[512] =
+{
+	1.000000000e+00f, 0.000000000e+00f, 9.996988187e-01f, 2.454122852e-02f,
+	9.987954562e-01f, 4.906767433e-02f, 9.972904567e-01f, 7.356456360e-02f,
+	9.951847267e-01f, 9.801714033e-02f, 9.924795346e-01f, 1.224106752e-01f,
+	9.891765100e-01f, 1.467304745e-01f, 9.852776424e-01f, 1.709618888e-01f,
+	9.807852804e-01f, 1.950903220e-01f, 9.757021300e-01f, 2.191012402e-01f,
+	9.700312532e-01f, 2.429801799e-01f, 9.637760658e-01f, 2.667127575e-01f,
+	9.569403357e-01f, 2.902846773e-01f, 9.495281806e-01f, 3.136817404e-01f,
+	9.415440652e-01f, 3.368898534e-01f, 9.329927988e-01f, 3.598950365e-01f,
+	9.238795325e-01f, 3.826834324e-01f, 9.142097557e-01f, 4.052413140e-01f,
+	9.039892931e-01f, 4.275550934e-01f, 8.932243012e-01f, 4.496113297e-01f,
+	8.819212643e-01f, 4.713967368e-01f, 8.700869911e-01f, 4.928981922e-01f,
+	8.577286100e-01f, 5.141027442e-01f, 8.448535652e-01f, 5.349976199e-01f,
+	8.314696123e-01f, 5.555702330e-01f, 8.175848132e-01f, 5.758081914e-01f,
+	8.032075315e-01f, 5.956993045e-01f, 7.883464276e-01f, 6.152315906e-01f,
+	7.730104534e-01f, 6.343932842e-01f, 7.572088465e-01f, 6.531728430e-01f,
+	7.409511254e-01f, 6.715589548e-01f, 7.242470830e-01f, 6.895405447e-01f,
+	7.071067812e-01f, 7.071067812e-01f, 6.895405447e-01f, 7.242470830e-01f,
+	6.715589548e-01f, 7.409511254e-01f, 6.531728430e-01f, 7.572088465e-01f,
+	6.343932842e-01f, 7.730104534e-01f, 6.152315906e-01f, 7.883464276e-01f,
+	5.956993045e-01f, 8.032075315e-01f, 5.758081914e-01f, 8.175848132e-01f,
+	5.555702330e-01f, 8.314696123e-01f, 5.349976199e-01f, 8.448535652e-01f,
+	5.141027442e-01f, 8.577286100e-01f, 4.928981922e-01f, 8.700869911e-01f,
+	4.713967368e-01f, 8.819212643e-01f, 4.496113297e-01f, 8.932243012e-01f,
+	4.275550934e-01f, 9.039892931e-01f, 4.052413140e-01f, 9.142097557e-01f,
+	3.826834324e-01f, 9.238795325e-01f, 3.598950365e-01f, 9.329927988e-01f,
+	3.368898534e-01f, 9.415440652e-01f, 3.136817404e-01f, 9.495281806e-01f,
+	2.902846773e-01f, 9.569403357e-01f, 2.667127575e-01f, 9.637760658e-01f,
+	2.429801799e-01f, 9.700312532e-01f, 2.191012402e-01f, 9.757021300e-01f,
+	1.950903220e-01f, 9.807852804e-01f, 1.709618888e-01f, 9.852776424e-01f,
+	1.467304745e-01f, 9.891765100e-01f, 1.224106752e-01f, 9.924795346e-01f,
+	9.801714033e-02f, 9.951847267e-01f, 7.356456360e-02f, 9.972904567e-01f,
+	4.906767433e-02f, 9.987954562e-01f, 2.454122852e-02f, 9.996988187e-01f,
+	6.123233996e-17f, 1.000000000e+00f, -2.454122852e-02f, 9.996988187e-01f,
+	-4.906767433e-02f, 9.987954562e-01f, -7.356456360e-02f, 9.972904567e-01f,
+	-9.801714033e-02f, 9.951847267e-01f, -1.224106752e-01f, 9.924795346e-01f,
+	-1.467304745e-01f, 9.891765100e-01f, -1.709618888e-01f, 9.852776424e-01f,
+	-1.950903220e-01f, 9.807852804e-01f, -2.191012402e-01f, 9.757021300e-01f,
+	-2.429801799e-01f, 9.700312532e-01f, -2.667127575e-01f, 9.637760658e-01f,
+	-2.902846773e-01f, 9.569403357e-01f, -3.136817404e-01f, 9.495281806e-01f,
+	-3.368898534e-01f, 9.415440652e-01f, -3.598950365e-01f, 9.329927988e-01f,
+	-3.826834324e-01f, 9.238795325e-01f, -4.052413140e-01f, 9.142097557e-01f,
+	-4.275550934e-01f, 9.039892931e-01f, -4.496113297e-01f, 8.932243012e-01f,
+	-4.713967368e-01f, 8.819212643e-01f, -4.928981922e-01f, 8.700869911e-01f,
+	-5.141027442e-01f, 8.577286100e-01f, -5.349976199e-01f, 8.448535652e-01f,
+	-5.555702330e-01f, 8.314696123e-01f, -5.758081914e-01f, 8.175848132e-01f,
+	-5.956993045e-01f, 8.032075315e-01f, -6.152315906e-01f, 7.883464276e-01f,
+	-6.343932842e-01f, 7.730104534e-01f, -6.531728430e-01f, 7.572088465e-01f,
+	-6.715589548e-01f, 7.409511254e-01f, -6.895405447e-01f, 7.242470830e-01f,
+	-7.071067812e-01f, 7.071067812e-01f, -7.242470830e-01f, 6.895405447e-01f,
+	-7.409511254e-01f, 6.715589548e-01f, -7.572088465e-01f, 6.531728430e-01f,
+	-7.730104534e-01f, 6.343932842e-01f, -7.883464276e-01f, 6.152315906e-01f,
+	-8.032075315e-01f, 5.956993045e-01f, -8.175848132e-01f, 5.758081914e-01f,
+	-8.314696123e-01f, 5.555702330e-01f, -8.448535652e-01f, 5.349976199e-01f,
+	-8.577286100e-01f, 5.141027442e-01f, -8.700869911e-01f, 4.928981922e-01f,
+	-8.819212643e-01f, 4.713967368e-01f, -8.932243012e-01f, 4.496113297e-01f,
+	-9.039892931e-01f, 4.275550934e-01f, -9.142097557e-01f, 4.052413140e-01f,
+	-9.238795325e-01f, 3.826834324e-01f, -9.329927988e-01f, 3.598950365e-01f,
+	-9.415440652e-01f, 3.368898534e-01f, -9.495281806e-01f, 3.136817404e-01f,
+	-9.569403357e-01f, 2.902846773e-01f, -9.637760658e-01f, 2.667127575e-01f,
+	-9.700312532e-01f, 2.429801799e-01f, -9.757021300e-01f, 2.191012402e-01f,
+	-9.807852804e-01f, 1.950903220e-01f, -9.852776424e-01f, 1.709618888e-01f,
+	-9.891765100e-01f, 1.467304745e-01f, -9.924795346e-01f, 1.224106752e-01f,
+	-9.951847267e-01f, 9.801714033e-02f, -9.972904567e-01f, 7.356456360e-02f,
+	-9.987954562e-01f, 4.906767433e-02f, -9.996988187e-01f, 2.454122852e-02f,
+	-1.000000000e+00f, 1.224646799e-16f, -9.996988187e-01f, -2.454122852e-02f,
+	-9.987954562e-01f, -4.906767433e-02f, -9.972904567e-01f, -7.356456360e-02f,
+	-9.951847267e-01f, -9.801714033e-02f, -9.924795346e-01f, -1.224106752e-01f,
+	-9.891765100e-01f, -1.467304745e-01f, -9.852776424e-01f, -1.709618888e-01f,
+	-9.807852804e-01f, -1.950903220e-01f, -9.757021300e-01f, -2.191012402e-01f,
+	-9.700312532e-01f, -2.429801799e-01f, -9.637760658e-01f, -2.667127575e-01f,
+	-9.569403357e-01f, -2.902846773e-01f, -9.495281806e-01f, -3.136817404e-01f,
+	-9.415440652e-01f, -3.368898534e-01f, -9.329927988e-01f, -3.598950365e-01f,
+	-9.238795325e-01f, -3.826834324e-01f, -9.142097557e-01f, -4.052413140e-01f,
+	-9.039892931e-01f, -4.275550934e-01f, -8.932243012e-01f, -4.496113297e-01f,
+	-8.819212643e-01f, -4.713967368e-01f, -8.700869911e-01f, -4.928981922e-01f,
+	-8.577286100e-01f, -5.141027442e-01f, -8.448535652e-01f, -5.349976199e-01f,
+	-8.314696123e-01f, -5.555702330e-01f, -8.175848132e-01f, -5.758081914e-01f,
+	-8.032075315e-01f, -5.956993045e-01f, -7.883464276e-01f, -6.152315906e-01f,
+	-7.730104534e-01f, -6.343932842e-01f, -7.572088465e-01f, -6.531728430e-01f,
+	-7.409511254e-01f, -6.715589548e-01f, -7.242470830e-01f, -6.895405447e-01f,
+	-7.071067812e-01f, -7.071067812e-01f, -6.895405447e-01f, -7.242470830e-01f,
+	-6.715589548e-01f, -7.409511254e-01f, -6.531728430e-01f, -7.572088465e-01f,
+	-6.343932842e-01f, -7.730104534e-01f, -6.152315906e-01f, -7.883464276e-01f,
+	-5.956993045e-01f, -8.032075315e-01f, -5.758081914e-01f, -8.175848132e-01f,
+	-5.555702330e-01f, -8.314696123e-01f, -5.349976199e-01f, -8.448535652e-01f,
+	-5.141027442e-01f, -8.577286100e-01f, -4.928981922e-01f, -8.700869911e-01f,
+	-4.713967368e-01f, -8.819212643e-01f, -4.496113297e-01f, -8.932243012e-01f,
+	-4.275550934e-01f, -9.039892931e-01f, -4.052413140e-01f, -9.142097557e-01f,
+	-3.826834324e-01f, -9.238795325e-01f, -3.598950365e-01f, -9.329927988e-01f,
+	-3.368898534e-01f, -9.415440652e-01f, -3.136817404e-01f, -9.495281806e-01f,
+	-2.902846773e-01f, -9.569403357e-01f, -2.667127575e-01f, -9.637760658e-01f,
+	-2.429801799e-01f, -9.700312532e-01f, -2.191012402e-01f, -9.757021300e-01f,
+	-1.950903220e-01f, -9.807852804e-01f, -1.709618888e-01f, -9.852776424e-01f,
+	-1.467304745e-01f, -9.891765100e-01f, -1.224106752e-01f, -9.924795346e-01f,
+	-9.801714033e-02f, -9.951847267e-01f, -7.356456360e-02f, -9.972904567e-01f,
+	-4.906767433e-02f, -9.987954562e-01f, -2.454122852e-02f, -9.996988187e-01f,
+	-1.836970199e-16f, -1.000000000e+00f, 2.454122852e-02f, -9.996988187e-01f,
+	4.906767433e-02f, -9.987954562e-01f, 7.356456360e-02f, -9.972904567e-01f,
+	9.801714033e-02f, -9.951847267e-01f, 1.224106752e-01f, -9.924795346e-01f,
+	1.467304745e-01f, -9.891765100e-01f, 1.709618888e-01f, -9.852776424e-01f,
+	1.950903220e-01f, -9.807852804e-01f, 2.191012402e-01f, -9.757021300e-01f,
+	2.429801799e-01f, -9.700312532e-01f, 2.667127575e-01f, -9.637760658e-01f,
+	2.902846773e-01f, -9.569403357e-01f, 3.136817404e-01f, -9.495281806e-01f,
+	3.368898534e-01f, -9.415440652e-01f, 3.598950365e-01f, -9.329927988e-01f,
+	3.826834324e-01f, -9.238795325e-01f, 4.052413140e-01f, -9.142097557e-01f,
+	4.275550934e-01f, -9.039892931e-01f, 4.496113297e-01f, -8.932243012e-01f,
+	4.713967368e-01f, -8.819212643e-01f, 4.928981922e-01f, -8.700869911e-01f,
+	5.141027442e-01f, -8.577286100e-01f, 5.349976199e-01f, -8.448535652e-01f,
+	5.555702330e-01f, -8.314696123e-01f, 5.758081914e-01f, -8.175848132e-01f,
+	5.956993045e-01f, -8.032075315e-01f, 6.152315906e-01f, -7.883464276e-01f,
+	6.343932842e-01f, -7.730104534e-01f, 6.531728430e-01f, -7.572088465e-01f,
+	6.715589548e-01f, -7.409511254e-01f, 6.895405447e-01f, -7.242470830e-01f,
+	7.071067812e-01f, -7.071067812e-01f, 7.242470830e-01f, -6.895405447e-01f,
+	7.409511254e-01f, -6.715589548e-01f, 7.572088465e-01f, -6.531728430e-01f,
+	7.730104534e-01f, -6.343932842e-01f, 7.883464276e-01f, -6.152315906e-01f,
+	8.032075315e-01f, -5.956993045e-01f, 8.175848132e-01f, -5.758081914e-01f,
+	8.314696123e-01f, -5.555702330e-01f, 8.448535652e-01f, -5.349976199e-01f,
+	8.577286100e-01f, -5.141027442e-01f, 8.700869911e-01f, -4.928981922e-01f,
+	8.819212643e-01f, -4.713967368e-01f, 8.932243012e-01f, -4.496113297e-01f,
+	9.039892931e-01f, -4.275550934e-01f, 9.142097557e-01f, -4.052413140e-01f,
+	9.238795325e-01f, -3.826834324e-01f, 9.329927988e-01f, -3.598950365e-01f,
+	9.415440652e-01f, -3.368898534e-01f, 9.495281806e-01f, -3.136817404e-01f,
+	9.569403357e-01f, -2.902846773e-01f, 9.637760658e-01f, -2.667127575e-01f,
+	9.700312532e-01f, -2.429801799e-01f, 9.757021300e-01f, -2.191012402e-01f,
+	9.807852804e-01f, -1.950903220e-01f, 9.852776424e-01f, -1.709618888e-01f,
+	9.891765100e-01f, -1.467304745e-01f, 9.924795346e-01f, -1.224106752e-01f,
+	9.951847267e-01f, -9.801714033e-02f, 9.972904567e-01f, -7.356456360e-02f,
+	9.987954562e-01f, -4.906767433e-02f, 9.996988187e-01f, -2.454122852e-02f,
+};
+
+#pragma DATA_SECTION(fftTwiddleRfft512, ".const:fftTwiddleRfft512")
+const float32_t fftTwiddleRfft512[512] =
+{
+	0.000000000e+00f, 1.000000000e+00f, 1.227153829e-02f, 9.999247018e-01f,
+	2.454122852e-02f, 9.996988187e-01f, 3.680722294e-02f, 9.993223846e-01f,
+	4.906767433e-02f, 9.987954562e-01f, 6.132073630e-02f, 9.981181129e-01f,
+	7.356456360e-02f, 9.972904567e-01f, 8.579731234e-02f, 9.963126122e-01f,
+	9.801714033e-02f, 9.951847267e-01f, 1.102222073e-01f, 9.939069700e-01f,
+	1.224106752e-01f, 9.924795346e-01f, 1.345807085e-01f, 9.909026354e-01f,
+	1.467304745e-01f, 9.891765100e-01f, 1.588581433e-01f, 9.873014182e-01f,
+	1.709618888e-01f, 9.852776424e-01f, 1.830398880e-01f, 9.831054874e-01f,
+	1.950903220e-01f, 9.807852804e-01f, 2.071113762e-01f, 9.783173707e-01f,
+	2.191012402e-01f, 9.757021300e-01f, 2.310581083e-01f, 9.729399522e-01f,
+	2.429801799e-01f, 9.700312532e-01f, 2.548656596e-01f, 9.669764710e-01f,
+	2.667127575e-01f, 9.637760658e-01f, 2.785196894e-01f, 9.604305194e-01f,
+	2.902846773e-01f, 9.569403357e-01f, 3.020059493e-01f, 9.533060404e-01f,
+	3.136817404e-01f, 9.495281806e-01f, 3.253102922e-01f, 9.456073254e-01f,
+	3.368898534e-01f, 9.415440652e-01f, 3.484186802e-01f, 9.373390119e-01f,
+	3.598950365e-01f, 9.329927988e-01f, 3.713171940e-01f, 9.285060805e-01f,
+	3.826834324e-01f, 9.238795325e-01f, 3.939920401e-01f, 9.191138517e-01f,
+	4.052413140e-01f, 9.142097557e-01f, 4.164295601e-01f, 9.091679831e-01f,
+	4.275550934e-01f, 9.039892931e-01f, 4.386162385e-01f, 8.986744657e-01f,
+	4.496113297e-01f, 8.932243012e-01f, 4.605387110e-01f, 8.876396204e-01f,
+	4.713967368e-01f, 8.819212643e-01f, 4.821837721e-01f, 8.760700942e-01f,
+	4.928981922e-01f, 8.700869911e-01f, 5.035383837e-01f, 8.639728561e-01f,
+	5.141027442e-01f, 8.577286100e-01f, 5.245896827e-01f, 8.513551931e-01f,
+	5.349976199e-01f, 8.448535652e-01f, 5.453249884e-01f, 8.382247056e-01f,
+	5.555702330e-01f, 8.314696123e-01f, 5.657318108e-01f, 8.245893028e-01f,
+	5.758081914e-01f, 8.175848132e-01f, 5.857978575e-01f, 8.104571983e-01f,
+	5.956993045e-01f, 8.032075315e-01f, 6.055110414e-01f, 7.958369046e-01f,
+	6.152315906e-01f, 7.883464276e-01f, 6.248594881e-01f, 7.807372286e-01f,
+	6.343932842e-01f, 7.730104534e-01f, 6.438315429e-01f, 7.651672656e-01f,
+	6.531728430e-01f, 7.572088465e-01f, 6.624157776e-01f, 7.491363945e-01f,
+	6.715589548e-01f, 7.409511254e-01f, 6.806009978e-01f, 7.326542717e-01f,
+	6.895405447e-01f, 7.242470830e-01f, 6.983762494e-01f, 7.157308253e-01f,
+	7.071067812e-01f, 7.071067812e-01f, 7.157308253e-01f, 6.983762494e-01f,
+	7.242470830e-01f, 6.895405447e-01f, 7.326542717e-01f, 6.806009978e-01f,
+	7.409511254e-01f, 6.715589548e-01f, 7.491363945e-01f, 6.624157776e-01f,
+	7.572088465e-01f, 6.531728430e-01f, 7.651672656e-01f, 6.438315429e-01f,
+	7.730104534e-01f, 6.343932842e-01f, 7.807372286e-01f, 6.248594881e-01f,
+	7.883464276e-01f, 6.152315906e-01f, 7.958369046e-01f, 6.055110414e-01f,
+	8.032075315e-01f, 5.956993045e-01f, 8.104571983e-01f, 5.857978575e-01f,
+	8.175848132e-01f, 5.758081914e-01f, 8.245893028e-01f, 5.657318108e-01f,
+	8.314696123e-01f, 5.555702330e-01f, 8.382247056e-01f, 5.453249884e-01f,
+	8.448535652e-01f, 5.349976199e-01f, 8.513551931e-01f, 5.245896827e-01f,
+	8.577286100e-01f, 5.141027442e-01f, 8.639728561e-01f, 5.035383837e-01f,
+	8.700869911e-01f, 4.928981922e-01f, 8.760700942e-01f, 4.821837721e-01f,
+	8.819212643e-01f, 4.713967368e-01f, 8.876396204e-01f, 4.605387110e-01f,
+	8.932243012e-01f, 4.496113297e-01f, 8.986744657e-01f, 4.386162385e-01f,
+	9.039892931e-01f, 4.275550934e-01f, 9.091679831e-01f, 4.164295601e-01f,
+	9.142097557e-01f, 4.052413140e-01f, 9.191138517e-01f, 3.939920401e-01f,
+	9.238795325e-01f, 3.826834324e-01f, 9.285060805e-01f, 3.713171940e-01f,
+	9.329927988e-01f, 3.598950365e-01f, 9.373390119e-01f, 3.484186802e-01f,
+	9.415440652e-01f, 3.368898534e-01f, 9.456073254e-01f, 3.253102922e-01f,
+	9.495281806e-01f, 3.136817404e-01f, 9.533060404e-01f, 3.020059493e-01f,
+	9.569403357e-01f, 2.902846773e-01f, 9.604305194e-01f, 2.785196894e-01f,
+	9.637760658e-01f, 2.667127575e-01f, 9.669764710e-01f, 2.548656596e-01f,
+	9.700312532e-01f, 2.429801799e-01f, 9.729399522e-01f, 2.310581083e-01f,
+	9.757021300e-01f, 2.191012402e-01f, 9.783173707e-01f, 2.071113762e-01f,
+	9.807852804e-01f, 1.950903220e-01f, 9.831054874e-01f, 1.830398880e-01f,
+	9.852776424e-01f, 1.709618888e-01f, 9.873014182e-01f, 1.588581433e-01f,
+	9.891765100e-01f, 1.467304745e-01f, 9.909026354e-01f, 1.345807085e-01f,
+	9.924795346e-01f, 1.224106752e-01f, 9.939069700e-01f, 1.102222073e-01f,
+	9.951847267e-01f, 9.801714033e-02f, 9.963126122e-01f, 8.579731234e-02f,
+	9.972904567e-01f, 7.356456360e-02f, 9.981181129e-01f, 6.132073630e-02f,
+	9.987954562e-01f, 4.906767433e-02f, 9.993223846e-01f, 3.680722294e-02f,
+	9.996988187e-01f, 2.454122852e-02f, 9.999247018e-01f, 1.227153829e-02f,
+	1.000000000e+00f, 6.123233996e-17f, 9.999247018e-01f, -1.227153829e-02f,
+	9.996988187e-01f, -2.454122852e-02f, 9.993223846e-01f, -3.680722294e-02f,
+	9.987954562e-01f, -4.906767433e-02f, 9.981181129e-01f, -6.132073630e-02f,
+	9.972904567e-01f, -7.356456360e-02f, 9.963126122e-01f, -8.579731234e-02f,
+	9.951847267e-01f, -9.801714033e-02f, 9.939069700e-01f, -1.102222073e-01f,
+	9.924795346e-01f, -1.224106752e-01f, 9.909026354e-01f, -1.345807085e-01f,
+	9.891765100e-01f, -1.467304745e-01f, 9.873014182e-01f, -1.588581433e-01f,
+	9.852776424e-01f, -1.709618888e-01f, 9.831054874e-01f, -1.830398880e-01f,
+	9.807852804e-01f, -1.950903220e-01f, 9.783173707e-01f, -2.071113762e-01f,
+	9.757021300e-01f, -2.191012402e-01f, 9.729399522e-01f, -2.310581083e-01f,
+	9.700312532e-01f, -2.429801799e-01f, 9.669764710e-01f, -2.548656596e-01f,
+	9.637760658e-01f, -2.667127575e-01f, 9.604305194e-01f, -2.785196894e-01f,
+	9.569403357e-01f, -2.902846773e-01f, 9.533060404e-01f, -3.020059493e-01f,
+	9.495281806e-01f, -3.136817404e-01f, 9.456073254e-01f, -3.253102922e-01f,
+	9.415440652e-01f, -3.368898534e-01f, 9.373390119e-01f, -3.484186802e-01f,
+	9.329927988e-01f, -3.598950365e-01f, 9.285060805e-01f, -3.713171940e-01f,
+	9.238795325e-01f, -3.826834324e-01f, 9.191138517e-01f, -3.939920401e-01f,
+	9.142097557e-01f, -4.052413140e-01f, 9.091679831e-01f, -4.164295601e-01f,
+	9.039892931e-01f, -4.275550934e-01f, 8.986744657e-01f, -4.386162385e-01f,
+	8.932243012e-01f, -4.496113297e-01f, 8.876396204e-01f, -4.605387110e-01f,
+	8.819212643e-01f, -4.713967368e-01f, 8.760700942e-01f, -4.821837721e-01f,
+	8.700869911e-01f, -4.928981922e-01f, 8.639728561e-01f, -5.035383837e-01f,
+	8.577286100e-01f, -5.141027442e-01f, 8.513551931e-01f, -5.245896827e-01f,
+	8.448535652e-01f, -5.349976199e-01f, 8.382247056e-01f, -5.453249884e-01f,
+	8.314696123e-01f, -5.555702330e-01f, 8.245893028e-01f, -5.657318108e-01f,
+	8.175848132e-01f, -5.758081914e-01f, 8.104571983e-01f, -5.857978575e-01f,
+	8.032075315e-01f, -5.956993045e-01f, 7.958369046e-01f, -6.055110414e-01f,
+	7.883464276e-01f, -6.152315906e-01f, 7.807372286e-01f, -6.248594881e-01f,
+	7.730104534e-01f, -6.343932842e-01f, 7.651672656e-01f, -6.438315429e-01f,
+	7.572088465e-01f, -6.531728430e-01f, 7.491363945e-01f, -6.624157776e-01f,
+	7.409511254e-01f, -6.715589548e-01f, 7.326542717e-01f, -6.806009978e-01f,
+	7.242470830e-01f, -6.895405447e-01f, 7.157308253e-01f, -6.983762494e-01f,
+	7.071067812e-01f, -7.071067812e-01f, 6.983762494e-01f, -7.157308253e-01f,
+	6.895405447e-01f, -7.242470830e-01f, 6.806009978e-01f, -7.326542717e-01f,
+	6.715589548e-01f, -7.409511254e-01f, 6.624157776e-01f, -7.491363945e-01f,
+	6.531728430e-01f, -7.572088465e-01f, 6.438315429e-01f, -7.651672656e-01f,
+	6.343932842e-01f, -7.730104534e-01f, 6.248594881e-01f, -7.807372286e-01f,
+	6.152315906e-01f, -7.883464276e-01f, 6.055110414e-01f, -7.958369046e-01f,
+	5.956993045e-01f, -8.032075315e-01f, 5.857978575e-01f, -8.104571983e-01f,
+	5.758081914e-01f, -8.175848132e-01f, 5.657318108e-01f, -8.245893028e-01f,
+	5.555702330e-01f, -8.314696123e-01f, 5.453249884e-01f, -8.382247056e-01f,
+	5.349976199e-01f, -8.448535652e-01f, 5.245896827e-01f, -8.513551931e-01f,
+	5.141027442e-01f, -8.577286100e-01f, 5.035383837e-01f, -8.639728561e-01f,
+	4.928981922e-01f, -8.700869911e-01f, 4.821837721e-01f, -8.760700942e-01f,
+	4.713967368e-01f, -8.819212643e-01f, 4.605387110e-01f, -8.876396204e-01f,
+	4.496113297e-01f, -8.932243012e-01f, 4.386162385e-01f, -8.986744657e-01f,
+	4.275550934e-01f, -9.039892931e-01f, 4.164295601e-01f, -9.091679831e-01f,
+	4.052413140e-01f, -9.142097557e-01f, 3.939920401e-01f, -9.191138517e-01f,
+	3.826834324e-01f, -9.238795325e-01f, 3.713171940e-01f, -9.285060805e-01f,
+	3.598950365e-01f, -9.329927988e-01f, 3.484186802e-01f, -9.373390119e-01f,
+	3.368898534e-01f, -9.415440652e-01f, 3.253102922e-01f, -9.456073254e-01f,
+	3.136817404e-01f, -9.495281806e-01f, 3.020059493e-01f, -9.533060404e-01f,
+	2.902846773e-01f, -9.569403357e-01f, 2.785196894e-01f, -9.604305194e-01f,
+	2.667127575e-01f, -9.637760658e-01f, 2.548656596e-01f, -9.669764710e-01f,
+	2.429801799e-01f, -9.700312532e-01f, 2.310581083e-01f, -9.729399522e-01f,
+	2.191012402e-01f, -9.757021300e-01f, 2.071113762e-01f, -9.783173707e-01f,
+	1.950903220e-01f, -9.807852804e-01f, 1.830398880e-01f, -9.831054874e-01f,
+	1.709618888e-01f, -9.852776424e-01f, 1.588581433e-01f, -9.873014182e-01f,
+	1.467304745e-01f, -9.891765100e-01f, 1.345807085e-01f, -9.909026354e-01f,
+	1.224106752e-01f, -9.924795346e-01f, 1.102222073e-01f, -9.939069700e-01f,
+	9.801714033e-02f, -9.951847267e-01f, 8.579731234e-02f, -9.963126122e-01f,
+	7.356456360e-02f, -9.972904567e-01f, 6.132073630e-02f, -9.981181129e-01f,
+	4.906767433e-02f, -9.987954562e-01f, 3.680722294e-02f, -9.993223846e-01f,
+	2.454122852e-02f, -9.996988187e-01f, 1.227153829e-02f, -9.999247018e-01f,
+};
+
+#pragma DATA_SECTION(fftWindowHann512, ".const:fftWindowHann512")
+const float32_t fftWindowHann512[512] =
+{
+	0.000000000e+00f, 3.764908043e-05f, 1.505906519e-04f, 3.388077058e-04f,
+	6.022718974e-04f, 9.409435499e-04f, 1.354771661e-03f, 1.843693909e-03f,
+	2.407636664e-03f, 3.046514999e-03f, 3.760232701e-03f, 4.548682286e-03f,
+	5.411745018e-03f, 6.349290921e-03f, 7.361178806e-03f, 8.447256284e-03f,
+	9.607359798e-03f, 1.084131464e-02f, 1.214893498e-02f, 1.353002390e-02f,
+	1.498437340e-02f, 1.651176448e-02f, 1.811196710e-02f, 1.978474029e-02f,
+	2.152983213e-02f, 2.334697982e-02f, 2.523590970e-02f, 2.719633731e-02f,
+	2.922796741e-02f, 3.133049404e-02f, 3.350360058e-02f, 3.574695976e-02f,
+	3.806023374e-02f, 4.044307415e-02f, 4.289512215e-02f, 4.541600845e-02f,
+	4.800535344e-02f, 5.066276715e-02f, 5.338784940e-02f, 5.618018980e-02f,
+	5.903936783e-02f, 6.196495290e-02f, 6.495650445e-02f, 6.801357194e-02f,
+	7.113569500e-02f, 7.432240345e-02f, 7.757321738e-02f, 8.088764722e-02f,
+	8.426519385e-02f, 8.770534861e-02f, 9.120759342e-02f, 9.477140087e-02f,
+	9.839623426e-02f, 1.020815477e-01f, 1.058267862e-01f, 1.096313857e-01f,
+	1.134947733e-01f, 1.174163672e-01f, 1.213955767e-01f, 1.254318027e-01f,
+	1.295244373e-01f, 1.336728642e-01f, 1.378764585e-01f, 1.421345874e-01f,
+	1.464466094e-01f, 1.508118753e-01f, 1.552297276e-01f, 1.596995011e-01f,
+	1.642205226e-01f, 1.687921112e-01f, 1.734135785e-01f, 1.780842286e-01f,
+	1.828033579e-01f, 1.875702559e-01f, 1.923842047e-01f, 1.972444793e-01f,
+	2.021503478e-01f, 2.071010713e-01f, 2.120959043e-01f, 2.171340946e-01f,
+	2.222148835e-01f, 2.273375058e-01f, 2.325011901e-01f, 2.377051587e-01f,
+	2.429486279e-01f, 2.482308081e-01f, 2.535509039e-01f, 2.589081140e-01f,
+	2.643016316e-01f, 2.697306445e-01f, 2.751943352e-01f, 2.806918807e-01f,
+	2.862224533e-01f, 2.917852200e-01f, 2.973793430e-01f, 3.030039800e-01f,
+	3.086582838e-01f, 3.143414030e-01f, 3.200524817e-01f, 3.257906599e-01f,
+	3.315550733e-01f, 3.373448539e-01f, 3.431591298e-01f, 3.489970253e-01f,
+	3.548576614e-01f, 3.607401553e-01f, 3.666436213e-01f, 3.725671702e-01f,
+	3.785099100e-01f, 3.844709459e-01f, 3.904493799e-01f, 3.964443119e-01f,
+	4.024548390e-01f, 4.084800560e-01f, 4.145190556e-01f, 4.205709283e-01f,
+	4.266347628e-01f, 4.327096457e-01f, 4.387946624e-01f, 4.448888964e-01f,
+	4.509914298e-01f, 4.571013438e-01f, 4.632177182e-01f, 4.693396318e-01f,
+	4.754661628e-01f, 4.815963885e-01f, 4.877293857e-01f, 4.938642309e-01f,
+	5.000000000e-01f, 5.061357691e-01f, 5.122706143e-01f, 5.184036115e-01f,
+	5.245338372e-01f, 5.306603682e-01f, 5.367822818e-01f, 5.428986562e-01f,
+	5.490085702e-01f, 5.551111036e-01f, 5.612053376e-01f, 5.672903543e-01f,
+	5.733652372e-01f, 5.794290717e-01f, 5.854809444e-01f, 5.915199440e-01f,
+	5.975451610e-01f, 6.035556881e-01f, 6.095506201e-01f, 6.155290541e-01f,
+	6.214900900e-01f, 6.274328298e-01f, 6.333563787e-01f, 6.392598447e-01f,
+	6.451423386e-01f, 6.510029747e-01f, 6.568408702e-01f, 6.626551461e-01f,
+	6.684449267e-01f, 6.742093401e-01f, 6.799475183e-01f, 6.856585970e-01f,
+	6.913417162e-01f, 6.969960200e-01f, 7.026206570e-01f, 7.082147800e-01f,
+	7.137775467e-01f, 7.193081193e-01f, 7.248056648e-01f, 7.302693555e-01f,
+	7.356983684e-01f, 7.410918860e-01f, 7.464490961e-01f, 7.517691919e-01f,
+	7.570513721e-01f, 7.622948413e-01f, 7.674988099e-01f, 7.726624942e-01f,
+	7.777851165e-01f, 7.828659054e-01f, 7.879040957e-01f, 7.928989287e-01f,
+	7.978496522e-01f, 8.027555207e-01f, 8.076157953e-01f, 8.124297441e-01f,
+	8.171966421e-01f, 8.219157714e-01f, 8.265864215e-01f, 8.312078888e-01f,
+	8.357794774e-01f, 8.403004989e-01f, 8.447702724e-01f, 8.491881247e-01f,
+	8.535533906e-01f, 8.578654126e-01f, 8.621235415e-01f, 8.663271358e-01f,
+	8.704755627e-01f, 8.745681973e-01f, 8.786044233e-01f, 8.825836328e-01f,
+	8.865052267e-01f, 8.903686143e-01f, 8.941732138e-01f, 8.979184523e-01f,
+	9.016037657e-01f, 9.052285991e-01f, 9.087924066e-01f, 9.122946514e-01f,
+	9.157348062e-01f, 9.191123528e-01f, 9.224267826e-01f, 9.256775966e-01f,
+	9.288643050e-01f, 9.319864281e-01f, 9.350434956e-01f, 9.380350471e-01f,
+	9.409606322e-01f, 9.438198102e-01f, 9.466121506e-01f, 9.493372328e-01f,
+	9.519946466e-01f, 9.545839915e-01f, 9.571048779e-01f, 9.595569258e-01f,
+	9.619397663e-01f, 9.642530402e-01f, 9.664963994e-01f, 9.686695060e-01f,
+	9.707720326e-01f, 9.728036627e-01f, 9.747640903e-01f, 9.766530202e-01f,
+	9.784701679e-01f, 9.802152597e-01f, 9.818880329e-01f, 9.834882355e-01f,
+	9.850156266e-01f, 9.864699761e-01f, 9.878510650e-01f, 9.891586854e-01f,
+	9.903926402e-01f, 9.915527437e-01f, 9.926388212e-01f, 9.936507091e-01f,
+	9.945882550e-01f, 9.954513177e-01f, 9.962397673e-01f, 9.969534850e-01f,
+	9.975923633e-01f, 9.981563061e-01f, 9.986452283e-01f, 9.990590565e-01f,
+	9.993977281e-01f, 9.996611923e-01f, 9.998494093e-01f, 9.999623509e-01f,
+	1.000000000e+00f, 9.999623509e-01f, 9.998494093e-01f, 9.996611923e-01f,
+	9.993977281e-01f, 9.990590565e-01f, 9.986452283e-01f, 9.981563061e-01f,
+	9.975923633e-01f, 9.969534850e-01f, 9.962397673e-01f, 9.954513177e-01f,
+	9.945882550e-01f, 9.936507091e-01f, 9.926388212e-01f, 9.915527437e-01f,
+	9.903926402e-01f, 9.891586854e-01f, 9.878510650e-01f, 9.864699761e-01f,
+	9.850156266e-01f, 9.834882355e-01f, 9.818880329e-01f, 9.802152597e-01f,
+	9.784701679e-01f, 9.766530202e-01f, 9.747640903e-01f, 9.728036627e-01f,
+	9.707720326e-01f, 9.686695060e-01f, 9.664963994e-01f, 9.642530402e-01f,
+	9.619397663e-01f, 9.595569258e-01f, 9.571048779e-01f, 9.545839915e-01f,
+	9.519946466e-01f, 9.493372328e-01f, 9.466121506e-01f, 9.438198102e-01f,
+	9.409606322e-01f, 9.380350471e-01f, 9.350434956e-01f, 9.319864281e-01f,
+	9.288643050e-01f, 9.256775966e-01f, 9.224267826e-01f, 9.191123528e-01f,
+	9.157348062e-01f, 9.122946514e-01f, 9.087924066e-01f, 9.052285991e-01f,
+	9.016037657e-01f, 8.979184523e-01f, 8.941732138e-01f, 8.903686143e-01f,
+	8.865052267e-01f, 8.825836328e-01f, 8.786044233e-01f, 8.745681973e-01f,
+	8.704755627e-01f, 8.663271358e-01f, 8.621235415e-01f, 8.578654126e-01f,
+	8.535533906e-01f, 8.491881247e-01f, 8.447702724e-01f, 8.403004989e-01f,
+	8.357794774e-01f, 8.312078888e-01f, 8.265864215e-01f, 8.219157714e-01f,
+	8.171966421e-01f, 8.124297441e-01f, 8.076157953e-01f, 8.027555207e-01f,
+	7.978496522e-01f, 7.928989287e-01f, 7.879040957e-01f, 7.828659054e-01f,
+	7.777851165e-01f, 7.726624942e-01f, 7.674988099e-01f, 7.622948413e-01f,
+	7.570513721e-01f, 7.517691919e-01f, 7.464490961e-01f, 7.410918860e-01f,
+	7.356983684e-01f, 7.302693555e-01f, 7.248056648e-01f, 7.193081193e-01f,
+	7.137775467e-01f, 7.082147800e-01f, 7.026206570e-01f, 6.969960200e-01f,
+	6.913417162e-01f, 6.856585970e-01f, 6.799475183e-01f, 6.742093401e-01f,
+	6.684449267e-01f, 6.626551461e-01f, 6.568408702e-01f, 6.510029747e-01f,
+	6.451423386e-01f, 6.392598447e-01f, 6.333563787e-01f, 6.274328298e-01f,
+	6.214900900e-01f, 6.155290541e-01f, 6.095506201e-01f, 6.035556881e-01f,
+	5.975451610e-01f, 5.915199440e-01f, 5.854809444e-01f, 5.794290717e-01f,
+	5.733652372e-01f, 5.672903543e-01f, 5.612053376e-01f, 5.551111036e-01f,
+	5.490085702e-01f, 5.428986562e-01f, 5.367822818e-01f, 5.306603682e-01f,
+	5.245338372e-01f, 5.184036115e-01f, 5.122706143e-01f, 5.061357691e-01f,
+	5.000000000e-01f, 4.938642309e-01f, 4.877293857e-01f, 4.815963885e-01f,
+	4.754661628e-01f, 4.693396318e-01f, 4.632177182e-01f, 4.571013438e-01f,
+	4.509914298e-01f, 4.448888964e-01f, 4.387946624e-01f, 4.327096457e-01f,
+	4.266347628e-01f, 4.205709283e-01f, 4.145190556e-01f, 4.084800560e-01f,
+	4.024548390e-01f, 3.964443119e-01f, 3.904493799e-01f, 3.844709459e-01f,
+	3.785099100e-01f, 3.725671702e-01f, 3.666436213e-01f, 3.607401553e-01f,
+	3.548576614e-01f, 3.489970253e-01f, 3.431591298e-01f, 3.373448539e-01f,
+	3.315550733e-01f, 3.257906599e-01f, 3.200524817e-01f, 3.143414030e-01f,
+	3.086582838e-01f, 3.030039800e-01f, 2.973793430e-01f, 2.917852200e-01f,
+	2.862224533e-01f, 2.806918807e-01f, 2.751943352e-01f, 2.697306445e-01f,
+	2.643016316e-01f, 2.589081140e-01f, 2.535509039e-01f, 2.482308081e-01f,
+	2.429486279e-01f, 2.377051587e-01f, 2.325011901e-01f, 2.273375058e-01f,
+	2.222148835e-01f, 2.171340946e-01f, 2.120959043e-01f, 2.071010713e-01f,
+	2.021503478e-01f, 1.972444793e-01f, 1.923842047e-01f, 1.875702559e-01f,
+	1.828033579e-01f, 1.780842286e-01f, 1.734135785e-01f, 1.687921112e-01f,
+	1.642205226e-01f, 1.596995011e-01f, 1.552297276e-01f, 1.508118753e-01f,
+	1.464466094e-01f, 1.421345874e-01f, 1.378764585e-01f, 1.336728642e-01f,
+	1.295244373e-01f, 1.254318027e-01f, 1.213955767e-01f, 1.174163672e-01f,
+	1.134947733e-01f, 1.096313857e-01f, 1.058267862e-01f, 1.020815477e-01f,
+	9.839623426e-02f, 9.477140087e-02f, 9.120759342e-02f, 8.770534861e-02f,
+	8.426519385e-02f, 8.088764722e-02f, 7.757321738e-02f, 7.432240345e-02f,
+	7.113569500e-02f, 6.801357194e-02f, 6.495650445e-02f, 6.196495290e-02f,
+	5.903936783e-02f, 5.618018980e-02f, 5.338784940e-02f, 5.066276715e-02f,
+	4.800535344e-02f, 4.541600845e-02f, 4.289512215e-02f, 4.044307415e-02f,
+	3.806023374e-02f, 3.574695976e-02f, 3.350360058e-02f, 3.133049404e-02f,
+	2.922796741e-02f, 2.719633731e-02f, 2.523590970e-02f, 2.334697982e-02f,
+	2.152983213e-02f, 1.978474029e-02f, 1.811196710e-02f, 1.651176448e-02f,
+	1.498437340e-02f, 1.353002390e-02f, 1.214893498e-02f, 1.084131464e-02f,
+	9.607359798e-03f, 8.447256284e-03f, 7.361178806e-03f, 6.349290921e-03f,
+	5.411745018e-03f, 4.548682286e-03f, 3.760232701e-03f, 3.046514999e-03f,
+	2.407636664e-03f, 1.843693909e-03f, 1.354771661e-03f, 9.409435499e-04f,
+	6.022718974e-04f, 3.388077058e-04f, 1.505906519e-04f, 3.764908043e-05f,
+};
+
+const arm_rfft_fast_instance_f32 fftPlan512 =
+{
+	{ 256, fftTwiddle256, armBitRevIndexTable256, ARMBITREVINDEXTABLE_256_TABLE_LENGTH },
+	512,
+	(float32_t *)fftTwiddleRfft512
+};
+
+#pragma DATA_SECTION(fftTwiddle512, ".const:fftTwiddle512")
+const float32_t fftTwiddle512[1024] =
+{
+	1.000000000e+00f, 0.000000000e+00f, 9.999247018e-01f, 1.227153829e-02f,
+	9.996988187e-01f, 2.454122852e-02f, 9.993223846e-01f, 3.680722294e-02f,
+	9.987954562e-01f, 4.906767433e-02f, 9.981181129e-01f, 6.132073630e-02f,
+	9.972904567e-01f, 7.356456360e-02f, 9.963126122e-01f, 8.579731234e-02f,
+	9.951847267e-01f, 9.801714033e-02f, 9.939069700e-01f, 1.102222073e-01f,
+	9.924795346e-01f, 1.224106752e-01f, 9.909026354e-01f, 1.345807085e-01f,
+	9.891765100e-01f, 1.467304745e-01f, 9.873014182e-01f, 1.588581433e-01f,
+	9.852776424e-01f, 1.709618888e-01f, 9.831054874e-01f, 1.830398880e-01f,
+	9.807852804e-01f, 1.950903220e-01f, 9.783173707e-01f, 2.071113762e-01f,
+	9.757021300e-01f, 2.191012402e-01f, 9.729399522e-01f, 2.310581083e-01f,
+	9.700312532e-01f, 2.429801799e-01f, 9.669764710e-01f, 2.548656596e-01f,
+	9.637760658e-01f, 2.667127575e-01f, 9.604305194e-01f, 2.785196894e-01f,
+	9.569403357e-01f, 2.902846773e-01f, 9.533060404e-01f, 3.020059493e-01f,
+	9.495281806e-01f, 3.136817404e-01f, 9.456073254e-01f, 3.253102922e-01f,
+	9.415440652e-01f, 3.368898534e-01f, 9.373390119e-01f, 3.484186802e-01f,
+	9.329927988e-01f, 3.598950365e-01f, 9.285060805e-01f, 3.713171940e-01f,
+	9.238795325e-01f, 3.826834324e-01f, 9.191138517e-01f, 3.939920401e-01f,
+	9.142097557e-01f, 4.052413140e-01f, 9.091679831e-01f, 4.164295601e-01f,
+	9.039892931e-01f, 4.275550934e-01f, 8.986744657e-01f, 4.386162385e-01f,
+	8.932243012e-01f, 4.496113297e-01f, 8.876396204e-01f, 4.605387110e-01f,
+	8.819212643e-01f, 4.713967368e-01f, 8.760700942e-01f, 4.821837721e-01f,
+	8.700869911e-01f, 4.928981922e-01f, 8.639728561e-01f, 5.035383837e-01f,
+	8.577286100e-01f, 5.141027442e-01f, 8.513551931e-01f, 5.245896827e-01f,
+	8.448535652e-01f, 5.349976199e-01f, 8.382247056e-01f, 5.453249884e-01f,
+	8.314696123e-01f, 5.555702330e-01f, 8.245893028e-01f, 5.657318108e-01f,
+	8.175848132e-01f, 5.758081914e-01f, 8.104571983e-01f, 5.857978575e-01f,
+	8.032075315e-01f, 5.956993045e-01f, 7.958369046e-01f, 6.055110414e-01f,
+	7.883464276e-01f, 6.152315906e-01f, 7.807372286e-01f, 6.248594881e-01f,
+	7.730104534e-01f, 6.343932842e-01f, 7.651672656e-01f, 6.438315429e-01f,
+	7.572088465e-01f, 6.531728430e-01f, 7.491363945e-01f, 6.624157776e-01f,
+	7.409511254e-01f, 6.715589548e-01f, 7.326542717e-01f, 6.806009978e-01f,
+	7.242470830e-01f, 6.895405447e-01f, 7.157308253e-01f, 6.983762494e-01f,
+	7.071067812e-01f, 7.071067812e-01f, 6.983762494e-01f, 7.157308253e-01f,
+	6.895405447e-01f, 7.242470830e-01f, 6.806009978e-01f, 7.326542717e-01f,
+	6.715589548e-01f, 7.409511254e-01f, 6.624157776e-01f, 7.491363945e-01f,
+	6.531728430e-01f, 7.572088465e-01f, 6.438315429e-01f, 7.651672656e-01f,
+	6.343932842e-01f, 7.730104534e-01f, 6.248594881e-01f, 7.807372286e-01f,
+	6.152315906e-01f, 7.883464276e-01f, 6.055110414e-01f, 7.958369046e-01f,
+	5.956993045e-01f, 8.032075315e-01f, 5.857978575e-01f, 8.104571983e-01f,
+	5.758081914e-01f, 8.175848132e-01f, 5.657318108e-01f, 8.245893028e-01f,
+	5.555702330e-01f, 8.314696123e-01f, 5.453249884e-01f, 8.382247056e-01f,
+	5.349976199e-01f, 8.448535652e-01f, 5.245896827e-01f, 8.513551931e-01f,
+	5.141027442e-01f, 8.577286100e-01f, 5.035383837e-01f, 8.639728561e-01f,
+	4.928981922e-01f, 8.700869911e-01f, 4.821837721e-01f, 8.760700942e-01f,
+	4.713967368e-01f, 8.819212643e-01f, 4.605387110e-01f, 8.876396204e-01f,
+	4.496113297e-01f, 8.932243012e-01f, 4.386162385e-01f, 8.986744657e-01f,
+	4.275550934e-01f, 9.039892931e-01f, 4.164295601e-01f, 9.091679831e-01f,
+	4.052413140e-01f, 9.142097557e-01f, 3.939920401e-01f, 9.191138517e-01f,
+	3.826834324e-01f, 9.238795325e-01f, 3.713171940e-01f, 9.285060805e-01f,
+	3.598950365e-01f, 9.329927988e-01f, 3.484186802e-01f, 9.373390119e-01f,
+	3.368898534e-01f, 9.415440652e-01f, 3.253102922e-01f, 9.456073254e-01f,
+	3.136817404e-01f, 9.495281806e-01f, 3.020059493e-01f, 9.533060404e-01f,
+	2.902846773e-01f, 9.569403357e-01f, 2.785196894e-01f, 9.604305194e-01f,
+	2.667127575e-01f, 9.637760658e-01f, 2.548656596e-01f, 9.669764710e-01f,
+	2.429801799e-01f, 9.700312532e-01f, 2.310581083e-01f, 9.729399522e-01f,
+	2.191012402e-01f, 9.757021300e-01f, 2.071113762e-01f, 9.783173707e-01f,
+	1.950903220e-01f, 9.807852804e-01f, 1.830398880e-01f, 9.831054874e-01f,
+	1.709618888e-01f, 9.852776424e-01f, 1.588581433e-01f, 9.873014182e-01f,
+	1.467304745e-01f, 9.891765100e-01f, 1.345807085e-01f, 9.909026354e-01f,
+	1.224106752e-01f, 9.924795346e-01f, 1.102222073e-01f, 9.939069700e-01f,
+	9.801714033e-02f, 9.951847267e-01f, 8.579731234e-02f, 9.963126122e-01f,
+	7.356456360e-02f, 9.972904567e-01f, 6.132073630e-02f, 9.981181129e-01f,
+	4.906767433e-02f, 9.987954562e-01f, 3.680722294e-02f, 9.993223846e-01f,
+	2.454122852e-02f, 9.996988187e-01f, 1.227153829e-02f, 9.999247018e-01f,
+	6.123233996e-17f, 1.000000000e+00f, -1.227153829e-02f, 9.999247018e-01f,
+	-2.454122852e-02f, 9.996988187e-01f, -3.680722294e-02f, 9.993223846e-01f,
+	-4.906767433e-02f, 9.987954562e-01f, -6.132073630e-02f, 9.981181129e-01f,
+	-7.356456360e-02f, 9.972904567e-01f, -8.579731234e-02f, 9.963126122e-01f,
+	-9.801714033e-02f, 9.951847267e-01f, -1.102222073e-01f, 9.939069700e-01f,
+	-1.224106752e-01f, 9.924795346e-01f, -1.345807085e-01f, 9.909026354e-01f,
+	-1.467304745e-01f, 9.891765100e-01f, -1.588581433e-01f, 9.873014182e-01f,
+	-1.709618888e-01f, 9.852776424e-01f, -1.830398880e-01f, 9.831054874e-01f,
+	-1.950903220e-01f, 9.807852804e-01f, -2.071113762e-01f, 9.783173707e-01f,
+	-2.191012402e-01f, 9.757021300e-01f, -2.310581083e-01f, 9.729399522e-01f,
+	-2.429801799e-01f, 9.700312532e-01f, -2.548656596e-01f, 9.669764710e-01f,
+	-2.667127575e-01f, 9.637760658e-01f, -2.785196894e-01f, 9.604305194e-01f,
+	-2.902846773e-01f, 9.569403357e-01f, -3.020059493e-01f, 9.533060404e-01f,
+	-3.136817404e-01f, 9.495281806e-01f, -3.253102922e-01f, 9.456073254e-01f,
+	-3.368898534e-01f, 9.415440652e-01f, -3.484186802e-01f, 9.373390119e-01f,
+	-3.598950365e-01f, 9.329927988e-01f, -3.713171940e-01f, 9.285060805e-01f,
+	-3.826834324e-01f, 9.238795325e-01f, -3.939920401e-01f, 9.191138517e-01f,
+	-4.052413140e-01f, 9.142097557e-01f, -4.164295601e-01f, 9.091679831e-01f,
+	-4.275550934e-01f, 9.039892931e-01f, -4.386162385e-01f, 8.986744657e-01f,
+	-4.496113297e-01f, 8.932243012e-01f, -4.605387110e-01f, 8.876396204e-01f,
+	-4.713967368e-01f, 8.819212643e-01f, -4.821837721e-01f, 8.760700942e-01f,
+	-4.928981922e-01f, 8.700869911e-01f, -5.035383837e-01f, 8.639728561e-01f,
+	-5.141027442e-01f, 8.577286100e-01f, -5.245896827e-01f, 8.513551931e-01f,
+	-5.349976199e-01f, 8.448535652e-01f, -5.453249884e-01f, 8.382247056e-01f,
+	-5.555702330e-01f, 8.314696123e-01f, -5.657318108e-01f, 8.245893028e-01f,
+	-5.758081914e-01f, 8.175848132e-01f, -5.857978575e-01f, 8.104571983e-01f,
+	-5.956993045e-01f, 8.032075315e-01f, -6.055110414e-01f, 7.958369046e-01f,
+	-6.152315906e-01f, 7.883464276e-01f, -6.248594881e-01f, 7.807372286e-01f,
+	-6.343932842e-01f, 7.730104534e-01f, -6.438315429e-01f, 7.651672656e-01f,
+	-6.531728430e-01f, 7.572088465e-01f, -6.624157776e-01f, 7.491363945e-01f,
+	-6.715589548e-01f, 7.409511254e-01f, -6.806009978e-01f, 7.326542717e-01f,
+	-6.895405447e-01f, 7.242470830e-01f, -6.983762494e-01f, 7.157308253e-01f,
+	-7.071067812e-01f, 7.071067812e-01f, -7.157308253e-01f, 6.983762494e-01f,
+	-7.242470830e-01f, 6.895405447e-01f, -7.326542717e-01f, 6.806009978e-01f,
+	-7.409511254e-01f, 6.715589548e-01f, -7.491363945e-01f, 6.624157776e-01f,
+	-7.572088465e-01f, 6.531728430e-01f, -7.651672656e-01f, 6.438315429e-01f,
+	-7.730104534e-01f, 6.343932842e-01f, -7.807372286e-01f, 6.248594881e-01f,
+	-7.883464276e-01f, 6.152315906e-01f, -7.958369046e-01f, 6.055110414e-01f,
+	-8.032075315e-01f, 5.956993045e-01f, -8.104571983e-01f, 5.857978575e-01f,
+	-8.175848132e-01f, 5.758081914e-01f, -8.245893028e-01f, 5.657318108e-01f,
+	-8.314696123e-01f, 5.555702330e-01f, -8.382247056e-01f, 5.453249884e-01f,
+	-8.448535652e-01f, 5.349976199e-01f, -8.513551931e-01f, 5.245896827e-01f,
+	-8.577286100e-01f, 5.141027442e-01f, -8.639728561e-01f, 5.035383837e-01f,
+	-8.700869911e-01f, 4.928981922e-01f, -8.760700942e-01f, 4.821837721e-01f,
+	-8.819212643e-01f, 4.713967368e-01f, -8.876396204e-01f, 4.605387110e-01f,
+	-8.932243012e-01f, 4.496113297e-01f, -8.986744657e-01f, 4.386162385e-01f,
+	-9.039892931e-01f, 4.275550934e-01f, -9.091679831e-01f, 4.164295601e-01f,
+	-9.142097557e-01f, 4.052413140e-01f, -9.191138517e-01f, 3.939920401e-01f,
+	-9.238795325e-01f, 3.826834324e-01f, -9.285060805e-01f, 3.713171940e-01f,
+	-9.329927988e-01f, 3.598950365e-01f, -9.373390119e-01f, 3.484186802e-01f,
+	-9.415440652e-01f, 3.368898534e-01f, -9.456073254e-01f, 3.253102922e-01f,
+	-9.495281806e-01f, 3.136817404e-01f, -9.533060404e-01f, 3.020059493e-01f,
+	-9.569403357e-01f, 2.902846773e-01f, -9.604305194e-01f, 2.785196894e-01f,
+	-9.637760658e-01f, 2.667127575e-01f, -9.669764710e-01f, 2.548656596e-01f,
+	-9.700312532e-01f, 2.429801799e-01f, -9.729399522e-01f, 2.310581083e-01f,
+	-9.757021300e-01f, 2.191012402e-01f, -9.783173707e-01f, 2.071113762e-01f,
+	-9.807852804e-01f, 1.950903220e-01f, -9.831054874e-01f, 1.830398880e-01f,
+	-9.852776424e-01f, 1.709618888e-01f, -9.873014182e-01f, 1.588581433e-01f,
+	-9.891765100e-01f, 1.467304745e-01f, -9.909026354e-01f, 1.345807085e-01f,
+	-9.924795346e-01f, 1.224106752e-01f, -9.939069700e-01f, 1.102222073e-01f,
+	-9.951847267e-01f, 9.801714033e-02f, -9.963126122e-01f, 8.579731234e-02f,
+	-9.972904567e-01f, 7.356456360e-02f, -9.981181129e-01f, 6.132073630e-02f,
+	-9.987954562e-01f, 4.906767433e-02f, -9.993223846e-01f, 3.680722294e-02f,
+	-9.996988187e-01f, 2.454122852e-02f, -9.999247018e-01f, 1.227153829e-02f,
+	-1.000000000e+00f, 1.224646799e-16f, -9.999247018e-01f, -1.227153829e-02f,
+	-9.996988187e-01f, -2.454122852e-02f, -9.993223846e-01f, -3.680722294e-02f,
+	-9.987954562e-01f, -4.906767433e-02f, -9.981181129e-01f, -6.132073630e-02f,
+	-9.972904567e-01f, -7.356456360e-02f, -9.963126122e-01f, -8.579731234e-02f,
+	-9.951847267e-01f, -9.801714033e-02f, -9.939069700e-01f, -1.102222073e-01f,
+	-9.924795346e-01f, -1.224106752e-01f, -9.909026354e-01f, -1.345807085e-01f,
+	-9.891765100e-01f, -1.467304745e-01f, -9.873014182e-01f, -1.588581433e-01f,
+	-9.852776424e-01f, -1.709618888e-01f, -9.831054874e-01f, -1.830398880e-01f,
+	-9.807852804e-01f, -1.950903220e-01f, -9.783173707e-01f, -2.071113762e-01f,
+	-9.757021300e-01f, -2.191012402e-01f, -9.729399522e-01f, -2.310581083e-01f,
+	-9.700312532e-01f, -2.429801799e-01f, -9.669764710e-01f, -2.548656596e-01f,
+	-9.637760658e-01f, -2.667127575e-01f, -9.604305194e-01f, -2.785196894e-01f,
+	-9.569403357e-01f, -2.902846773e-01f, -9.533060404e-01f, -3.020059493e-01f,
+	-9.495281806e-01f, -3.136817404e-01f, -9.456073254e-01f, -3.253102922e-01f,
+	-9.415440652e-01f, -3.368898534e-01f, -9.373390119e-01f, -3.484186802e-01f,
+	-9.329927988e-01f, -3.598950365e-01f, -9.285060805e-01f, -3.713171940e-01f,
+	-9.238795325e-01f, -3.826834324e-01f, -9.191138517e-01f, -3.939920401e-01f,
+	-9.142097557e-01f, -4.052413140e-01f, -9.091679831e-01f, -4.164295601e-01f,
+	-9.039892931e-01f, -4.275550934e-01f, -8.986744657e-01f, -4.386162385e-01f,
+	-8.932243012e-01f, -4.496113297e-01f, -8.876396204e-01f, -4.605387110e-01f,
+	-8.819212643e-01f, -4.713967368e-01f, -8.760700942e-01f, -4.821837721e-01f,
+	-8.700869911e-01f, -4.928981922e-01f, -8.639728561e-01f, -5.035383837e-01f,
+	-8.577286100e-01f, -5.141027442e-01f, -8.513551931e-01f, -5.245896827e-01f,
+	-8.448535652e-01f, -5.349976199e-01f, -8.382247056e-01f, -5.453249884e-01f,
+	-8.314696123e-01f, -5.555702330e-01f, -8.245893028e-01f, -5.657318108e-01f,
+	-8.175848132e-01f, -5.758081914e-01f, -8.104571983e-01f, -5.857978575e-01f,
+	-8.032075315e-01f, -5.956993045e-01f, -7.958369046e-01f, -6.055110414e-01f,
+	-7.883464276e-01f, -6.152315906e-01f, -7.807372286e-01f, -6.248594881e-01f,
+	-7.730104534e-01f, -6.343932842e-01f, -7.651672656e-01f, -6.438315429e-01f,
+	-7.572088465e-01f, -6.531728430e-01f, -7.491363945e-01f, -6.624157776e-01f,
+	-7.409511254e-01f, -6.715589548e-01f, -7.326542717e-01f, -6.806009978e-01f,
+	-7.242470830e-01f, -6.895405447e-01f, -7.157308253e-01f, -6.983762494e-01f,
+	-7.071067812e-01f, -7.071067812e-01f, -6.983762494e-01f, -7.157308253e-01f,
+	-6.895405447e-01f, -7.242470830e-01f, -6.806009978e-01f, -7.326542717e-01f,
+	-6.715589548e-01f, -7.409511254e-01f, -6.624157776e-01f, -7.491363945e-01f,
+	-6.531728430e-01f, -7.572088465e-01f, -6.438315429e-01f, -7.651672656e-01f,
+	-6.343932842e-01f, -7.730104534e-01f, -6.248594881e-01f, -7.807372286e-01f,
+	-6.152315906e-01f, -7.883464276e-01f, -6.055110414e-01f, -7.958369046e-01f,
+	-5.956993045e-01f, -8.032075315e-01f, -5.857978575e-01f, -8.104571983e-01f,
+	-5.758081914e-01f, -8.175848132e-01f, -5.657318108e-01f, -8.245893028e-01f,
+	-5.555702330e-01f, -8.314696123e-01f, -5.453249884e-01f, -8.382247056e-01f,
+	-5.349976199e-01f, -8.448535652e-01f, -5.245896827e-01f, -8.513551931e-01f,
+	-5.141027442e-01f, -8.577286100e-01f, -5.035383837e-01f, -8.639728561e-01f,
+	-4.928981922e-01f, -8.700869911e-01f, -4.821837721e-01f, -8.760700942e-01f,
+	-4.713967368e-01f, -8.819212643e-01f, -4.605387110e-01f, -8.876396204e-01f,
+	-4.496113297e-01f, -8.932243012e-01f, -4.386162385e-01f, -8.986744657e-01f,
+	-4.275550934e-01f, -9.039892931e-01f, -4.164295601e-01f, -9.091679831e-01f,
+	-4.052413140e-01f, -9.142097557e-01f, -3.939920401e-01f, -9.191138517e-01f,
+	-3.826834324e-01f, -9.238795325e-01f, -3.713171940e-01f, -9.285060805e-01f,
+	-3.598950365e-01f, -9.329927988e-01f, -3.484186802e-01f, -9.373390119e-01f,
+	-3.368898534e-01f, -9.415440652e-01f, -3.253102922e-01f, -9.456073254e-01f,
+	-3.136817404e-01f, -9.495281806e-01f, -3.020059493e-01f, -9.533060404e-01f,
+	-2.902846773e-01f, -9.569403357e-01f, -2.785196894e-01f, -9.604305194e-01f,
+	-2.667127575e-01f, -9.637760658e-01f, -2.548656596e-01f, -9.669764710e-01f,
+	-2.429801799e-01f, -9.700312532e-01f, -2.310581083e-01f, -9.729399522e-01f,
+	-2.191012402e-01f, -9.757021300e-01f, -2.071113762e-01f, -9.783173707e-01f,
+	-1.950903220e-01f, -9.807852804e-01f, -1.830398880e-01f, -9.831054874e-01f,
+	-1.709618888e-01f, -9.852776424e-01f, -1.588581433e-01f, -9.873014182e-01f,
+	-1.467304745e-01f, -9.891765100e-01f, -1.345807085e-01f, -9.909026354e-01f,
+	-1.224106752e-01f, -9.924795346e-01f, -1.102222073e-01f, -9.939069700e-01f,
+	-9.801714033e-02f, -9.951847267e-01f, -8.579731234e-02f, -9.963126122e-01f,
+	-7.356456360e-02f, -9.972904567e-01f, -6.132073630e-02f, -9.981181129e-01f,
+	-4.906767433e-02f, -9.987954562e-01f, -3.680722294e-02f, -9.993223846e-01f,
+	-2.454122852e-02f, -9.996988187e-01f, -1.227153829e-02f, -9.999247018e-01f,
+	-1.836970199e-16f, -1.000000000e+00f, 1.227153829e-02f, -9.999247018e-01f,
+	2.454122852e-02f, -9.996988187e-01f, 3.680722294e-02f, -9.993223846e-01f,
+	4.906767433e-02f, -9.987954562e-01f, 6.132073630e-02f, -9.981181129e-01f,
+	7.356456360e-02f, -9.972904567e-01f, 8.579731234e-02f, -9.963126122e-01f,
+	9.801714033e-02f, -9.951847267e-01f, 1.102222073e-01f, -9.939069700e-01f,
+	1.224106752e-01f, -9.924795346e-01f, 1.345807085e-01f, -9.909026354e-01f,
+	1.467304745e-01f, -9.891765100e-01f, 1.588581433e-01f, -9.873014182e-01f,
+	1.709618888e-01f, -9.852776424e-01f, 1.830398880e-01f, -9.831054874e-01f,
+	1.950903220e-01f, -9.807852804e-01f, 2.071113762e-01f, -9.783173707e-01f,
+	2.191012402e-01f, -9.757021300e-01f, 2.310581083e-01f, -9.729399522e-01f,
+	2.429801799e-01f, -9.700312532e-01f, 2.548656596e-01f, -9.669764710e-01f,
+	2.667127575e-01f, -9.637760658e-01f, 2.785196894e-01f, -9.604305194e-01f,
+	2.902846773e-01f, -9.569403357e-01f, 3.020059493e-01f, -9.533060404e-01f,
+	3.136817404e-01f, -9.495281806e-01f, 3.253102922e-01f, -9.456073254e-01f,
+	3.368898534e-01f, -9.415440652e-01f, 3.484186802e-01f, -9.373390119e-01f,
+	3.598950365e-01f, -9.329927988e-01f, 3.713171940e-01f, -9.285060805e-01f,
+	3.826834324e-01f, -9.238795325e-01f, 3.939920401e-01f, -9.191138517e-01f,
+	4.052413140e-01f, -9.142097557e-01f, 4.164295601e-01f, -9.091679831e-01f,
+	4.275550934e-01f, -9.039892931e-01f, 4.386162385e-01f, -8.986744657e-01f,
+	4.496113297e-01f, -8.932243012e-01f, 4.605387110e-01f, -8.876396204e-01f,
+	4.713967368e-01f, -8.819212643e-01f, 4.821837721e-01f, -8.760700942e-01f,
+	4.928981922e-01f, -8.700869911e-01f, 5.035383837e-01f, -8.639728561e-01f,
+	5.141027442e-01f, -8.577286100e-01f, 5.245896827e-01f, -8.513551931e-01f,
+	5.349976199e-01f, -8.448535652e-01f, 5.453249884e-01f, -8.382247056e-01f,
+	5.555702330e-01f, -8.314696123e-01f, 5.657318108e-01f, -8.245893028e-01f,
+	5.758081914e-01f, -8.175848132e-01f, 5.857978575e-01f, -8.104571983e-01f,
+	5.956993045e-01f, -8.032075315e-01f, 6.055110414e-01f, -7.958369046e-01f,
+	6.152315906e-01f, -7.883464276e-01f, 6.248594881e-01f, -7.807372286e-01f,
+	6.343932842e-01f, -7.730104534e-01f, 6.438315429e-01f, -7.651672656e-01f,
+	6.531728430e-01f, -7.572088465e-01f, 6.624157776e-01f, -7.491363945e-01f,
+	6.715589548e-01f, -7.409511254e-01f, 6.806009978e-01f, -7.326542717e-01f,
+	6.895405447e-01f, -7.242470830e-01f, 6.983762494e-01f, -7.157308253e-01f,
+	7.071067812e-01f, -7.071067812e-01f, 7.157308253e-01f, -6.983762494e-01f,
+	7.242470830e-01f, -6.895405447e-01f, 7.326542717e-01f, -6.806009978e-01f,
+	7.409511254e-01f, -6.715589548e-01f, 7.491363945e-01f, -6.624157776e-01f,
+	7.572088465e-01f, -6.531728430e-01f, 7.651672656e-01f, -6.438315429e-01f,
+	7.730104534e-01f, -6.343932842e-01f, 7.807372286e-01f, -6.248594881e-01f,
+	7.883464276e-01f, -6.152315906e-01f, 7.958369046e-01f, -6.055110414e-01f,
+	8.032075315e-01f, -5.956993045e-01f, 8.104571983e-01f, -5.857978575e-01f,
+	8.175848132e-01f, -5.758081914e-01f, 8.245893028e-01f, -5.657318108e-01f,
+	8.314696123e-01f, -5.555702330e-01f, 8.382247056e-01f, -5.453249884e-01f,
+	8.448535652e-01f, -5.349976199e-01f, 8.513551931e-01f, -5.245896827e-01f,
+	8.577286100e-01f, -5.141027442e-01f, 8.639728561e-01f, -5.035383837e-01f,
+	8.700869911e-01f, -4.928981922e-01f, 8.760700942e-01f, -4.821837721e-01f,
+	8.819212643e-01f, -4.713967368e-01f, 8.876396204e-01f, -4.605387110e-01f,
+	8.932243012e-01f, -4.496113297e-01f, 8.986744657e-01f, -4.386162385e-01f,
+	9.039892931e-01f, -4.275550934e-01f, 9.091679831e-01f, -4.164295601e-01f,
+	9.142097557e-01f, -4.052413140e-01f, 9.191138517e-01f, -3.939920401e-01f,
+	9.238795325e-01f, -3.826834324e-01f, 9.285060805e-01f, -3.713171940e-01f,
+	9.329927988e-01f, -3.598950365e-01f, 9.373390119e-01f, -3.484186802e-01f,
+	9.415440652e-01f, -3.368898534e-01f, 9.456073254e-01f, -3.253102922e-01f,
+	9.495281806e-01f, -3.136817404e-01f, 9.533060404e-01f, -3.020059493e-01f,
+	9.569403357e-01f, -2.902846773e-01f, 9.604305194e-01f, -2.785196894e-01f,
+	9.637760658e-01f, -2.667127575e-01f, 9.669764710e-01f, -2.548656596e-01f,
+	9.700312532e-01f, -2.429801799e-01f, 9.729399522e-01f, -2.310581083e-01f,
+	9.757021300e-01f, -2.191012402e-01f, 9.783173707e-01f, -2.071113762e-01f,
+	9.807852804e-01f, -1.950903220e-01f, 9.831054874e-01f, -1.830398880e-01f,
+	9.852776424e-01f, -1.709618888e-01f, 9.873014182e-01f, -1.588581433e-01f,
+	9.891765100e-01f, -1.467304745e-01f, 9.909026354e-01f, -1.345807085e-01f,
+	9.924795346e-01f, -1.224106752e-01f, 9.939069700e-01f, -1.102222073e-01f,
+	9.951847267e-01f, -9.801714033e-02f, 9.963126122e-01f, -8.579731234e-02f,
+	9.972904567e-01f, -7.356456360e-02f, 9.981181129e-01f, -6.132073630e-02f,
+	9.987954562e-01f, -4.906767433e-02f, 9.993223846e-01f, -3.680722294e-02f,
+	9.996988187e-01f, -2.454122852e-02f, 9.999247018e-01f, -1.227153829e-02f,
+};
+
+#pragma DATA_SECTION(fftTwiddleRfft1024, ".const:fftTwiddleRfft1024")
+const float32_t fftTwiddleRfft1024[1024] =
+{
+	0.000000000e+00f, 1.000000000e+00f, 6.135884649e-03f, 9.999811753e-01f,
+	1.227153829e-02f, 9.999247018e-01f, 1.840672991e-02f, 9.998305818e-01f,
+	2.454122852e-02f, 9.996988187e-01f, 3.067480318e-02f, 9.995294175e-01f,
+	3.680722294e-02f, 9.993223846e-01f, 4.293825693e-02f, 9.990777278e-01f,
+	4.906767433e-02f, 9.987954562e-01f, 5.519524435e-02f, 9.984755806e-01f,
+	6.132073630e-02f, 9.981181129e-01f, 6.744391956e-02f, 9.977230666e-01f,
+	7.356456360e-02f, 9.972904567e-01f, 7.968243797e-02f, 9.968202993e-01f,
+	8.579731234e-02f, 9.963126122e-01f, 9.190895650e-02f, 9.957674145e-01f,
+	9.801714033e-02f, 9.951847267e-01f, 1.041216339e-01f, 9.945645707e-01f,
+	1.102222073e-01f, 9.939069700e-01f, 1.163186309e-01f, 9.932119492e-01f,
+	1.224106752e-01f, 9.924795346e-01f, 1.284981108e-01f, 9.917097537e-01f,
+	1.345807085e-01f, 9.909026354e-01f, 1.406582393e-01f, 9.900582103e-01f,
+	1.467304745e-01f, 9.891765100e-01f, 1.527971853e-01f, 9.882575677e-01f,
+	1.588581433e-01f, 9.873014182e-01f, 1.649131205e-01f, 9.863080972e-01f,
+	1.709618888e-01f, 9.852776424e-01f, 1.770042204e-01f, 9.842100924e-01f,
+	1.830398880e-01f, 9.831054874e-01f, 1.890686641e-01f, 9.819638691e-01f,
+	1.950903220e-01f, 9.807852804e-01f, 2.011046348e-01f, 9.795697657e-01f,
+	2.071113762e-01f, 9.783173707e-01f, 2.131103199e-01f, 9.770281427e-01f,
+	2.191012402e-01f, 9.757021300e-01f, 2.250839114e-01f, 9.743393828e-01f,
+	2.310581083e-01f, 9.729399522e-01f, 2.370236060e-01f, 9.715038910e-01f,
+	2.429801799e-01f, 9.700312532e-01f, 2.489276057e-01f, 9.685220943e-01f,
+	2.548656596e-01f, 9.669764710e-01f, 2.607941179e-01f, 9.653944417e-01f,
+	2.667127575e-01f, 9.637760658e-01f, 2.726213554e-01f, 9.621214043e-01f,
+	2.785196894e-01f, 9.604305194e-01f, 2.844075372e-01f, 9.587034749e-01f,
+	2.902846773e-01f, 9.569403357e-01f, 2.961508882e-01f, 9.551411683e-01f,
+	3.020059493e-01f, 9.533060404e-01f, 3.078496400e-01f, 9.514350210e-01f,
+	3.136817404e-01f, 9.495281806e-01f, 3.195020308e-01f, 9.475855910e-01f,
+	3.253102922e-01f, 9.456073254e-01f, 3.311063058e-01f, 9.435934582e-01f,
+	3.368898534e-01f, 9.415440652e-01f, 3.426607173e-01f, 9.394592236e-01f,
+	3.484186802e-01f, 9.373390119e-01f, 3.541635254e-01f, 9.351835099e-01f,
+	3.598950365e-01f, 9.329927988e-01f, 3.656129978e-01f, 9.307669611e-01f,
+	3.713171940e-01f, 9.285060805e-01f, 3.770074102e-01f, 9.262102421e-01f,
+	3.826834324e-01f, 9.238795325e-01f, 3.883450467e-01f, 9.215140393e-01f,
+	3.939920401e-01f, 9.191138517e-01f, 3.996241998e-01f, 9.166790599e-01f,
+	4.052413140e-01f, 9.142097557e-01f, 4.108431711e-01f, 9.117060320e-01f,
+	4.164295601e-01f, 9.091679831e-01f, 4.220002708e-01f, 9.065957045e-01f,
+	4.275550934e-01f, 9.039892931e-01f, 4.330938189e-01f, 9.013488470e-01f,
+	4.386162385e-01f, 8.986744657e-01f, 4.441221446e-01f, 8.959662498e-01f,
+	4.496113297e-01f, 8.932243012e-01f, 4.550835871e-01f, 8.904487232e-01f,
+	4.605387110e-01f, 8.876396204e-01f, 4.659764958e-01f, 8.847970984e-01f,
+	4.713967368e-01f, 8.819212643e-01f, 4.767992301e-01f, 8.790122264e-01f,
+	4.821837721e-01f, 8.760700942e-01f, 4.875501601e-01f, 8.730949784e-01f,
+	4.928981922e-01f, 8.700869911e-01f, 4.982276670e-01f, 8.670462455e-01f,
+	5.035383837e-01f, 8.639728561e-01f, 5.088301425e-01f, 8.608669386e-01f,
+	5.141027442e-01f, 8.577286100e-01f, 5.193559902e-01f, 8.545579884e-01f,
+	5.245896827e-01f, 8.513551931e-01f, 5.298036247e-01f, 8.481203448e-01f,
+	5.349976199e-01f, 8.448535652e-01f, 5.401714727e-01f, 8.415549774e-01f,
+	5.453249884e-01f, 8.382247056e-01f, 5.504579729e-01f, 8.348628750e-01f,
+	5.555702330e-01f, 8.314696123e-01f, 5.606615762e-01f, 8.280450453e-01f,
+	5.657318108e-01f, 8.245893028e-01f, 5.707807459e-01f, 8.211025150e-01f,
+	5.758081914e-01f, 8.175848132e-01f, 5.808139581e-01f, 8.140363297e-01f,
+	5.857978575e-01f, 8.104571983e-01f, 5.907597019e-01f, 8.068475535e-01f,
+	5.956993045e-01f, 8.032075315e-01f, 6.006164794e-01f, 7.995372691e-01f,
+	6.055110414e-01f, 7.958369046e-01f, 6.103828063e-01f, 7.921065773e-01f,
+	6.152315906e-01f, 7.883464276e-01f, 6.200572118e-01f, 7.845565972e-01f,
+	6.248594881e-01f, 7.807372286e-01f, 6.296382389e-01f, 7.768884657e-01f,
+	6.343932842e-01f, 7.730104534e-01f, 6.391244449e-01f, 7.691033376e-01f,
+	6.438315429e-01f, 7.651672656e-01f, 6.485144010e-01f, 7.612023855e-01f,
+	6.531728430e-01f, 7.572088465e-01f, 6.578066933e-01f, 7.531867990e-01f,
+	6.624157776e-01f, 7.491363945e-01f, 6.669999223e-01f, 7.450577854e-01f,
+	6.715589548e-01f, 7.409511254e-01f, 6.760927036e-01f, 7.368165689e-01f,
+	6.806009978e-01f, 7.326542717e-01f, 6.850836678e-01f, 7.284643904e-01f,
+	6.895405447e-01f, 7.242470830e-01f, 6.939714609e-01f, 7.200025080e-01f,
+	6.983762494e-01f, 7.157308253e-01f, 7.027547445e-01f, 7.114321957e-01f,
+	7.071067812e-01f, 7.071067812e-01f, 7.114321957e-01f, 7.027547445e-01f,
+	7.157308253e-01f, 6.983762494e-01f, 7.200025080e-01f, 6.939714609e-01f,
+	7.242470830e-01f, 6.895405447e-01f, 7.284643904e-01f, 6.850836678e-01f,
+	7.326542717e-01f, 6.806009978e-01f, 7.368165689e-01f, 6.760927036e-01f,
+	7.409511254e-01f, 6.715589548e-01f, 7.450577854e-01f, 6.669999223e-01f,
+	7.491363945e-01f, 6.624157776e-01f, 7.531867990e-01f, 6.578066933e-01f,
+	7.572088465e-01f, 6.531728430e-01f, 7.612023855e-01f, 6.485144010e-01f,
+	7.651672656e-01f, 6.438315429e-01f, 7.691033376e-01f, 6.391244449e-01f,
+	7.730104534e-01f, 6.343932842e-01f, 7.768884657e-01f, 6.296382389e-01f,
+	7.807372286e-01f, 6.248594881e-01f, 7.845565972e-01f, 6.200572118e-01f,
+	7.883464276e-01f, 6.152315906e-01f, 7.921065773e-01f, 6.103828063e-01f,
+	7.958369046e-01f, 6.055110414e-01f, 7.995372691e-01f, 6.006164794e-01f,
+	8.032075315e-01f, 5.956993045e-01f, 8.068475535e-01f, 5.907597019e-01f,
+	8.104571983e-01f, 5.857978575e-01f, 8.140363297e-01f, 5.808139581e-01f,
+	8.175848132e-01f, 5.758081914e-01f, 8.211025150e-01f, 5.707807459e-01f,
+	8.245893028e-01f, 5.657318108e-01f, 8.280450453e-01f, 5.606615762e-01f,
+	8.314696123e-01f, 5.555702330e-01f, 8.348628750e-01f, 5.504579729e-01f,
+	8.382247056e-01f, 5.453249884e-01f, 8.415549774e-01f, 5.401714727e-01f,
+	8.448535652e-01f, 5.349976199e-01f, 8.481203448e-01f, 5.298036247e-01f,
+	8.513551931e-01f, 5.245896827e-01f, 8.545579884e-01f, 5.193559902e-01f,
+	8.577286100e-01f, 5.141027442e-01f, 8.608669386e-01f, 5.088301425e-01f,
+	8.639728561e-01f, 5.035383837e-01f, 8.670462455e-01f, 4.982276670e-01f,
+	8.700869911e-01f, 4.928981922e-01f, 8.730949784e-01f, 4.875501601e-01f,
+	8.760700942e-01f, 4.821837721e-01f, 8.790122264e-01f, 4.767992301e-01f,
+	8.819212643e-01f, 4.713967368e-01f, 8.847970984e-01f, 4.659764958e-01f,
+	8.876396204e-01f, 4.605387110e-01f, 8.904487232e-01f, 4.550835871e-01f,
+	8.932243012e-01f, 4.496113297e-01f, 8.959662498e-01f, 4.441221446e-01f,
+	8.986744657e-01f, 4.386162385e-01f, 9.013488470e-01f, 4.330938189e-01f,
+	9.039892931e-01f, 4.275550934e-01f, 9.065957045e-01f, 4.220002708e-01f,
+	9.091679831e-01f, 4.164295601e-01f, 9.117060320e-01f, 4.108431711e-01f,
+	9.142097557e-01f, 4.052413140e-01f, 9.166790599e-01f, 3.996241998e-01f,
+	9.191138517e-01f, 3.939920401e-01f, 9.215140393e-01f, 3.883450467e-01f,
+	9.238795325e-01f, 3.826834324e-01f, 9.262102421e-01f, 3.770074102e-01f,
+	9.285060805e-01f, 3.713171940e-01f, 9.307669611e-01f, 3.656129978e-01f,
+	9.329927988e-01f, 3.598950365e-01f, 9.351835099e-01f, 3.541635254e-01f,
+	9.373390119e-01f, 3.484186802e-01f, 9.394592236e-01f, 3.426607173e-01f,
+	9.415440652e-01f, 3.368898534e-01f, 9.435934582e-01f, 3.311063058e-01f,
+	9.456073254e-01f, 3.253102922e-01f, 9.475855910e-01f, 3.195020308e-01f,
+	9.495281806e-01f, 3.136817404e-01f, 9.514350210e-01f, 3.078496400e-01f,
+	9.533060404e-01f, 3.020059493e-01f, 9.551411683e-01f, 2.961508882e-01f,
+	9.569403357e-01f, 2.902846773e-01f, 9.587034749e-01f, 2.844075372e-01f,
+	9.604305194e-01f, 2.785196894e-01f, 9.621214043e-01f, 2.726213554e-01f,
+	9.637760658e-01f, 2.667127575e-01f, 9.653944417e-01f, 2.607941179e-01f,
+	9.669764710e-01f, 2.548656596e-01f, 9.685220943e-01f, 2.489276057e-01f,
+	9.700312532e-01f, 2.429801799e-01f, 9.715038910e-01f, 2.370236060e-01f,
+	9.729399522e-01f, 2.310581083e-01f, 9.743393828e-01f, 2.250839114e-01f,
+	9.757021300e-01f, 2.191012402e-01f, 9.770281427e-01f, 2.131103199e-01f,
+	9.783173707e-01f, 2.071113762e-01f, 9.795697657e-01f, 2.011046348e-01f,
+	9.807852804e-01f, 1.950903220e-01f, 9.819638691e-01f, 1.890686641e-01f,
+	9.831054874e-01f, 1.830398880e-01f, 9.842100924e-01f, 1.770042204e-01f,
+	9.852776424e-01f, 1.709618888e-01f, 9.863080972e-01f, 1.649131205e-01f,
+	9.873014182e-01f, 1.588581433e-01f, 9.882575677e-01f, 1.527971853e-01f,
+	9.891765100e-01f, 1.467304745e-01f, 9.900582103e-01f, 1.406582393e-01f,
+	9.909026354e-01f, 1.345807085e-01f, 9.917097537e-01f, 1.284981108e-01f,
+	9.924795346e-01f, 1.224106752e-01f, 9.932119492e-01f, 1.163186309e-01f,
+	9.939069700e-01f, 1.102222073e-01f, 9.945645707e-01f, 1.041216339e-01f,
+	9.951847267e-01f, 9.801714033e-02f, 9.957674145e-01f, 9.190895650e-02f,
+	9.963126122e-01f, 8.579731234e-02f, 9.968202993e-01f, 7.968243797e-02f,
+	9.972904567e-01f, 7.356456360e-02f, 9.977230666e-01f, 6.744391956e-02f,
+	9.981181129e-01f, 6.132073630e-02f, 9.984755806e-01f, 5.519524435e-02f,
+	9.987954562e-01f, 4.906767433e-02f, 9.990777278e-01f, 4.293825693e-02f,
+	9.993223846e-01f, 3.680722294e-02f, 9.995294175e-01f, 3.067480318e-02f,
+	9.996988187e-01f, 2.454122852e-02f, 9.998305818e-01f, 1.840672991e-02f,
+	9.999247018e-01f, 1.227153829e-02f, 9.999811753e-01f, 6.135884649e-03f,
+	1.000000000e+00f, 6.123233996e-17f, 9.999811753e-01f, -6.135884649e-03f,
+	9.999247018e-01f, -1.227153829e-02f, 9.998305818e-01f, -1.840672991e-02f,
+	9.996988187e-01f, -2.454122852e-02f, 9.995294175e-01f, -3.067480318e-02f,
+	9.993223846e-01f, -3.680722294e-02f, 9.990777278e-01f, -4.293825693e-02f,
+	9.987954562e-01f, -4.906767433e-02f, 9.984755806e-01f, -5.519524435e-02f,
+	9.981181129e-01f, -6.132073630e-02f, 9.977230666e-01f, -6.744391956e-02f,
+	9.972904567e-01f, -7.356456360e-02f, 9.968202993e-01f, -7.968243797e-02f,
+	9.963126122e-01f, -8.579731234e-02f, 9.957674145e-01f, -9.190895650e-02f,
+	9.951847267e-01f, -9.801714033e-02f, 9.945645707e-01f, -1.041216339e-01f,
+	9.939069700e-01f, -1.102222073e-01f, 9.932119492e-01f, -1.163186309e-01f,
+	9.924795346e-01f, -1.224106752e-01f, 9.917097537e-01f, -1.284981108e-01f,
+	9.909026354e-01f, -1.345807085e-01f, 9.900582103e-01f, -1.406582393e-01f,
+	9.891765100e-01f, -1.467304745e-01f, 9.882575677e-01f, -1.527971853e-01f,
+	9.873014182e-01f, -1.588581433e-01f, 9.863080972e-01f, -1.649131205e-01f,
+	9.852776424e-01f, -1.709618888e-01f, 9.842100924e-01f, -1.770042204e-01f,
+	9.831054874e-01f, -1.830398880e-01f, 9.819638691e-01f, -1.890686641e-01f,
+	9.807852804e-01f, -1.950903220e-01f, 9.795697657e-01f, -2.011046348e-01f,
+	9.783173707e-01f, -2.071113762e-01f, 9.770281427e-01f, -2.131103199e-01f,
+	9.757021300e-01f, -2.191012402e-01f, 9.743393828e-01f, -2.250839114e-01f,
+	9.729399522e-01f, -2.310581083e-01f, 9.715038910e-01f, -2.370236060e-01f,
+	9.700312532e-01f, -2.429801799e-01f, 9.685220943e-01f, -2.489276057e-01f,
+	9.669764710e-01f, -2.548656596e-01f, 9.653944417e-01f, -2.607941179e-01f,
+	9.637760658e-01f, -2.667127575e-01f, 9.621214043e-01f, -2.726213554e-01f,
+	9.604305194e-01f, -2.785196894e-01f, 9.587034749e-01f, -2.844075372e-01f,
+	9.569403357e-01f, -2.902846773e-01f, 9.551411683e-01f, -2.961508882e-01f,
+	9.533060404e-01f, -3.020059493e-01f, 9.514350210e-01f, -3.078496400e-01f,
+	9.495281806e-01f, -3.136817404e-01f, 9.475855910e-01f, -3.195020308e-01f,
+	9.456073254e-01f, -3.253102922e-01f, 9.435934582e-01f, -3.311063058e-01f,
+	9.415440652e-01f, -3.368898534e-01f, 9.394592236e-01f, -3.426607173e-01f,
+	9.373390119e-01f, -3.484186802e-01f, 9.351835099e-01f, -3.541635254e-01f,
+	9.329927988e-01f, -3.598950365e-01f, 9.307669611e-01f, -3.656129978e-01f,
+	9.285060805e-01f, -3.713171940e-01f, 9.262102421e-01f, -3.770074102e-01f,
+	9.238795325e-01f, -3.826834324e-01f, 9.215140393e-01f, -3.883450467e-01f,
+	9.191138517e-01f, -3.939920401e-01f, 9.166790599e-01f, -3.996241998e-01f,
+	9.142097557e-01f, -4.052413140e-01f, 9.117060320e-01f, -4.108431711e-01f,
+	9.091679831e-01f, -4.164295601e-01f, 9.065957045e-01f, -4.220002708e-01f,
+	9.039892931e-01f, -4.275550934e-01f, 9.013488470e-01f, -4.330938189e-01f,
+	8.986744657e-01f, -4.386162385e-01f, 8.959662498e-01f, -4.441221446e-01f,
+	8.932243012e-01f, -4.496113297e-01f, 8.904487232e-01f, -4.550835871e-01f,
+	8.876396204e-01f, -4.605387110e-01f, 8.847970984e-01f, -4.659764958e-01f,
+	8.819212643e-01f, -4.713967368e-01f, 8.790122264e-01f, -4.767992301e-01f,
+	8.760700942e-01f, -4.821837721e-01f, 8.730949784e-01f, -4.875501601e-01f,
+	8.700869911e-01f, -4.928981922e-01f, 8.670462455e-01f, -4.982276670e-01f,
+	8.639728561e-01f, -5.035383837e-01f, 8.608669386e-01f, -5.088301425e-01f,
+	8.577286100e-01f, -5.141027442e-01f, 8.545579884e-01f, -5.193559902e-01f,
+	8.513551931e-01f, -5.245896827e-01f, 8.481203448e-01f, -5.298036247e-01f,
+	8.448535652e-01f, -5.349976199e-01f, 8.415549774e-01f, -5.401714727e-01f,
+	8.382247056e-01f, -5.453249884e-01f, 8.348628750e-01f, -5.504579729e-01f,
+	8.314696123e-01f, -5.555702330e-01f, 8.280450453e-01f, -5.606615762e-01f,
+	8.245893028e-01f, -5.657318108e-01f, 8.211025150e-01f, -5.707807459e-01f,
+	8.175848132e-01f, -5.758081914e-01f, 8.140363297e-01f, -5.808139581e-01f,
+	8.104571983e-01f, -5.857978575e-01f, 8.068475535e-01f, -5.907597019e-01f,
+	8.032075315e-01f, -5.956993045e-01f, 7.995372691e-01f, -6.006164794e-01f,
+	7.958369046e-01f, -6.055110414e-01f, 7.921065773e-01f, -6.103828063e-01f,
+	7.883464276e-01f, -6.152315906e-01f, 7.845565972e-01f, -6.200572118e-01f,
+	7.807372286e-01f, -6.248594881e-01f, 7.768884657e-01f, -6.296382389e-01f,
+	7.730104534e-01f, -6.343932842e-01f, 7.691033376e-01f, -6.391244449e-01f,
+	7.651672656e-01f, -6.438315429e-01f, 7.612023855e-01f, -6.485144010e-01f,
+	7.572088465e-01f, -6.531728430e-01f, 7.531867990e-01f, -6.578066933e-01f,
+	7.491363945e-01f, -6.624157776e-01f, 7.450577854e-01f, -6.669999223e-01f,
+	7.409511254e-01f, -6.715589548e-01f, 7.368165689e-01f, -6.760927036e-01f,
+	7.326542717e-01f, -6.806009978e-01f, 7.284643904e-01f, -6.850836678e-01f,
+	7.242470830e-01f, -6.895405447e-01f, 7.200025080e-01f, -6.939714609e-01f,
+	7.157308253e-01f, -6.983762494e-01f, 7.114321957e-01f, -7.027547445e-01f,
+	7.071067812e-01f, -7.071067812e-01f, 7.027547445e-01f, -7.114321957e-01f,
+	6.983762494e-01f, -7.157308253e-01f, 6.939714609e-01f, -7.200025080e-01f,
+	6.895405447e-01f, -7.242470830e-01f, 6.850836678e-01f, -7.284643904e-01f,
+	6.806009978e-01f, -7.326542717e-01f, 6.760927036e-01f, -7.368165689e-01f,
+	6.715589548e-01f, -7.409511254e-01f, 6.669999223e-01f, -7.450577854e-01f,
+	6.624157776e-01f, -7.491363945e-01f, 6.578066933e-01f, -7.531867990e-01f,
+	6.531728430e-01f, -7.572088465e-01f, 6.485144010e-01f, -7.612023855e-01f,
+	6.438315429e-01f, -7.651672656e-01f, 6.391244449e-01f, -7.691033376e-01f,
+	6.343932842e-01f, -7.730104534e-01f, 6.296382389e-01f, -7.768884657e-01f,
+	6.248594881e-01f, -7.807372286e-01f, 6.200572118e-01f, -7.845565972e-01f,
+	6.152315906e-01f, -7.883464276e-01f, 6.103828063e-01f, -7.921065773e-01f,
+	6.055110414e-01f, -7.958369046e-01f, 6.006164794e-01f, -7.995372691e-01f,
+	5.956993045e-01f, -8.032075315e-01f, 5.907597019e-01f, -8.068475535e-01f,
+	5.857978575e-01f, -8.104571983e-01f, 5.808139581e-01f, -8.140363297e-01f,
+	5.758081914e-01f, -8.175848132e-01f, 5.707807459e-01f, -8.211025150e-01f,
+	5.657318108e-01f, -8.245893028e-01f, 5.606615762e-01f, -8.280450453e-01f,
+	5.555702330e-01f, -8.314696123e-01f, 5.504579729e-01f, -8.348628750e-01f,
+	5.453249884e-01f, -8.382247056e-01f, 5.401714727e-01f, -8.415549774e-01f,
+	5.349976199e-01f, -8.448535652e-01f, 5.298036247e-01f, -8.481203448e-01f,
+	5.245896827e-01f, -8.513551931e-01f, 5.193559902e-01f, -8.545579884e-01f,
+	5.141027442e-01f, -8.577286100e-01f, 5.088301425e-01f, -8.608669386e-01f,
+	5.035383837e-01f, -8.639728561e-01f, 4.982276670e-01f, -8.670462455e-01f,
+	4.928981922e-01f, -8.700869911e-01f, 4.875501601e-01f, -8.730949784e-01f,
+	4.821837721e-01f, -8.760700942e-01f, 4.767992301e-01f, -8.790122264e-01f,
+	4.713967368e-01f, -8.819212643e-01f, 4.659764958e-01f, -8.847970984e-01f,
+	4.605387110e-01f, -8.876396204e-01f, 4.550835871e-01f, -8.904487232e-01f,
+	4.496113297e-01f, -8.932243012e-01f, 4.441221446e-01f, -8.959662498e-01f,
+	4.386162385e-01f, -8.986744657e-01f, 4.330938189e-01f, -9.013488470e-01f,
+	4.275550934e-01f, -9.039892931e-01f, 4.220002708e-01f, -9.065957045e-01f,
+	4.164295601e-01f, -9.091679831e-01f, 4.108431711e-01f, -9.117060320e-01f,
+	4.052413140e-01f, -9.142097557e-01f, 3.996241998e-01f, -9.166790599e-01f,
+	3.939920401e-01f, -9.191138517e-01f, 3.883450467e-01f, -9.215140393e-01f,
+	3.826834324e-01f, -9.238795325e-01f, 3.770074102e-01f, -9.262102421e-01f,
+	3.713171940e-01f, -9.285060805e-01f, 3.656129978e-01f, -9.307669611e-01f,
+	3.598950365e-01f, -9.329927988e-01f, 3.541635254e-01f, -9.351835099e-01f,
+	3.484186802e-01f, -9.373390119e-01f, 3.426607173e-01f, -9.394592236e-01f,
+	3.368898534e-01f, -9.415440652e-01f, 3.311063058e-01f, -9.435934582e-01f,
+	3.253102922e-01f, -9.456073254e-01f, 3.195020308e-01f, -9.475855910e-01f,
+	3.136817404e-01f, -9.495281806e-01f, 3.078496400e-01f, -9.514350210e-01f,
+	3.020059493e-01f, -9.533060404e-01f, 2.961508882e-01f, -9.551411683e-01f,
+	2.902846773e-01f, -9.569403357e-01f, 2.844075372e-01f, -9.587034749e-01f,
+	2.785196894e-01f, -9.604305194e-01f, 2.726213554e-01f, -9.621214043e-01f,
+	2.667127575e-01f, -9.637760658e-01f, 2.607941179e-01f, -9.653944417e-01f,
+	2.548656596e-01f, -9.669764710e-01f, 2.489276057e-01f, -9.685220943e-01f,
+	2.429801799e-01f, -9.700312532e-01f, 2.370236060e-01f, -9.715038910e-01f,
+	2.310581083e-01f, -9.729399522e-01f, 2.250839114e-01f, -9.743393828e-01f,
+	2.191012402e-01f, -9.757021300e-01f, 2.131103199e-01f, -9.770281427e-01f,
+	2.071113762e-01f, -9.783173707e-01f, 2.011046348e-01f, -9.795697657e-01f,
+	1.950903220e-01f, -9.807852804e-01f, 1.890686641e-01f, -9.819638691e-01f,
+	1.830398880e-01f, -9.831054874e-01f, 1.770042204e-01f, -9.842100924e-01f,
+	1.709618888e-01f, -9.852776424e-01f, 1.649131205e-01f, -9.863080972e-01f,
+	1.588581433e-01f, -9.873014182e-01f, 1.527971853e-01f, -9.882575677e-01f,
+	1.467304745e-01f, -9.891765100e-01f, 1.406582393e-01f, -9.900582103e-01f,
+	1.345807085e-01f, -9.909026354e-01f, 1.284981108e-01f, -9.917097537e-01f,
+	1.224106752e-01f, -9.924795346e-01f, 1.163186309e-01f, -9.932119492e-01f,
+	1.102222073e-01f, -9.939069700e-01f, 1.041216339e-01f, -9.945645707e-01f,
+	9.801714033e-02f, -9.951847267e-01f, 9.190895650e-02f, -9.957674145e-01f,
+	8.579731234e-02f, -9.963126122e-01f, 7.968243797e-02f, -9.968202993e-01f,
+	7.356456360e-02f, -9.972904567e-01f, 6.744391956e-02f, -9.977230666e-01f,
+	6.132073630e-02f, -9.981181129e-01f, 5.519524435e-02f, -9.984755806e-01f,
+	4.906767433e-02f, -9.987954562e-01f, 4.293825693e-02f, -9.990777278e-01f,
+	3.680722294e-02f, -9.993223846e-01f, 3.067480318e-02f, -9.995294175e-01f,
+	2.454122852e-02f, -9.996988187e-01f, 1.840672991e-02f, -9.998305818e-01f,
+	1.227153829e-02f, -9.999247018e-01f, 6.135884649e-03f, -9.999811753e-01f,
+};
+
+#pragma DATA_SECTION(fftWindowHann1024, ".const:fftWindowHann1024")
+const float32_t fftWindowHann1024[1024] =
+{
+	0.000000000e+00f, 9.412358699e-06f, 3.764908043e-05f, 8.470910209e-05f,
+	1.505906519e-04f, 2.352912495e-04f, 3.388077058e-04f, 4.611361237e-04f,
+	6.022718974e-04f, 7.622097134e-04f, 9.409435499e-04f, 1.138466678e-03f,
+	1.354771661e-03f, 1.589850354e-03f, 1.843693909e-03f, 2.116292766e-03f,
+	2.407636664e-03f, 2.717714633e-03f, 3.046514999e-03f, 3.394025383e-03f,
+	3.760232701e-03f, 4.145123165e-03f, 4.548682286e-03f, 4.970894869e-03f,
+	5.411745018e-03f, 5.871216135e-03f, 6.349290921e-03f, 6.845951378e-03f,
+	7.361178806e-03f, 7.894953807e-03f, 8.447256284e-03f, 9.018065445e-03f,
+	9.607359798e-03f, 1.021511716e-02f, 1.084131464e-02f, 1.148592867e-02f,
+	1.214893498e-02f, 1.283030861e-02f, 1.353002390e-02f, 1.424805451e-02f,
+	1.498437340e-02f, 1.573895286e-02f, 1.651176448e-02f, 1.730277915e-02f,
+	1.811196710e-02f, 1.893929787e-02f, 1.978474029e-02f, 2.064826255e-02f,
+	2.152983213e-02f, 2.242941585e-02f, 2.334697982e-02f, 2.428248952e-02f,
+	2.523590970e-02f, 2.620720449e-02f, 2.719633731e-02f, 2.820327092e-02f,
+	2.922796741e-02f, 3.027038820e-02f, 3.133049404e-02f, 3.240824503e-02f,
+	3.350360058e-02f, 3.461651946e-02f, 3.574695976e-02f, 3.689487893e-02f,
+	3.806023374e-02f, 3.924298033e-02f, 4.044307415e-02f, 4.166047004e-02f,
+	4.289512215e-02f, 4.414698400e-02f, 4.541600845e-02f, 4.670214774e-02f,
+	4.800535344e-02f, 4.932557648e-02f, 5.066276715e-02f, 5.201687512e-02f,
+	5.338784940e-02f, 5.477563838e-02f, 5.618018980e-02f, 5.760145078e-02f,
+	5.903936783e-02f, 6.049388679e-02f, 6.196495290e-02f, 6.345251079e-02f,
+	6.495650445e-02f, 6.647687724e-02f, 6.801357194e-02f, 6.956653068e-02f,
+	7.113569500e-02f, 7.272100582e-02f, 7.432240345e-02f, 7.593982760e-02f,
+	7.757321738e-02f, 7.922251128e-02f, 8.088764722e-02f, 8.256856251e-02f,
+	8.426519385e-02f, 8.597747737e-02f, 8.770534861e-02f, 8.944874250e-02f,
+	9.120759342e-02f, 9.298183515e-02f, 9.477140087e-02f, 9.657622323e-02f,
+	9.839623426e-02f, 1.002313654e-01f, 1.020815477e-01f, 1.039467113e-01f,
+	1.058267862e-01f, 1.077217014e-01f, 1.096313857e-01f, 1.115557672e-01f,
+	1.134947733e-01f, 1.154483312e-01f, 1.174163672e-01f, 1.193988073e-01f,
+	1.213955767e-01f, 1.234066005e-01f, 1.254318027e-01f, 1.274711073e-01f,
+	1.295244373e-01f, 1.315917156e-01f, 1.336728642e-01f, 1.357678048e-01f,
+	1.378764585e-01f, 1.399987460e-01f, 1.421345874e-01f, 1.442839021e-01f,
+	1.464466094e-01f, 1.486226278e-01f, 1.508118753e-01f, 1.530142696e-01f,
+	1.552297276e-01f, 1.574581661e-01f, 1.596995011e-01f, 1.619536482e-01f,
+	1.642205226e-01f, 1.665000388e-01f, 1.687921112e-01f, 1.710966534e-01f,
+	1.734135785e-01f, 1.757427995e-01f, 1.780842286e-01f, 1.804377776e-01f,
+	1.828033579e-01f, 1.851808805e-01f, 1.875702559e-01f, 1.899713941e-01f,
+	1.923842047e-01f, 1.948085969e-01f, 1.972444793e-01f, 1.996917603e-01f,
+	2.021503478e-01f, 2.046201491e-01f, 2.071010713e-01f, 2.095930210e-01f,
+	2.120959043e-01f, 2.146096271e-01f, 2.171340946e-01f, 2.196692119e-01f,
+	2.222148835e-01f, 2.247710135e-01f, 2.273375058e-01f, 2.299142636e-01f,
+	2.325011901e-01f, 2.350981877e-01f, 2.377051587e-01f, 2.403220049e-01f,
+	2.429486279e-01f, 2.455849287e-01f, 2.482308081e-01f, 2.508861665e-01f,
+	2.535509039e-01f, 2.562249199e-01f, 2.589081140e-01f, 2.616003850e-01f,
+	2.643016316e-01f, 2.670117521e-01f, 2.697306445e-01f, 2.724582064e-01f,
+	2.751943352e-01f, 2.779389277e-01f, 2.806918807e-01f, 2.834530906e-01f,
+	2.862224533e-01f, 2.889998646e-01f, 2.917852200e-01f, 2.945784145e-01f,
+	2.973793430e-01f, 3.001879001e-01f, 3.030039800e-01f, 3.058274767e-01f,
+	3.086582838e-01f, 3.114962949e-01f, 3.143414030e-01f, 3.171935011e-01f,
+	3.200524817e-01f, 3.229182373e-01f, 3.257906599e-01f, 3.286696413e-01f,
+	3.315550733e-01f, 3.344468471e-01f, 3.373448539e-01f, 3.402489846e-01f,
+	3.431591298e-01f, 3.460751800e-01f, 3.489970253e-01f, 3.519245559e-01f,
+	3.548576614e-01f, 3.577962314e-01f, 3.607401553e-01f, 3.636893223e-01f,
+	3.666436213e-01f, 3.696029410e-01f, 3.725671702e-01f, 3.755361971e-01f,
+	3.785099100e-01f, 3.814881970e-01f, 3.844709459e-01f, 3.874580443e-01f,
+	3.904493799e-01f, 3.934448400e-01f, 3.964443119e-01f, 3.994476826e-01f,
+	4.024548390e-01f, 4.054656679e-01f, 4.084800560e-01f, 4.114978898e-01f,
+	4.145190556e-01f, 4.175434398e-01f, 4.205709283e-01f, 4.236014074e-01f,
+	4.266347628e-01f, 4.296708803e-01f, 4.327096457e-01f, 4.357509446e-01f,
+	4.387946624e-01f, 4.418406845e-01f, 4.448888964e-01f, 4.479391831e-01f,
+	4.509914298e-01f, 4.540455218e-01f, 4.571013438e-01f, 4.601587810e-01f,
+	4.632177182e-01f, 4.662780402e-01f, 4.693396318e-01f, 4.724023778e-01f,
+	4.754661628e-01f, 4.785308715e-01f, 4.815963885e-01f, 4.846625984e-01f,
+	4.877293857e-01f, 4.907966350e-01f, 4.938642309e-01f, 4.969320577e-01f,
+	5.000000000e-01f, 5.030679423e-01f, 5.061357691e-01f, 5.092033650e-01f,
+	5.122706143e-01f, 5.153374016e-01f, 5.184036115e-01f, 5.214691285e-01f,
+	5.245338372e-01f, 5.275976222e-01f, 5.306603682e-01f, 5.337219598e-01f,
+	5.367822818e-01f, 5.398412190e-01f, 5.428986562e-01f, 5.459544782e-01f,
+	5.490085702e-01f, 5.520608169e-01f, 5.551111036e-01f, 5.581593155e-01f,
+	5.612053376e-01f, 5.642490554e-01f, 5.672903543e-01f, 5.703291197e-01f,
+	5.733652372e-01f, 5.763985926e-01f, 5.794290717e-01f, 5.824565602e-01f,
+	5.854809444e-01f, 5.885021102e-01f, 5.915199440e-01f, 5.945343321e-01f,
+	5.975451610e-01f, 6.005523174e-01f, 6.035556881e-01f, 6.065551600e-01f,
+	6.095506201e-01f, 6.125419557e-01f, 6.155290541e-01f, 6.185118030e-01f,
+	6.214900900e-01f, 6.244638029e-01f, 6.274328298e-01f, 6.303970590e-01f,
+	6.333563787e-01f, 6.363106777e-01f, 6.392598447e-01f, 6.422037686e-01f,
+	6.451423386e-01f, 6.480754441e-01f, 6.510029747e-01f, 6.539248200e-01f,
+	6.568408702e-01f, 6.597510154e-01f, 6.626551461e-01f, 6.655531529e-01f,
+	6.684449267e-01f, 6.713303587e-01f, 6.742093401e-01f, 6.770817627e-01f,
+	6.799475183e-01f, 6.828064989e-01f, 6.856585970e-01f, 6.885037051e-01f,
+	6.913417162e-01f, 6.941725233e-01f, 6.969960200e-01f, 6.998120999e-01f,
+	7.026206570e-01f, 7.054215855e-01f, 7.082147800e-01f, 7.110001354e-01f,
+	7.137775467e-01f, 7.165469094e-01f, 7.193081193e-01f, 7.220610723e-01f,
+	7.248056648e-01f, 7.275417936e-01f, 7.302693555e-01f, 7.329882479e-01f,
+	7.356983684e-01f, 7.383996150e-01f, 7.410918860e-01f, 7.437750801e-01f,
+	7.464490961e-01f, 7.491138335e-01f, 7.517691919e-01f, 7.544150713e-01f,
+	7.570513721e-01f, 7.596779951e-01f, 7.622948413e-01f, 7.649018123e-01f,
+	7.674988099e-01f, 7.700857364e-01f, 7.726624942e-01f, 7.752289865e-01f,
+	7.777851165e-01f, 7.803307881e-01f, 7.828659054e-01f, 7.853903729e-01f,
+	7.879040957e-01f, 7.904069790e-01f, 7.928989287e-01f, 7.953798509e-01f,
+	7.978496522e-01f, 8.003082397e-01f, 8.027555207e-01f, 8.051914031e-01f,
+	8.076157953e-01f, 8.100286059e-01f, 8.124297441e-01f, 8.148191195e-01f,
+	8.171966421e-01f, 8.195622224e-01f, 8.219157714e-01f, 8.242572005e-01f,
+	8.265864215e-01f, 8.289033466e-01f, 8.312078888e-01f, 8.334999612e-01f,
+	8.357794774e-01f, 8.380463518e-01f, 8.403004989e-01f, 8.425418339e-01f,
+	8.447702724e-01f, 8.469857304e-01f, 8.491881247e-01f, 8.513773722e-01f,
+	8.535533906e-01f, 8.557160979e-01f, 8.578654126e-01f, 8.600012540e-01f,
+	8.621235415e-01f, 8.642321952e-01f, 8.663271358e-01f, 8.684082844e-01f,
+	8.704755627e-01f, 8.725288927e-01f, 8.745681973e-01f, 8.765933995e-01f,
+	8.786044233e-01f, 8.806011927e-01f, 8.825836328e-01f, 8.845516688e-01f,
+	8.865052267e-01f, 8.884442328e-01f, 8.903686143e-01f, 8.922782986e-01f,
+	8.941732138e-01f, 8.960532887e-01f, 8.979184523e-01f, 8.997686346e-01f,
+	9.016037657e-01f, 9.034237768e-01f, 9.052285991e-01f, 9.070181649e-01f,
+	9.087924066e-01f, 9.105512575e-01f, 9.122946514e-01f, 9.140225226e-01f,
+	9.157348062e-01f, 9.174314375e-01f, 9.191123528e-01f, 9.207774887e-01f,
+	9.224267826e-01f, 9.240601724e-01f, 9.256775966e-01f, 9.272789942e-01f,
+	9.288643050e-01f, 9.304334693e-01f, 9.319864281e-01f, 9.335231228e-01f,
+	9.350434956e-01f, 9.365474892e-01f, 9.380350471e-01f, 9.395061132e-01f,
+	9.409606322e-01f, 9.423985492e-01f, 9.438198102e-01f, 9.452243616e-01f,
+	9.466121506e-01f, 9.479831249e-01f, 9.493372328e-01f, 9.506744235e-01f,
+	9.519946466e-01f, 9.532978523e-01f, 9.545839915e-01f, 9.558530160e-01f,
+	9.571048779e-01f, 9.583395300e-01f, 9.595569258e-01f, 9.607570197e-01f,
+	9.619397663e-01f, 9.631051211e-01f, 9.642530402e-01f, 9.653834805e-01f,
+	9.664963994e-01f, 9.675917550e-01f, 9.686695060e-01f, 9.697296118e-01f,
+	9.707720326e-01f, 9.717967291e-01f, 9.728036627e-01f, 9.737927955e-01f,
+	9.747640903e-01f, 9.757175105e-01f, 9.766530202e-01f, 9.775705842e-01f,
+	9.784701679e-01f, 9.793517374e-01f, 9.802152597e-01f, 9.810607021e-01f,
+	9.818880329e-01f, 9.826972208e-01f, 9.834882355e-01f, 9.842610471e-01f,
+	9.850156266e-01f, 9.857519455e-01f, 9.864699761e-01f, 9.871696914e-01f,
+	9.878510650e-01f, 9.885140713e-01f, 9.891586854e-01f, 9.897848828e-01f,
+	9.903926402e-01f, 9.909819346e-01f, 9.915527437e-01f, 9.921050462e-01f,
+	9.926388212e-01f, 9.931540486e-01f, 9.936507091e-01f, 9.941287839e-01f,
+	9.945882550e-01f, 9.950291051e-01f, 9.954513177e-01f, 9.958548768e-01f,
+	9.962397673e-01f, 9.966059746e-01f, 9.969534850e-01f, 9.972822854e-01f,
+	9.975923633e-01f, 9.978837072e-01f, 9.981563061e-01f, 9.984101496e-01f,
+	9.986452283e-01f, 9.988615333e-01f, 9.990590565e-01f, 9.992377903e-01f,
+	9.993977281e-01f, 9.995388639e-01f, 9.996611923e-01f, 9.997647088e-01f,
+	9.998494093e-01f, 9.999152909e-01f, 9.999623509e-01f, 9.999905876e-01f,
+	1.000000000e+00f, 9.999905876e-01f, 9.999623509e-01f, 9.999152909e-01f,
+	9.998494093e-01f, 9.997647088e-01f, 9.996611923e-01f, 9.995388639e-01f,
+	9.993977281e-01f, 9.992377903e-01f, 9.990590565e-01f, 9.988615333e-01f,
+	9.986452283e-01f, 9.984101496e-01f, 9.981563061e-01f, 9.978837072e-01f,
+	9.975923633e-01f, 9.972822854e-01f, 9.969534850e-01f, 9.966059746e-01f,
+	9.962397673e-01f, 9.958548768e-01f, 9.954513177e-01f, 9.950291051e-01f,
+	9.945882550e-01f, 9.941287839e-01f, 9.936507091e-01f, 9.931540486e-01f,
+	9.926388212e-01f, 9.921050462e-01f, 9.915527437e-01f, 9.909819346e-01f,
+	9.903926402e-01f, 9.897848828e-01f, 9.891586854e-01f, 9.885140713e-01f,
+	9.878510650e-01f, 9.871696914e-01f, 9.864699761e-01f, 9.857519455e-01f,
+	9.850156266e-01f, 9.842610471e-01f, 9.834882355e-01f, 9.826972208e-01f,
+	9.818880329e-01f, 9.810607021e-01f, 9.802152597e-01f, 9.793517374e-01f,
+	9.784701679e-01f, 9.775705842e-01f, 9.766530202e-01f, 9.757175105e-01f,
+	9.747640903e-01f, 9.737927955e-01f, 9.728036627e-01f, 9.717967291e-01f,
+	9.707720326e-01f, 9.697296118e-01f, 9.686695060e-01f, 9.675917550e-01f,
+	9.664963994e-01f, 9.653834805e-01f, 9.642530402e-01f, 9.631051211e-01f,
+	9.619397663e-01f, 9.607570197e-01f, 9.595569258e-01f, 9.583395300e-01f,
+	9.571048779e-01f, 9.558530160e-01f, 9.545839915e-01f, 9.532978523e-01f,
+	9.519946466e-01f, 9.506744235e-01f, 9.493372328e-01f, 9.479831249e-01f,
+	9.466121506e-01f, 9.452243616e-01f, 9.438198102e-01f, 9.423985492e-01f,
+	9.409606322e-01f, 9.395061132e-01f, 9.380350471e-01f, 9.365474892e-01f,
+	9.350434956e-01f, 9.335231228e-01f, 9.319864281e-01f, 9.304334693e-01f,
+	9.288643050e-01f, 9.272789942e-01f, 9.256775966e-01f, 9.240601724e-01f,
+	9.224267826e-01f, 9.207774887e-01f, 9.191123528e-01f, 9.174314375e-01f,
+	9.157348062e-01f, 9.140225226e-01f, 9.122946514e-01f, 9.105512575e-01f,
+	9.087924066e-01f, 9.070181649e-01f, 9.052285991e-01f, 9.034237768e-01f,
+	9.016037657e-01f, 8.997686346e-01f, 8.979184523e-01f, 8.960532887e-01f,
+	8.941732138e-01f, 8.922782986e-01f, 8.903686143e-01f, 8.884442328e-01f,
+	8.865052267e-01f, 8.845516688e-01f, 8.825836328e-01f, 8.806011927e-01f,
+	8.786044233e-01f, 8.765933995e-01f, 8.745681973e-01f, 8.725288927e-01f,
+	8.704755627e-01f, 8.684082844e-01f, 8.663271358e-01f, 8.642321952e-01f,
+	8.621235415e-01f, 8.600012540e-01f, 8.578654126e-01f, 8.557160979e-01f,
+	8.535533906e-01f, 8.513773722e-01f, 8.491881247e-01f, 8.469857304e-01f,
+	8.447702724e-01f, 8.425418339e-01f, 8.403004989e-01f, 8.380463518e-01f,
+	8.357794774e-01f, 8.334999612e-01f, 8.312078888e-01f, 8.289033466e-01f,
+	8.265864215e-01f, 8.242572005e-01f, 8.219157714e-01f, 8.195622224e-01f,
+	8.171966421e-01f, 8.148191195e-01f, 8.124297441e-01f, 8.100286059e-01f,
+	8.076157953e-01f, 8.051914031e-01f, 8.027555207e-01f, 8.003082397e-01f,
+	7.978496522e-01f, 7.953798509e-01f, 7.928989287e-01f, 7.904069790e-01f,
+	7.879040957e-01f, 7.853903729e-01f, 7.828659054e-01f, 7.803307881e-01f,
+	7.777851165e-01f, 7.752289865e-01f, 7.726624942e-01f, 7.700857364e-01f,
+	7.674988099e-01f, 7.649018123e-01f, 7.622948413e-01f, 7.596779951e-01f,
+	7.570513721e-01f, 7.544150713e-01f, 7.517691919e-01f, 7.491138335e-01f,
+	7.464490961e-01f, 7.437750801e-01f, 7.410918860e-01f, 7.383996150e-01f,
+	7.356983684e-01f, 7.329882479e-01f, 7.302693555e-01f, 7.275417936e-01f,
+	7.248056648e-01f, 7.220610723e-01f, 7.193081193e-01f, 7.165469094e-01f,
+	7.137775467e-01f, 7.110001354e-01f, 7.082147800e-01f, 7.054215855e-01f,
+	7.026206570e-01f, 6.998120999e-01f, 6.969960200e-01f, 6.941725233e-01f,
+	6.913417162e-01f, 6.885037051e-01f, 6.856585970e-01f, 6.828064989e-01f,
+	6.799475183e-01f, 6.770817627e-01f, 6.742093401e-01f, 6.713303587e-01f,
+	6.684449267e-01f, 6.655531529e-01f, 6.626551461e-01f, 6.597510154e-01f,
+	6.568408702e-01f, 6.539248200e-01f, 6.510029747e-01f, 6.480754441e-01f,
+	6.451423386e-01f, 6.422037686e-01f, 6.392598447e-01f, 6.363106777e-01f,
+	6.333563787e-01f, 6.303970590e-01f, 6.274328298e-01f, 6.244638029e-01f,
+	6.214900900e-01f, 6.185118030e-01f, 6.155290541e-01f, 6.125419557e-01f,
+	6.095506201e-01f, 6.065551600e-01f, 6.035556881e-01f, 6.005523174e-01f,
+	5.975451610e-01f, 5.945343321e-01f, 5.915199440e-01f, 5.885021102e-01f,
+	5.854809444e-01f, 5.824565602e-01f, 5.794290717e-01f, 5.763985926e-01f,
+	5.733652372e-01f, 5.703291197e-01f, 5.672903543e-01f, 5.642490554e-01f,
+	5.612053376e-01f, 5.581593155e-01f, 5.551111036e-01f, 5.520608169e-01f,
+	5.490085702e-01f, 5.459544782e-01f, 5.428986562e-01f, 5.398412190e-01f,
+	5.367822818e-01f, 5.337219598e-01f, 5.306603682e-01f, 5.275976222e-01f,
+	5.245338372e-01f, 5.214691285e-01f, 5.184036115e-01f, 5.153374016e-01f,
+	5.122706143e-01f, 5.092033650e-01f, 5.061357691e-01f, 5.030679423e-01f,
+	5.000000000e-01f, 4.969320577e-01f, 4.938642309e-01f, 4.907966350e-01f,
+	4.877293857e-01f, 4.846625984e-01f, 4.815963885e-01f, 4.785308715e-01f,
+	4.754661628e-01f, 4.724023778e-01f, 4.693396318e-01f, 4.662780402e-01f,
+	4.632177182e-01f, 4.601587810e-01f, 4.571013438e-01f, 4.540455218e-01f,
+	4.509914298e-01f, 4.479391831e-01f, 4.448888964e-01f, 4.418406845e-01f,
+	4.387946624e-01f, 4.357509446e-01f, 4.327096457e-01f, 4.296708803e-01f,
+	4.266347628e-01f, 4.236014074e-01f, 4.205709283e-01f, 4.175434398e-01f,
+	4.145190556e-01f, 4.114978898e-01f, 4.084800560e-01f, 4.054656679e-01f,
+	4.024548390e-01f, 3.994476826e-01f, 3.964443119e-01f, 3.934448400e-01f,
+	3.904493799e-01f, 3.874580443e-01f, 3.844709459e-01f, 3.814881970e-01f,
+	3.785099100e-01f, 3.755361971e-01f, 3.725671702e-01f, 3.696029410e-01f,
+	3.666436213e-01f, 3.636893223e-01f, 3.607401553e-01f, 3.577962314e-01f,
+	3.548576614e-01f, 3.519245559e-01f, 3.489970253e-01f, 3.460751800e-01f,
+	3.431591298e-01f, 3.402489846e-01f, 3.373448539e-01f, 3.344468471e-01f,
+	3.315550733e-01f, 3.286696413e-01f, 3.257906599e-01f, 3.229182373e-01f,
+	3.200524817e-01f, 3.171935011e-01f, 3.143414030e-01f, 3.114962949e-01f,
+	3.086582838e-01f, 3.058274767e-01f, 3.030039800e-01f, 3.001879001e-01f,
+	2.973793430e-01f, 2.945784145e-01f, 2.917852200e-01f, 2.889998646e-01f,
+	2.862224533e-01f, 2.834530906e-01f, 2.806918807e-01f, 2.779389277e-01f,
+	2.751943352e-01f, 2.724582064e-01f, 2.697306445e-01f, 2.670117521e-01f,
+	2.643016316e-01f, 2.616003850e-01f, 2.589081140e-01f, 2.562249199e-01f,
+	2.535509039e-01f, 2.508861665e-01f, 2.482308081e-01f, 2.455849287e-01f,
+	2.429486279e-01f, 2.403220049e-01f, 2.377051587e-01f, 2.350981877e-01f,
+	2.325011901e-01f, 2.299142636e-01f, 2.273375058e-01f, 2.247710135e-01f,
+	2.222148835e-01f, 2.196692119e-01f, 2.171340946e-01f, 2.146096271e-01f,
+	2.120959043e-01f, 2.095930210e-01f, 2.071010713e-01f, 2.046201491e-01f,
+	2.021503478e-01f, 1.996917603e-01f, 1.972444793e-01f, 1.948085969e-01f,
+	1.923842047e-01f, 1.899713941e-01f, 1.875702559e-01f, 1.851808805e-01f,
+	1.828033579e-01f, 1.804377776e-01f, 1.780842286e-01f, 1.757427995e-01f,
+	1.734135785e-01f, 1.710966534e-01f, 1.687921112e-01f, 1.665000388e-01f,
+	1.642205226e-01f, 1.619536482e-01f, 1.596995011e-01f, 1.574581661e-01f,
+	1.552297276e-01f, 1.530142696e-01f, 1.508118753e-01f, 1.486226278e-01f,
+	1.464466094e-01f, 1.442839021e-01f, 1.421345874e-01f, 1.399987460e-01f,
+	1.378764585e-01f, 1.357678048e-01f, 1.336728642e-01f, 1.315917156e-01f,
+	1.295244373e-01f, 1.274711073e-01f, 1.254318027e-01f, 1.234066005e-01f,
+	1.213955767e-01f, 1.193988073e-01f, 1.174163672e-01f, 1.154483312e-01f,
+	1.134947733e-01f, 1.115557672e-01f, 1.096313857e-01f, 1.077217014e-01f,
+	1.058267862e-01f, 1.039467113e-01f, 1.020815477e-01f, 1.002313654e-01f,
+	9.839623426e-02f, 9.657622323e-02f, 9.477140087e-02f, 9.298183515e-02f,
+	9.120759342e-02f, 8.944874250e-02f, 8.770534861e-02f, 8.597747737e-02f,
+	8.426519385e-02f, 8.256856251e-02f, 8.088764722e-02f, 7.922251128e-02f,
+	7.757321738e-02f, 7.593982760e-02f, 7.432240345e-02f, 7.272100582e-02f,
+	7.113569500e-02f, 6.956653068e-02f, 6.801357194e-02f, 6.647687724e-02f,
+	6.495650445e-02f, 6.345251079e-02f, 6.196495290e-02f, 6.049388679e-02f,
+	5.903936783e-02f, 5.760145078e-02f, 5.618018980e-02f, 5.477563838e-02f,
+	5.338784940e-02f, 5.201687512e-02f, 5.066276715e-02f, 4.932557648e-02f,
+	4.800535344e-02f, 4.670214774e-02f, 4.541600845e-02f, 4.414698400e-02f,
+	4.289512215e-02f, 4.166047004e-02f, 4.044307415e-02f, 3.924298033e-02f,
+	3.806023374e-02f, 3.689487893e-02f, 3.574695976e-02f, 3.461651946e-02f,
+	3.350360058e-02f, 3.240824503e-02f, 3.133049404e-02f, 3.027038820e-02f,
+	2.922796741e-02f, 2.820327092e-02f, 2.719633731e-02f, 2.620720449e-02f,
+	2.523590970e-02f, 2.428248952e-02f, 2.334697982e-02f, 2.242941585e-02f,
+	2.152983213e-02f, 2.064826255e-02f, 1.978474029e-02f, 1.893929787e-02f,
+	1.811196710e-02f, 1.730277915e-02f, 1.651176448e-02f, 1.573895286e-02f,
+	1.498437340e-02f, 1.424805451e-02f, 1.353002390e-02f, 1.283030861e-02f,
+	1.214893498e-02f, 1.148592867e-02f, 1.084131464e-02f, 1.021511716e-02f,
+	9.607359798e-03f, 9.018065445e-03f, 8.447256284e-03f, 7.894953807e-03f,
+	7.361178806e-03f, 6.845951378e-03f, 6.349290921e-03f, 5.871216135e-03f,
+	5.411745018e-03f, 4.970894869e-03f, 4.548682286e-03f, 4.145123165e-03f,
+	3.760232701e-03f, 3.394025383e-03f, 3.046514999e-03f, 2.717714633e-03f,
+	2.407636664e-03f, 2.116292766e-03f, 1.843693909e-03f, 1.589850354e-03f,
+	1.354771661e-03f, 1.138466678e-03f, 9.409435499e-04f, 7.622097134e-04f,
+	6.022718974e-04f, 4.611361237e-04f, 3.388077058e-04f, 2.352912495e-04f,
+	1.505906519e-04f, 8.470910209e-05f, 3.764908043e-05f, 9.412358699e-06f,
+};
+
+const arm_rfft_fast_instance_f32 fftPlan1024 =
+{
+	{ 512, fftTwiddle512, armBitRevIndexTable512, ARMBITREVINDEXTABLE_512_TABLE_LENGTH },
+	1024,
+	(float32_t *)fftTwiddleRfft1024
+};
+
+#pragma DATA_SECTION(fftTwiddle1024, ".const:fftTwiddle1024")
+const float32_t fftTwiddle1024[2048] =
+{
+	1.000000000e+00f, 0.000000000e+00f, 9.999811753e-01f, 6.135884649e-03f,
+	9.999247018e-01f, 1.227153829e-02f, 9.998305818e-01f, 1.840672991e-02f,
+	9.996988187e-01f, 2.454122852e-02f, 9.995294175e-01f, 3.067480318e-02f,
+	9.993223846e-01f, 3.680722294e-02f, 9.990777278e-01f, 4.293825693e-02f,
+	9.987954562e-01f, 4.906767433e-02f, 9.984755806e-01f, 5.519524435e-02f,
+	9.981181129e-01f, 6.132073630e-02f, 9.977230666e-01f, 6.744391956e-02f,
+	9.972904567e-01f, 7.356456360e-02f, 9.968202993e-01f, 7.968243797e-02f,
+	9.963126122e-01f, 8.579731234e-02f, 9.957674145e-01f, 9.190895650e-02f,
+	9.951847267e-01f, 9.801714033e-02f, 9.945645707e-01f, 1.041216339e-01f,
+	9.939069700e-01f, 1.102222073e-01f, 9.932119492e-01f, 1.163186309e-01f,
+	9.924795346e-01f, 1.224106752e-01f, 9.917097537e-01f, 1.284981108e-01f,
+	9.909026354e-01f, 1.345807085e-01f, 9.900582103e-01f, 1.406582393e-01f,
+	9.891765100e-01f, 1.467304745e-01f, 9.882575677e-01f, 1.527971853e-01f,
+	9.873014182e-01f, 1.588581433e-01f, 9.863080972e-01f, 1.649131205e-01f,
+	9.852776424e-01f, 1.709618888e-01f, 9.842100924e-01f, 1.770042204e-01f,
+	9.831054874e-01f, 1.830398880e-01f, 9.819638691e-01f, 1.890686641e-01f,
+	9.807852804e-01f, 1.950903220e-01f, 9.795697657e-01f, 2.011046348e-01f,
+	9.783173707e-01f, 2.071113762e-01f, 9.770281427e-01f, 2.131103199e-01f,
+	9.757021300e-01f, 2.191012402e-01f, 9.743393828e-01f, 2.250839114e-01f,
+	9.729399522e-01f, 2.310581083e-01f, 9.715038910e-01f, 2.370236060e-01f,
+	9.700312532e-01f, 2.429801799e-01f, 9.685220943e-01f, 2.489276057e-01f,
+	9.669764710e-01f, 2.548656596e-01f, 9.653944417e-01f, 2.607941179e-01f,
+	9.637760658e-01f, 2.667127575e-01f, 9.621214043e-01f, 2.726213554e-01f,
+	9.604305194e-01f, 2.785196894e-01f, 9.587034749e-01f, 2.844075372e-01f,
+	9.569403357e-01f, 2.902846773e-01f, 9.551411683e-01f, 2.961508882e-01f,
+	9.533060404e-01f, 3.020059493e-01f, 9.514350210e-01f, 3.078496400e-01f,
+	9.495281806e-01f, 3.136817404e-01f, 9.475855910e-01f, 3.195020308e-01f,
+	9.456073254e-01f, 3.253102922e-01f, 9.435934582e-01f, 3.311063058e-01f,
+	9.415440652e-01f, 3.368898534e-01f, 9.394592236e-01f, 3.426607173e-01f,
+	9.373390119e-01f, 3.484186802e-01f, 9.351835099e-01f, 3.541635254e-01f,
+	9.329927988e-01f, 3.598950365e-01f, 9.307669611e-01f, 3.656129978e-01f,
+	9.285060805e-01f, 3.713171940e-01f, 9.262102421e-01f, 3.770074102e-01f,
+	9.238795325e-01f, 3.826834324e-01f, 9.215140393e-01f, 3.883450467e-01f,
+	9.191138517e-01f, 3.939920401e-01f, 9.166790599e-01f, 3.996241998e-01f,
+	9.142097557e-01f, 4.052413140e-01f, 9.117060320e-01f, 4.108431711e-01f,
+	9.091679831e-01f, 4.164295601e-01f, 9.065957045e-01f, 4.220002708e-01f,
+	9.039892931e-01f, 4.275550934e-01f, 9.013488470e-01f, 4.330938189e-01f,
+	8.986744657e-01f, 4.386162385e-01f, 8.959662498e-01f, 4.441221446e-01f,
+	8.932243012e-01f, 4.496113297e-01f, 8.904487232e-01f, 4.550835871e-01f,
+	8.876396204e-01f, 4.605387110e-01f, 8.847970984e-01f, 4.659764958e-01f,
+	8.819212643e-01f, 4.713967368e-01f, 8.790122264e-01f, 4.767992301e-01f,
+	8.760700942e-01f, 4.821837721e-01f, 8.730949784e-01f, 4.875501601e-01f,
+	8.700869911e-01f, 4.928981922e-01f, 8.670462455e-01f, 4.982276670e-01f,
+	8.639728561e-01f, 5.035383837e-01f, 8.608669386e-01f, 5.088301425e-01f,
+	8.577286100e-01f, 5.141027442e-01f, 8.545579884e-01f, 5.193559902e-01f,
+	8.513551931e-01f, 5.245896827e-01f, 8.481203448e-01f, 5.298036247e-01f,
+	8.448535652e-01f, 5.349976199e-01f, 8.415549774e-01f, 5.401714727e-01f,
+	8.382247056e-01f, 5.453249884e-01f, 8.348628750e-01f, 5.504579729e-01f,
+	8.314696123e-01f, 5.555702330e-01f, 8.280450453e-01f, 5.606615762e-01f,
+	8.245893028e-01f, 5.657318108e-01f, 8.211025150e-01f, 5.707807459e-01f,
+	8.175848132e-01f, 5.758081914e-01f, 8.140363297e-01f, 5.808139581e-01f,
+	8.104571983e-01f, 5.857978575e-01f, 8.068475535e-01f, 5.907597019e-01f,
+	8.032075315e-01f, 5.956993045e-01f, 7.995372691e-01f, 6.006164794e-01f,
+	7.958369046e-01f, 6.055110414e-01f, 7.921065773e-01f, 6.103828063e-01f,
+	7.883464276e-01f, 6.152315906e-01f, 7.845565972e-01f, 6.200572118e-01f,
+	7.807372286e-01f, 6.248594881e-01f, 7.768884657e-01f, 6.296382389e-01f,
+	7.730104534e-01f, 6.343932842e-01f, 7.691033376e-01f, 6.391244449e-01f,
+	7.651672656e-01f, 6.438315429e-01f, 7.612023855e-01f, 6.485144010e-01f,
+	7.572088465e-01f, 6.531728430e-01f, 7.531867990e-01f, 6.578066933e-01f,
+	7.491363945e-01f, 6.624157776e-01f, 7.450577854e-01f, 6.669999223e-01f,
+	7.409511254e-01f, 6.715589548e-01f, 7.368165689e-01f, 6.760927036e-01f,
+	7.326542717e-01f, 6.806009978e-01f, 7.284643904e-01f, 6.850836678e-01f,
+	7.242470830e-01f, 6.895405447e-01f, 7.200025080e-01f, 6.939714609e-01f,
+	7.157308253e-01f, 6.983762494e-01f, 7.114321957e-01f, 7.027547445e-01f,
+	7.071067812e-01f, 7.071067812e-01f, 7.027547445e-01f, 7.114321957e-01f,
+	6.983762494e-01f, 7.157308253e-01f, 6.939714609e-01f, 7.200025080e-01f,
+	6.895405447e-01f, 7.242470830e-01f, 6.850836678e-01f, 7.284643904e-01f,
+	6.806009978e-01f, 7.326542717e-01f, 6.760927036e-01f, 7.368165689e-01f,
+	6.715589548e-01f, 7.409511254e-01f, 6.669999223e-01f, 7.450577854e-01f,
+	6.624157776e-01f, 7.491363945e-01f, 6.578066933e-01f, 7.531867990e-01f,
+	6.531728430e-01f, 7.572088465e-01f, 6.485144010e-01f, 7.612023855e-01f,
+	6.438315429e-01f, 7.651672656e-01f, 6.391244449e-01f, 7.691033376e-01f,
+	6.343932842e-01f, 7.730104534e-01f, 6.296382389e-01f, 7.768884657e-01f,
+	6.248594881e-01f, 7.807372286e-01f, 6.200572118e-01f, 7.845565972e-01f,
+	6.152315906e-01f, 7.883464276e-01f, 6.103828063e-01f, 7.921065773e-01f,
+	6.055110414e-01f, 7.958369046e-01f, 6.006164794e-01f, 7.995372691e-01f,
+	5.956993045e-01f, 8.032075315e-01f, 5.907597019e-01f, 8.068475535e-01f,
+	5.857978575e-01f, 8.104571983e-01f, 5.808139581e-01f, 8.140363297e-01f,
+	5.758081914e-01f, 8.175848132e-01f, 5.707807459e-01f, 8.211025150e-01f,
+	5.657318108e-01f, 8.245893028e-01f, 5.606615762e-01f, 8.280450453e-01f,
+	5.555702330e-01f, 8.314696123e-01f, 5.504579729e-01f, 8.348628750e-01f,
+	5.453249884e-01f, 8.382247056e-01f, 5.401714727e-01f, 8.415549774e-01f,
+	5.349976199e-01f, 8.448535652e-01f, 5.298036247e-01f, 8.481203448e-01f,
+	5.245896827e-01f, 8.513551931e-01f, 5.193559902e-01f, 8.545579884e-01f,
+	5.141027442e-01f, 8.577286100e-01f, 5.088301425e-01f, 8.608669386e-01f,
+	5.035383837e-01f, 8.639728561e-01f, 4.982276670e-01f, 8.670462455e-01f,
+	4.928981922e-01f, 8.700869911e-01f, 4.875501601e-01f, 8.730949784e-01f,
+	4.821837721e-01f, 8.760700942e-01f, 4.767992301e-01f, 8.790122264e-01f,
+	4.713967368e-01f, 8.819212643e-01f, 4.659764958e-01f, 8.847970984e-01f,
+	4.605387110e-01f, 8.876396204e-01f, 4.550835871e-01f, 8.904487232e-01f,
+	4.496113297e-01f, 8.932243012e-01f, 4.441221446e-01f, 8.959662498e-01f,
+	4.386162385e-01f, 8.986744657e-01f, 4.330938189e-01f, 9.013488470e-01f,
+	4.275550934e-01f, 9.039892931e-01f, 4.220002708e-01f, 9.065957045e-01f,
+	4.164295601e-01f, 9.091679831e-01f, 4.108431711e-01f, 9.117060320e-01f,
+	4.052413140e-01f, 9.142097557e-01f, 3.996241998e-01f, 9.166790599e-01f,
+	3.939920401e-01f, 9.191138517e-01f, 3.883450467e-01f, 9.215140393e-01f,
+	3.826834324e-01f, 9.238795325e-01f, 3.770074102e-01f, 9.262102421e-01f,
+	3.713171940e-01f, 9.285060805e-01f, 3.656129978e-01f, 9.307669611e-01f,
+	3.598950365e-01f, 9.329927988e-01f, 3.541635254e-01f, 9.351835099e-01f,
+	3.484186802e-01f, 9.373390119e-01f, 3.426607173e-01f, 9.394592236e-01f,
+	3.368898534e-01f, 9.415440652e-01f, 3.311063058e-01f, 9.435934582e-01f,
+	3.253102922e-01f, 9.456073254e-01f, 3.195020308e-01f, 9.475855910e-01f,
+	3.136817404e-01f, 9.495281806e-01f, 3.078496400e-01f, 9.514350210e-01f,
+	3.020059493e-01f, 9.533060404e-01f, 2.961508882e-01f, 9.551411683e-01f,
+	2.902846773e-01f, 9.569403357e-01f, 2.844075372e-01f, 9.587034749e-01f,
+	2.785196894e-01f, 9.604305194e-01f, 2.726213554e-01f, 9.621214043e-01f,
+	2.667127575e-01f, 9.637760658e-01f, 2.607941179e-01f, 9.653944417e-01f,
+	2.548656596e-01f, 9.669764710e-01f, 2.489276057e-01f, 9.685220943e-01f,
+	2.429801799e-01f, 9.700312532e-01f, 2.370236060e-01f, 9.715038910e-01f,
+	2.310581083e-01f, 9.729399522e-01f, 2.250839114e-01f, 9.743393828e-01f,
+	2.191012402e-01f, 9.757021300e-01f, 2.131103199e-01f, 9.770281427e-01f,
+	2.071113762e-01f, 9.783173707e-01f, 2.011046348e-01f, 9.795697657e-01f,
+	1.950903220e-01f, 9.807852804e-01f, 1.890686641e-01f, 9.819638691e-01f,
+	1.830398880e-01f, 9.831054874e-01f, 1.770042204e-01f, 9.842100924e-01f,
+	1.709618888e-01f, 9.852776424e-01f, 1.649131205e-01f, 9.863080972e-01f,
+	1.588581433e-01f, 9.873014182e-01f, 1.527971853e-01f, 9.882575677e-01f,
+	1.467304745e-01f, 9.891765100e-01f, 1.406582393e-01f, 9.900582103e-01f,
+	1.345807085e-01f, 9.909026354e-01f, 1.284981108e-01f, 9.917097537e-01f,
+	1.224106752e-01f, 9.924795346e-01f, 1.163186309e-01f, 9.932119492e-01f,
+	1.102222073e-01f, 9.939069700e-01f, 1.041216339e-01f, 9.945645707e-01f,
+	9.801714033e-02f, 9.951847267e-01f, 9.190895650e-02f, 9.957674145e-01f,
+	8.579731234e-02f, 9.963126122e-01f, 7.968243797e-02f, 9.968202993e-01f,
+	7.356456360e-02f, 9.972904567e-01f, 6.744391956e-02f, 9.977230666e-01f,
+	6.132073630e-02f, 9.981181129e-01f, 5.519524435e-02f, 9.984755806e-01f,
+	4.906767433e-02f, 9.987954562e-01f, 4.293825693e-02f, 9.990777278e-01f,
+	3.680722294e-02f, 9.993223846e-01f, 3.067480318e-02f, 9.995294175e-01f,
+	2.454122852e-02f, 9.996988187e-01f, 1.840672991e-02f, 9.998305818e-01f,
+	1.227153829e-02f, 9.999247018e-01f, 6.135884649e-03f, 9.999811753e-01f,
+	6.123233996e-17f, 1.000000000e+00f, -6.135884649e-03f, 9.999811753e-01f,
+	-1.227153829e-02f, 9.999247018e-01f, -1.840672991e-02f, 9.998305818e-01f,
+	-2.454122852e-02f, 9.996988187e-01f, -3.067480318e-02f, 9.995294175e-01f,
+	-3.680722294e-02f, 9.993223846e-01f, -4.293825693e-02f, 9.990777278e-01f,
+	-4.906767433e-02f, 9.987954562e-01f, -5.519524435e-02f, 9.984755806e-01f,
+	-6.132073630e-02f, 9.981181129e-01f, -6.744391956e-02f, 9.977230666e-01f,
+	-7.356456360e-02f, 9.972904567e-01f, -7.968243797e-02f, 9.968202993e-01f,
+	-8.579731234e-02f, 9.963126122e-01f, -9.190895650e-02f, 9.957674145e-01f,
+	-9.801714033e-02f, 9.951847267e-01f, -1.041216339e-01f, 9.945645707e-01f,
+	-1.102222073e-01f, 9.939069700e-01f, -1.163186309e-01f, 9.932119492e-01f,
+	-1.224106752e-01f, 9.924795346e-01f, -1.284981108e-01f, 9.917097537e-01f,
+	-1.345807085e-01f, 9.909026354e-01f, -1.406582393e-01f, 9.900582103e-01f,
+	-1.467304745e-01f, 9.891765100e-01f, -1.527971853e-01f, 9.882575677e-01f,
+	-1.588581433e-01f, 9.873014182e-01f, -1.649131205e-01f, 9.863080972e-01f,
+	-1.709618888e-01f, 9.852776424e-01f, -1.770042204e-01f, 9.842100924e-01f,
+	-1.830398880e-01f, 9.831054874e-01f, -1.890686641e-01f, 9.819638691e-01f,
+	-1.950903220e-01f, 9.807852804e-01f, -2.011046348e-01f, 9.795697657e-01f,
+	-2.071113762e-01f, 9.783173707e-01f, -2.131103199e-01f, 9.770281427e-01f,
+	-2.191012402e-01f, 9.757021300e-01f, -2.250839114e-01f, 9.743393828e-01f,
+	-2.310581083e-01f, 9.729399522e-01f, -2.370236060e-01f, 9.715038910e-01f,
+	-2.429801799e-01f, 9.700312532e-01f, -2.489276057e-01f, 9.685220943e-01f,
+	-2.548656596e-01f, 9.669764710e-01f, -2.607941179e-01f, 9.653944417e-01f,
+	-2.667127575e-01f, 9.637760658e-01f, -2.726213554e-01f, 9.621214043e-01f,
+	-2.785196894e-01f, 9.604305194e-01f, -2.844075372e-01f, 9.587034749e-01f,
+	-2.902846773e-01f, 9.569403357e-01f, -2.961508882e-01f, 9.551411683e-01f,
+	-3.020059493e-01f, 9.533060404e-01f, -3.078496400e-01f, 9.514350210e-01f,
+	-3.136817404e-01f, 9.495281806e-01f, -3.195020308e-01f, 9.475855910e-01f,
+	-3.253102922e-01f, 9.456073254e-01f, -3.311063058e-01f, 9.435934582e-01f,
+	-3.368898534e-01f, 9.415440652e-01f, -3.426607173e-01f, 9.394592236e-01f,
+	-3.484186802e-01f, 9.373390119e-01f, -3.541635254e-01f, 9.351835099e-01f,
+	-3.598950365e-01f, 9.329927988e-01f, -3.656129978e-01f, 9.307669611e-01f,
+	-3.713171940e-01f, 9.285060805e-01f, -3.770074102e-01f, 9.262102421e-01f,
+	-3.826834324e-01f, 9.238795325e-01f, -3.883450467e-01f, 9.215140393e-01f,
+	-3.939920401e-01f, 9.191138517e-01f, -3.996241998e-01f, 9.166790599e-01f,
+	-4.052413140e-01f, 9.142097557e-01f, -4.108431711e-01f, 9.117060320e-01f,
+	-4.164295601e-01f, 9.091679831e-01f, -4.220002708e-01f, 9.065957045e-01f,
+	-4.275550934e-01f, 9.039892931e-01f, -4.330938189e-01f, 9.013488470e-01f,
+	-4.386162385e-01f, 8.986744657e-01f, -4.441221446e-01f, 8.959662498e-01f,
+	-4.496113297e-01f, 8.932243012e-01f, -4.550835871e-01f, 8.904487232e-01f,
+	-4.605387110e-01f, 8.876396204e-01f, -4.659764958e-01f, 8.847970984e-01f,
+	-4.713967368e-01f, 8.819212643e-01f, -4.767992301e-01f, 8.790122264e-01f,
+	-4.821837721e-01f, 8.760700942e-01f, -4.875501601e-01f, 8.730949784e-01f,
+	-4.928981922e-01f, 8.700869911e-01f, -4.982276670e-01f, 8.670462455e-01f,
+	-5.035383837e-01f, 8.639728561e-01f, -5.088301425e-01f, 8.608669386e-01f,
+	-5.141027442e-01f, 8.577286100e-01f, -5.193559902e-01f, 8.545579884e-01f,
+	-5.245896827e-01f, 8.513551931e-01f, -5.298036247e-01f, 8.481203448e-01f,
+	-5.349976199e-01f, 8.448535652e-01f, -5.401714727e-01f, 8.415549774e-01f,
+	-5.453249884e-01f, 8.382247056e-01f, -5.504579729e-01f, 8.348628750e-01f,
+	-5.555702330e-01f, 8.314696123e-01f, -5.606615762e-01f, 8.280450453e-01f,
+	-5.657318108e-01f, 8.245893028e-01f, -5.707807459e-01f, 8.211025150e-01f,
+	-5.758081914e-01f, 8.175848132e-01f, -5.808139581e-01f, 8.140363297e-01f,
+	-5.857978575e-01f, 8.104571983e-01f, -5.907597019e-01f, 8.068475535e-01f,
+	-5.956993045e-01f, 8.032075315e-01f, -6.006164794e-01f, 7.995372691e-01f,
+	-6.055110414e-01f, 7.958369046e-01f, -6.103828063e-01f, 7.921065773e-01f,
+	-6.152315906e-01f, 7.883464276e-01f, -6.200572118e-01f, 7.845565972e-01f,
+	-6.248594881e-01f, 7.807372286e-01f, -6.296382389e-01f, 7.768884657e-01f,
+	-6.343932842e-01f, 7.730104534e-01f, -6.391244449e-01f, 7.691033376e-01f,
+	-6.438315429e-01f, 7.651672656e-01f, -6.485144010e-01f, 7.612023855e-01f,
+	-6.531728430e-01f, 7.572088465e-01f, -6.578066933e-01f, 7.531867990e-01f,
+	-6.624157776e-01f, 7.491363945e-01f, -6.669999223e-01f, 7.450577854e-01f,
+	-6.715589548e-01f, 7.409511254e-01f, -6.760927036e-01f, 7.368165689e-01f,
+	-6.806009978e-01f, 7.326542717e-01f, -6.850836678e-01f, 7.284643904e-01f,
+	-6.895405447e-01f, 7.242470830e-01f, -6.939714609e-01f, 7.200025080e-01f,
+	-6.983762494e-01f, 7.157308253e-01f, -7.027547445e-01f, 7.114321957e-01f,
+	-7.071067812e-01f, 7.071067812e-01f, -7.114321957e-01f, 7.027547445e-01f,
+	-7.157308253e-01f, 6.983762494e-01f, -7.200025080e-01f, 6.939714609e-01f,
+	-7.242470830e-01f, 6.895405447e-01f, -7.284643904e-01f, 6.850836678e-01f,
+	-7.326542717e-01f, 6.806009978e-01f, -7.368165689e-01f, 6.760927036e-01f,
+	-7.409511254e-01f, 6.715589548e-01f, -7.450577854e-01f, 6.669999223e-01f,
+	-7.491363945e-01f, 6.624157776e-01f, -7.531867990e-01f, 6.578066933e-01f,
+	-7.572088465e-01f, 6.531728430e-01f, -7.612023855e-01f, 6.485144010e-01f,
+	-7.651672656e-01f, 6.438315429e-01f, -7.691033376e-01f, 6.391244449e-01f,
+	-7.730104534e-01f, 6.343932842e-01f, -7.768884657e-01f, 6.296382389e-01f,
+	-7.807372286e-01f, 6.248594881e-01f, -7.845565972e-01f, 6.200572118e-01f,
+	-7.883464276e-01f, 6.152315906e-01f, -7.921065773e-01f, 6.103828063e-01f,
+	-7.958369046e-01f, 6.055110414e-01f, -7.995372691e-01f, 6.006164794e-01f,
+	-8.032075315e-01f, 5.956993045e-01f, -8.068475535e-01f, 5.907597019e-01f,
+	-8.104571983e-01f, 5.857978575e-01f, -8.140363297e-01f, 5.808139581e-01f,
+	-8.175848132e-01f, 5.758081914e-01f, -8.211025150e-01f, 5.707807459e-01f,
+	-8.245893028e-01f, 5.657318108e-01f, -8.280450453e-01f, 5.606615762e-01f,
+	-8.314696123e-01f, 5.555702330e-01f, -8.348628750e-01f, 5.504579729e-01f,
+	-8.382247056e-01f, 5.453249884e-01f, -8.415549774e-01f, 5.401714727e-01f,
+	-8.448535652e-01f, 5.349976199e-01f, -8.481203448e-01f, 5.298036247e-01f,
+	-8.513551931e-01f, 5.245896827e-01f, -8.545579884e-01f, 5.193559902e-01f,
+	-8.577286100e-01f, 5.141027442e-01f, -8.608669386e-01f, 5.088301425e-01f,
+	-8.639728561e-01f, 5.035383837e-01f, -8.670462455e-01f, 4.982276670e-01f,
+	-8.700869911e-01f, 4.928981922e-01f, -8.730949784e-01f, 4.875501601e-01f,
+	-8.760700942e-01f, 4.821837721e-01f, -8.790122264e-01f, 4.767992301e-01f,
+	-8.819212643e-01f, 4.713967368e-01f, -8.847970984e-01f, 4.659764958e-01f,
+	-8.876396204e-01f, 4.605387110e-01f, -8.904487232e-01f, 4.550835871e-01f,
+	-8.932243012e-01f, 4.496113297e-01f, -8.959662498e-01f, 4.441221446e-01f,
+	-8.986744657e-01f, 4.386162385e-01f, -9.013488470e-01f, 4.330938189e-01f,
+	-9.039892931e-01f, 4.275550934e-01f, -9.065957045e-01f, 4.220002708e-01f,
+	-9.091679831e-01f, 4.164295601e-01f, -9.117060320e-01f, 4.108431711e-01f,
+	-9.142097557e-01f, 4.052413140e-01f, -9.166790599e-01f, 3.996241998e-01f,
+	-9.191138517e-01f, 3.939920401e-01f, -9.215140393e-01f, 3.883450467e-01f,
+	-9.238795325e-01f, 3.826834324e-01f, -9.262102421e-01f, 3.770074102e-01f,
+	-9.285060805e-01f, 3.713171940e-01f, -9.307669611e-01f, 3.656129978e-01f,
+	-9.329927988e-01f, 3.598950365e-01f, -9.351835099e-01f, 3.541635254e-01f,
+	-9.373390119e-01f, 3.484186802e-01f, -9.394592236e-01f, 3.426607173e-01f,
+	-9.415440652e-01f, 3.368898534e-01f, -9.435934582e-01f, 3.311063058e-01f,
+	-9.456073254e-01f, 3.253102922e-01f, -9.475855910e-01f, 3.195020308e-01f,
+	-9.495281806e-01f, 3.136817404e-01f, -9.514350210e-01f, 3.078496400e-01f,
+	-9.533060404e-01f, 3.020059493e-01f, -9.551411683e-01f, 2.961508882e-01f,
+	-9.569403357e-01f, 2.902846773e-01f, -9.587034749e-01f, 2.844075372e-01f,
+	-9.604305194e-01f, 2.785196894e-01f, -9.621214043e-01f, 2.726213554e-01f,
+	-9.637760658e-01f, 2.667127575e-01f, -9.653944417e-01f, 2.607941179e-01f,
+	-9.669764710e-01f, 2.548656596e-01f, -9.685220943e-01f, 2.489276057e-01f,
+	-9.700312532e-01f, 2.429801799e-01f, -9.715038910e-01f, 2.370236060e-01f,
+	-9.729399522e-01f, 2.310581083e-01f, -9.743393828e-01f, 2.250839114e-01f,
+	-9.757021300e-01f, 2.191012402e-01f, -9.770281427e-01f, 2.131103199e-01f,
+	-9.783173707e-01f, 2.071113762e-01f, -9.795697657e-01f, 2.011046348e-01f,
+	-9.807852804e-01f, 1.950903220e-01f, -9.819638691e-01f, 1.890686641e-01f,
+	-9.831054874e-01f, 1.830398880e-01f, -9.842100924e-01f, 1.770042204e-01f,
+	-9.852776424e-01f, 1.709618888e-01f, -9.863080972e-01f, 1.649131205e-01f,
+	-9.873014182e-01f, 1.588581433e-01f, -9.882575677e-01f, 1.527971853e-01f,
+	-9.891765100e-01f, 1.467304745e-01f, -9.900582103e-01f, 1.406582393e-01f,
+	-9.909026354e-01f, 1.345807085e-01f, -9.917097537e-01f, 1.284981108e-01f,
+	-9.924795346e-01f, 1.224106752e-01f, -9.932119492e-01f, 1.163186309e-01f,
+	-9.939069700e-01f, 1.102222073e-01f, -9.945645707e-01f, 1.041216339e-01f,
+	-9.951847267e-01f, 9.801714033e-02f, -9.957674145e-01f, 9.190895650e-02f,
+	-9.963126122e-01f, 8.579731234e-02f, -9.968202993e-01f, 7.968243797e-02f,
+	-9.972904567e-01f, 7.356456360e-02f, -9.977230666e-01f, 6.744391956e-02f,
+	-9.981181129e-01f, 6.132073630e-02f, -9.984755806e-01f, 5.519524435e-02f,
+	-9.987954562e-01f, 4.906767433e-02f, -9.990777278e-01f, 4.293825693e-02f,
+	-9.993223846e-01f, 3.680722294e-02f, -9.995294175e-01f, 3.067480318e-02f,
+	-9.996988187e-01f, 2.454122852e-02f, -9.998305818e-01f, 1.840672991e-02f,
+	-9.999247018e-01f, 1.227153829e-02f, -9.999811753e-01f, 6.135884649e-03f,
+	-1.000000000e+00f, 1.224646799e-16f, -9.999811753e-01f, -6.135884649e-03f,
+	-9.999247018e-01f, -1.227153829e-02f, -9.998305818e-01f, -1.840672991e-02f,
+	-9.996988187e-01f, -2.454122852e-02f, -9.995294175e-01f, -3.067480318e-02f,
+	-9.993223846e-01f, -3.680722294e-02f, -9.990777278e-01f, -4.293825693e-02f,
+	-9.987954562e-01f, -4.906767433e-02f, -9.984755806e-01f, -5.519524435e-02f,
+	-9.981181129e-01f, -6.132073630e-02f, -9.977230666e-01f, -6.744391956e-02f,
+	-9.972904567e-01f, -7.356456360e-02f, -9.968202993e-01f, -7.968243797e-02f,
+	-9.963126122e-01f, -8.579731234e-02f, -9.957674145e-01f, -9.190895650e-02f,
+	-9.951847267e-01f, -9.801714033e-02f, -9.945645707e-01f, -1.041216339e-01f,
+	-9.939069700e-01f, -1.102222073e-01f, -9.932119492e-01f, -1.163186309e-01f,
+	-9.924795346e-01f, -1.224106752e-01f, -9.917097537e-01f, -1.284981108e-01f,
+	-9.909026354e-01f, -1.345807085e-01f, -9.900582103e-01f, -1.406582393e-01f,
+	-9.891765100e-01f, -1.467304745e-01f, -9.882575677e-01f, -1.527971853e-01f,
+	-9.873014182e-01f, -1.588581433e-01f, -9.863080972e-01f, -1.649131205e-01f,
+	-9.852776424e-01f, -1.709618888e-01f, -9.842100924e-01f, -1.770042204e-01f,
+	-9.831054874e-01f, -1.830398880e-01f, -9.819638691e-01f, -1.890686641e-01f,
+	-9.807852804e-01f, -1.950903220e-01f, -9.795697657e-01f, -2.011046348e-01f,
+	-9.783173707e-01f, -2.071113762e-01f, -9.770281427e-01f, -2.131103199e-01f,
+	-9.757021300e-01f, -2.191012402e-01f, -9.743393828e-01f, -2.250839114e-01f,
+	-9.729399522e-01f, -2.310581083e-01f, -9.715038910e-01f, -2.370236060e-01f,
+	-9.700312532e-01f, -2.429801799e-01f, -9.685220943e-01f, -2.489276057e-01f,
+	-9.669764710e-01f, -2.548656596e-01f, -9.653944417e-01f, -2.607941179e-01f,
+	-9.637760658e-01f, -2.667127575e-01f, -9.621214043e-01f, -2.726213554e-01f,
+	-9.604305194e-01f, -2.785196894e-01f, -9.587034749e-01f, -2.844075372e-01f,
+	-9.569403357e-01f, -2.902846773e-01f, -9.551411683e-01f, -2.961508882e-01f,
+	-9.533060404e-01f, -3.020059493e-01f, -9.514350210e-01f, -3.078496400e-01f,
+	-9.495281806e-01f, -3.136817404e-01f, -9.475855910e-01f, -3.195020308e-01f,
+	-9.456073254e-01f, -3.253102922e-01f, -9.435934582e-01f, -3.311063058e-01f,
+	-9.415440652e-01f, -3.368898534e-01f, -9.394592236e-01f, -3.426607173e-01f,
+	-9.373390119e-01f, -3.484186802e-01f, -9.351835099e-01f, -3.541635254e-01f,
+	-9.329927988e-01f, -3.598950365e-01f, -9.307669611e-01f, -3.656129978e-01f,
+	-9.285060805e-01f, -3.713171940e-01f, -9.262102421e-01f, -3.770074102e-01f,
+	-9.238795325e-01f, -3.826834324e-01f, -9.215140393e-01f, -3.883450467e-01f,
+	-9.191138517e-01f, -3.939920401e-01f, -9.166790599e-01f, -3.996241998e-01f,
+	-9.142097557e-01f, -4.052413140e-01f, -9.117060320e-01f, -4.108431711e-01f,
+	-9.091679831e-01f, -4.164295601e-01f, -9.065957045e-01f, -4.220002708e-01f,
+	-9.039892931e-01f, -4.275550934e-01f, -9.013488470e-01f, -4.330938189e-01f,
+	-8.986744657e-01f, -4.386162385e-01f, -8.959662498e-01f, -4.441221446e-01f,
+	-8.932243012e-01f, -4.496113297e-01f, -8.904487232e-01f, -4.550835871e-01f,
+	-8.876396204e-01f, -4.605387110e-01f, -8.847970984e-01f, -4.659764958e-01f,
+	-8.819212643e-01f, -4.713967368e-01f, -8.790122264e-01f, -4.767992301e-01f,
+	-8.760700942e-01f, -4.821837721e-01f, -8.730949784e-01f, -4.875501601e-01f,
+	-8.700869911e-01f, -4.928981922e-01f, -8.670462455e-01f, -4.982276670e-01f,
+	-8.639728561e-01f, -5.035383837e-01f, -8.608669386e-01f, -5.088301425e-01f,
+	-8.577286100e-01f, -5.141027442e-01f, -8.545579884e-01f, -5.193559902e-01f,
+	-8.513551931e-01f, -5.245896827e-01f, -8.481203448e-01f, -5.298036247e-01f,
+	-8.448535652e-01f, -5.349976199e-01f, -8.415549774e-01f, -5.401714727e-01f,
+	-8.382247056e-01f, -5.453249884e-01f, -8.348628750e-01f, -5.504579729e-01f,
+	-8.314696123e-01f, -5.555702330e-01f, -8.280450453e-01f, -5.606615762e-01f,
+	-8.245893028e-01f, -5.657318108e-01f, -8.211025150e-01f, -5.707807459e-01f,
+	-8.175848132e-01f, -5.758081914e-01f, -8.140363297e-01f, -5.808139581e-01f,
+	-8.104571983e-01f, -5.857978575e-01f, -8.068475535e-01f, -5.907597019e-01f,
+	-8.032075315e-01f, -5.956993045e-01f, -7.995372691e-01f, -6.006164794e-01f,
+	-7.958369046e-01f, -6.055110414e-01f, -7.921065773e-01f, -6.103828063e-01f,
+	-7.883464276e-01f, -6.152315906e-01f, -7.845565972e-01f, -6.200572118e-01f,
+	-7.807372286e-01f, -6.248594881e-01f, -7.768884657e-01f, -6.296382389e-01f,
+	-7.730104534e-01f, -6.343932842e-01f, -7.691033376e-01f, -6.391244449e-01f,
+	-7.651672656e-01f, -6.438315429e-01f, -7.612023855e-01f, -6.485144010e-01f,
+	-7.572088465e-01f, -6.531728430e-01f, -7.531867990e-01f, -6.578066933e-01f,
+	-7.491363945e-01f, -6.624157776e-01f, -7.450577854e-01f, -6.669999223e-01f,
+	-7.409511254e-01f, -6.715589548e-01f, -7.368165689e-01f, -6.760927036e-01f,
+	-7.326542717e-01f, -6.806009978e-01f, -7.284643904e-01f, -6.850836678e-01f,
+	-7.242470830e-01f, -6.895405447e-01f, -7.200025080e-01f, -6.939714609e-01f,
+	-7.157308253e-01f, -6.983762494e-01f, -7.114321957e-01f, -7.027547445e-01f,
+	-7.071067812e-01f, -7.071067812e-01f, -7.027547445e-01f, -7.114321957e-01f,
+	-6.983762494e-01f, -7.157308253e-01f, -6.939714609e-01f, -7.200025080e-01f,
+	-6.895405447e-01f, -7.242470830e-01f, -6.850836678e-01f, -7.284643904e-01f,
+	-6.806009978e-01f, -7.326542717e-01f, -6.760927036e-01f, -7.368165689e-01f,
+	-6.715589548e-01f, -7.409511254e-01f, -6.669999223e-01f, -7.450577854e-01f,
+	-6.624157776e-01f, -7.491363945e-01f, -6.578066933e-01f, -7.531867990e-01f,
+	-6.531728430e-01f, -7.572088465e-01f, -6.485144010e-01f, -7.612023855e-01f,
+	-6.438315429e-01f, -7.651672656e-01f, -6.391244449e-01f, -7.691033376e-01f,
+	-6.343932842e-01f, -7.730104534e-01f, -6.296382389e-01f, -7.768884657e-01f,
+	-6.248594881e-01f, -7.807372286e-01f, -6.200572118e-01f, -7.845565972e-01f,
+	-6.152315906e-01f, -7.883464276e-01f, -6.103828063e-01f, -7.921065773e-01f,
+	-6.055110414e-01f, -7.958369046e-01f, -6.006164794e-01f, -7.995372691e-01f,
+	-5.956993045e-01f, -8.032075315e-01f, -5.907597019e-01f, -8.068475535e-01f,
+	-5.857978575e-01f, -8.104571983e-01f, -5.808139581e-01f, -8.140363297e-01f,
+	-5.758081914e-01f, -8.175848132e-01f, -5.707807459e-01f, -8.211025150e-01f,
+	-5.657318108e-01f, -8.245893028e-01f, -5.606615762e-01f, -8.280450453e-01f,
+	-5.555702330e-01f, -8.314696123e-01f, -5.504579729e-01f, -8.348628750e-01f,
+	-5.453249884e-01f, -8.382247056e-01f, -5.401714727e-01f, -8.415549774e-01f,
+	-5.349976199e-01f, -8.448535652e-01f, -5.298036247e-01f, -8.481203448e-01f,
+	-5.245896827e-01f, -8.513551931e-01f, -5.193559902e-01f, -8.545579884e-01f,
+	-5.141027442e-01f, -8.577286100e-01f, -5.088301425e-01f, -8.608669386e-01f,
+	-5.035383837e-01f, -8.639728561e-01f, -4.982276670e-01f, -8.670462455e-01f,
+	-4.928981922e-01f, -8.700869911e-01f, -4.875501601e-01f, -8.730949784e-01f,
+	-4.821837721e-01f, -8.760700942e-01f, -4.767992301e-01f, -8.790122264e-01f,
+	-4.713967368e-01f, -8.819212643e-01f, -4.659764958e-01f, -8.847970984e-01f,
+	-4.605387110e-01f, -8.876396204e-01f, -4.550835871e-01f, -8.904487232e-01f,
+	-4.496113297e-01f, -8.932243012e-01f, -4.441221446e-01f, -8.959662498e-01f,
+	-4.386162385e-01f, -8.986744657e-01f, -4.330938189e-01f, -9.013488470e-01f,
+	-4.275550934e-01f, -9.039892931e-01f, -4.220002708e-01f, -9.065957045e-01f,
+	-4.164295601e-01f, -9.091679831e-01f, -4.108431711e-01f, -9.117060320e-01f,
+	-4.052413140e-01f, -9.142097557e-01f, -3.996241998e-01f, -9.166790599e-01f,
+	-3.939920401e-01f, -9.191138517e-01f, -3.883450467e-01f, -9.215140393e-01f,
+	-3.826834324e-01f, -9.238795325e-01f, -3.770074102e-01f, -9.262102421e-01f,
+	-3.713171940e-01f, -9.285060805e-01f, -3.656129978e-01f, -9.307669611e-01f,
+	-3.598950365e-01f, -9.329927988e-01f, -3.541635254e-01f, -9.351835099e-01f,
+	-3.484186802e-01f, -9.373390119e-01f, -3.426607173e-01f, -9.394592236e-01f,
+	-3.368898534e-01f, -9.415440652e-01f, -3.311063058e-01f, -9.435934582e-01f,
+	-3.253102922e-01f, -9.456073254e-01f, -3.195020308e-01f, -9.475855910e-01f,
+	-3.136817404e-01f, -9.495281806e-01f, -3.078496400e-01f, -9.514350210e-01f,
+	-3.020059493e-01f, -9.533060404e-01f, -2.961508882e-01f, -9.551411683e-01f,
+	-2.902846773e-01f, -9.569403357e-01f, -2.844075372e-01f, -9.587034749e-01f,
+	-2.785196894e-01f, -9.604305194e-01f, -2.726213554e-01f, -9.621214043e-01f,
+	-2.667127575e-01f, -9.637760658e-01f, -2.607941179e-01f, -9.653944417e-01f,
+	-2.548656596e-01f, -9.669764710e-01f, -2.489276057e-01f, -9.685220943e-01f,
+	-2.429801799e-01f, -9.700312532e-01f, -2.370236060e-01f, -9.715038910e-01f,
+	-2.310581083e-01f, -9.729399522e-01f, -2.250839114e-01f, -9.743393828e-01f,
+	-2.191012402e-01f, -9.757021300e-01f, -2.131103199e-01f, -9.770281427e-01f,
+	-2.071113762e-01f, -9.783173707e-01f, -2.011046348e-01f, -9.795697657e-01f,
+	-1.950903220e-01f, -9.807852804e-01f, -1.890686641e-01f, -9.819638691e-01f,
+	-1.830398880e-01f, -9.831054874e-01f, -1.770042204e-01f, -9.842100924e-01f,
+	-1.709618888e-01f, -9.852776424e-01f, -1.649131205e-01f, -9.863080972e-01f,
+	-1.588581433e-01f, -9.873014182e-01f, -1.527971853e-01f, -9.882575677e-01f,
+	-1.467304745e-01f, -9.891765100e-01f, -1.406582393e-01f, -9.900582103e-01f,
+	-1.345807085e-01f, -9.909026354e-01f, -1.284981108e-01f, -9.917097537e-01f,
+	-1.224106752e-01f, -9.924795346e-01f, -1.163186309e-01f, -9.932119492e-01f,
+	-1.102222073e-01f, -9.939069700e-01f, -1.041216339e-01f, -9.945645707e-01f,
+	-9.801714033e-02f, -9.951847267e-01f, -9.190895650e-02f, -9.957674145e-01f,
+	-8.579731234e-02f, -9.963126122e-01f, -7.968243797e-02f, -9.968202993e-01f,
+	-7.356456360e-02f, -9.972904567e-01f, -6.744391956e-02f, -9.977230666e-01f,
+	-6.132073630e-02f, -9.981181129e-01f, -5.519524435e-02f, -9.984755806e-01f,
+	-4.906767433e-02f, -9.987954562e-01f, -4.293825693e-02f, -9.990777278e-01f,
+	-3.680722294e-02f, -9.993223846e-01f, -3.067480318e-02f, -9.995294175e-01f,
+	-2.454122852e-02f, -9.996988187e-01f, -1.840672991e-02f, -9.998305818e-01f,
+	-1.227153829e-02f, -9.999247018e-01f, -6.135884649e-03f, -9.999811753e-01f,
+	-1.836970199e-16f, -1.000000000e+00f, 6.135884649e-03f, -9.999811753e-01f,
+	1.227153829e-02f, -9.999247018e-01f, 1.840672991e-02f, -9.998305818e-01f,
+	2.454122852e-02f, -9.996988187e-01f, 3.067480318e-02f, -9.995294175e-01f,
+	3.680722294e-02f, -9.993223846e-01f, 4.293825693e-02f, -9.990777278e-01f,
+	4.906767433e-02f, -9.987954562e-01f, 5.519524435e-02f, -9.984755806e-01f,
+	6.132073630e-02f, -9.981181129e-01f, 6.744391956e-02f, -9.977230666e-01f,
+	7.356456360e-02f, -9.972904567e-01f, 7.968243797e-02f, -9.968202993e-01f,
+	8.579731234e-02f, -9.963126122e-01f, 9.190895650e-02f, -9.957674145e-01f,
+	9.801714033e-02f, -9.951847267e-01f, 1.041216339e-01f, -9.945645707e-01f,
+	1.102222073e-01f, -9.939069700e-01f, 1.163186309e-01f, -9.932119492e-01f,
+	1.224106752e-01f, -9.924795346e-01f, 1.284981108e-01f, -9.917097537e-01f,
+	1.345807085e-01f, -9.909026354e-01f, 1.406582393e-01f, -9.900582103e-01f,
+	1.467304745e-01f, -9.891765100e-01f, 1.527971853e-01f, -9.882575677e-01f,
+	1.588581433e-01f, -9.873014182e-01f, 1.649131205e-01f, -9.863080972e-01f,
+	1.709618888e-01f, -9.852776424e-01f, 1.770042204e-01f, -9.842100924e-01f,
+	1.830398880e-01f, -9.831054874e-01f, 1.890686641e-01f, -9.819638691e-01f,
+	1.950903220e-01f, -9.807852804e-01f, 2.011046348e-01f, -9.795697657e-01f,
+	2.071113762e-01f, -9.783173707e-01f, 2.131103199e-01f, -9.770281427e-01f,
+	2.191012402e-01f, -9.757021300e-01f, 2.250839114e-01f, -9.743393828e-01f,
+	2.310581083e-01f, -9.729399522e-01f, 2.370236060e-01f, -9.715038910e-01f,
+	2.429801799e-01f, -9.700312532e-01f, 2.489276057e-01f, -9.685220943e-01f,
+	2.548656596e-01f, -9.669764710e-01f, 2.607941179e-01f, -9.653944417e-01f,
+	2.667127575e-01f, -9.637760658e-01f, 2.726213554e-01f, -9.621214043e-01f,
+	2.785196894e-01f, -9.604305194e-01f, 2.844075372e-01f, -9.587034749e-01f,
+	2.902846773e-01f, -9.569403357e-01f, 2.961508882e-01f, -9.551411683e-01f,
+	3.020059493e-01f, -9.533060404e-01f, 3.078496400e-01f, -9.514350210e-01f,
+	3.136817404e-01f, -9.495281806e-01f, 3.195020308e-01f, -9.475855910e-01f,
+	3.253102922e-01f, -9.456073254e-01f, 3.311063058e-01f, -9.435934582e-01f,
+	3.368898534e-01f, -9.415440652e-01f, 3.426607173e-01f, -9.394592236e-01f,
+	3.484186802e-01f, -9.373390119e-01f, 3.541635254e-01f, -9.351835099e-01f,
+	3.598950365e-01f, -9.329927988e-01f, 3.656129978e-01f, -9.307669611e-01f,
+	3.713171940e-01f, -9.285060805e-01f, 3.770074102e-01f, -9.262102421e-01f,
+	3.826834324e-01f, -9.238795325e-01f, 3.883450467e-01f, -9.215140393e-01f,
+	3.939920401e-01f, -9.191138517e-01f, 3.996241998e-01f, -9.166790599e-01f,
+	4.052413140e-01f, -9.142097557e-01f, 4.108431711e-01f, -9.117060320e-01f,
+	4.164295601e-01f, -9.091679831e-01f, 4.220002708e-01f, -9.065957045e-01f,
+	4.275550934e-01f, -9.039892931e-01f, 4.330938189e-01f, -9.013488470e-01f,
+	4.386162385e-01f, -8.986744657e-01f, 4.441221446e-01f, -8.959662498e-01f,
+	4.496113297e-01f, -8.932243012e-01f, 4.550835871e-01f, -8.904487232e-01f,
+	4.605387110e-01f, -8.876396204e-01f, 4.659764958e-01f, -8.847970984e-01f,
+	4.713967368e-01f, -8.819212643e-01f, 4.767992301e-01f, -8.790122264e-01f,
+	4.821837721e-01f, -8.760700942e-01f, 4.875501601e-01f, -8.730949784e-01f,
+	4.928981922e-01f, -8.700869911e-01f, 4.982276670e-01f, -8.670462455e-01f,
+	5.035383837e-01f, -8.639728561e-01f, 5.088301425e-01f, -8.608669386e-01f,
+	5.141027442e-01f, -8.577286100e-01f, 5.193559902e-01f, -8.545579884e-01f,
+	5.245896827e-01f, -8.513551931e-01f, 5.298036247e-01f, -8.481203448e-01f,
+	5.349976199e-01f, -8.448535652e-01f, 5.401714727e-01f, -8.415549774e-01f,
+	5.453249884e-01f, -8.382247056e-01f, 5.504579729e-01f, -8.348628750e-01f,
+	5.555702330e-01f, -8.314696123e-01f, 5.606615762e-01f, -8.280450453e-01f,
+	5.657318108e-01f, -8.245893028e-01f, 5.707807459e-01f, -8.211025150e-01f,
+	5.758081914e-01f, -8.175848132e-01f, 5.808139581e-01f, -8.140363297e-01f,
+	5.857978575e-01f, -8.104571983e-01f, 5.907597019e-01f, -8.068475535e-01f,
+	5.956993045e-01f, -8.032075315e-01f, 6.006164794e-01f, -7.995372691e-01f,
+	6.055110414e-01f, -7.958369046e-01f, 6.103828063e-01f, -7.921065773e-01f,
+	6.152315906e-01f, -7.883464276e-01f, 6.200572118e-01f, -7.845565972e-01f,
+	6.248594881e-01f, -7.807372286e-01f, 6.296382389e-01f, -7.768884657e-01f,
+	6.343932842e-01f, -7.730104534e-01f, 6.391244449e-01f, -7.691033376e-01f,
+	6.438315429e-01f, -7.651672656e-01f, 6.485144010e-01f, -7.612023855e-01f,
+	6.531728430e-01f, -7.572088465e-01f, 6.578066933e-01f, -7.531867990e-01f,
+	6.624157776e-01f, -7.491363945e-01f, 6.669999223e-01f, -7.450577854e-01f,
+	6.715589548e-01f, -7.409511254e-01f, 6.760927036e-01f, -7.368165689e-01f,
+	6.806009978e-01f, -7.326542717e-01f, 6.850836678e-01f, -7.284643904e-01f,
+	6.895405447e-01f, -7.242470830e-01f, 6.939714609e-01f, -7.200025080e-01f,
+	6.983762494e-01f, -7.157308253e-01f, 7.027547445e-01f, -7.114321957e-01f,
+	7.071067812e-01f, -7.071067812e-01f, 7.114321957e-01f, -7.027547445e-01f,
+	7.157308253e-01f, -6.983762494e-01f, 7.200025080e-01f, -6.939714609e-01f,
+	7.242470830e-01f, -6.895405447e-01f, 7.284643904e-01f, -6.850836678e-01f,
+	7.326542717e-01f, -6.806009978e-01f, 7.368165689e-01f, -6.760927036e-01f,
+	7.409511254e-01f, -6.715589548e-01f, 7.450577854e-01f, -6.669999223e-01f,
+	7.491363945e-01f, -6.624157776e-01f, 7.531867990e-01f, -6.578066933e-01f,
+	7.572088465e-01f, -6.531728430e-01f, 7.612023855e-01f, -6.485144010e-01f,
+	7.651672656e-01f, -6.438315429e-01f, 7.691033376e-01f, -6.391244449e-01f,
+	7.730104534e-01f, -6.343932842e-01f, 7.768884657e-01f, -6.296382389e-01f,
+	7.807372286e-01f, -6.248594881e-01f, 7.845565972e-01f, -6.200572118e-01f,
+	7.883464276e-01f, -6.152315906e-01f, 7.921065773e-01f, -6.103828063e-01f,
+	7.958369046e-01f, -6.055110414e-01f, 7.995372691e-01f, -6.006164794e-01f,
+	8.032075315e-01f, -5.956993045e-01f, 8.068475535e-01f, -5.907597019e-01f,
+	8.104571983e-01f, -5.857978575e-01f, 8.140363297e-01f, -5.808139581e-01f,
+	8.175848132e-01f, -5.758081914e-01f, 8.211025150e-01f, -5.707807459e-01f,
+	8.245893028e-01f, -5.657318108e-01f, 8.280450453e-01f, -5.606615762e-01f,
+	8.314696123e-01f, -5.555702330e-01f, 8.348628750e-01f, -5.504579729e-01f,
+	8.382247056e-01f, -5.453249884e-01f, 8.415549774e-01f, -5.401714727e-01f,
+	8.448535652e-01f, -5.349976199e-01f, 8.481203448e-01f, -5.298036247e-01f,
+	8.513551931e-01f, -5.245896827e-01f, 8.545579884e-01f, -5.193559902e-01f,
+	8.577286100e-01f, -5.141027442e-01f, 8.608669386e-01f, -5.088301425e-01f,
+	8.639728561e-01f, -5.035383837e-01f, 8.670462455e-01f, -4.982276670e-01f,
+	8.700869911e-01f, -4.928981922e-01f, 8.730949784e-01f, -4.875501601e-01f,
+	8.760700942e-01f, -4.821837721e-01f, 8.790122264e-01f, -4.767992301e-01f,
+	8.819212643e-01f, -4.713967368e-01f, 8.847970984e-01f, -4.659764958e-01f,
+	8.876396204e-01f, -4.605387110e-01f, 8.904487232e-01f, -4.550835871e-01f,
+	8.932243012e-01f, -4.496113297e-01f, 8.959662498e-01f, -4.441221446e-01f,
+	8.986744657e-01f, -4.386162385e-01f, 9.013488470e-01f, -4.330938189e-01f,
+	9.039892931e-01f, -4.275550934e-01f, 9.065957045e-01f, -4.220002708e-01f,
+	9.091679831e-01f, -4.164295601e-01f, 9.117060320e-01f, -4.108431711e-01f,
+	9.142097557e-01f, -4.052413140e-01f, 9.166790599e-01f, -3.996241998e-01f,
+	9.191138517e-01f, -3.939920401e-01f, 9.215140393e-01f, -3.883450467e-01f,
+	9.238795325e-01f, -3.826834324e-01f, 9.262102421e-01f, -3.770074102e-01f,
+	9.285060805e-01f, -3.713171940e-01f, 9.307669611e-01f, -3.656129978e-01f,
+	9.329927988e-01f, -3.598950365e-01f, 9.351835099e-01f, -3.541635254e-01f,
+	9.373390119e-01f, -3.484186802e-01f, 9.394592236e-01f, -3.426607173e-01f,
+	9.415440652e-01f, -3.368898534e-01f, 9.435934582e-01f, -3.311063058e-01f,
+	9.456073254e-01f, -3.253102922e-01f, 9.475855910e-01f, -3.195020308e-01f,
+	9.495281806e-01f, -3.136817404e-01f, 9.514350210e-01f, -3.078496400e-01f,
+	9.533060404e-01f, -3.020059493e-01f, 9.551411683e-01f, -2.961508882e-01f,
+	9.569403357e-01f, -2.902846773e-01f, 9.587034749e-01f, -2.844075372e-01f,
+	9.604305194e-01f, -2.785196894e-01f, 9.621214043e-01f, -2.726213554e-01f,
+	9.637760658e-01f, -2.667127575e-01f, 9.653944417e-01f, -2.607941179e-01f,
+	9.669764710e-01f, -2.548656596e-01f, 9.685220943e-01f, -2.489276057e-01f,
+	9.700312532e-01f, -2.429801799e-01f, 9.715038910e-01f, -2.370236060e-01f,
+	9.729399522e-01f, -2.310581083e-01f, 9.743393828e-01f, -2.250839114e-01f,
+	9.757021300e-01f, -2.191012402e-01f, 9.770281427e-01f, -2.131103199e-01f,
+	9.783173707e-01f, -2.071113762e-01f, 9.795697657e-01f, -2.011046348e-01f,
+	9.807852804e-01f, -1.950903220e-01f, 9.819638691e-01f, -1.890686641e-01f,
+	9.831054874e-01f, -1.830398880e-01f, 9.842100924e-01f, -1.770042204e-01f,
+	9.852776424e-01f, -1.709618888e-01f, 9.863080972e-01f, -1.649131205e-01f,
+	9.873014182e-01f, -1.588581433e-01f, 9.882575677e-01f, -1.527971853e-01f,
+	9.891765100e-01f, -1.467304745e-01f, 9.900582103e-01f, -1.406582393e-01f,
+	9.909026354e-01f, -1.345807085e-01f, 9.917097537e-01f, -1.284981108e-01f,
+	9.924795346e-01f, -1.224106752e-01f, 9.932119492e-01f, -1.163186309e-01f,
+	9.939069700e-01f, -1.102222073e-01f, 9.945645707e-01f, -1.041216339e-01f,
+	9.951847267e-01f, -9.801714033e-02f, 9.957674145e-01f, -9.190895650e-02f,
+	9.963126122e-01f, -8.579731234e-02f, 9.968202993e-01f, -7.968243797e-02f,
+	9.972904567e-01f, -7.356456360e-02f, 9.977230666e-01f, -6.744391956e-02f,
+	9.981181129e-01f, -6.132073630e-02f, 9.984755806e-01f, -5.519524435e-02f,
+	9.987954562e-01f, -4.906767433e-02f, 9.990777278e-01f, -4.293825693e-02f,
+	9.993223846e-01f, -3.680722294e-02f, 9.995294175e-01f, -3.067480318e-02f,
+	9.996988187e-01f, -2.454122852e-02f, 9.998305818e-01f, -1.840672991e-02f,
+	9.999247018e-01f, -1.227153829e-02f, 9.999811753e-01f, -6.135884649e-03f,
+};
+
+#pragma DATA_SECTION(fftTwiddleRfft2048, ".const:fftTwiddleRfft2048")
+const float32_t fftTwiddleRfft2048[2048] =
+{
+	0.000000000e+00f, 1.000000000e+00f, 3.067956763e-03f, 9.999952938e-01f,
+	6.135884649e-03f, 9.999811753e-01f, 9.203754782e-03f, 9.999576446e-01f,
+	1.227153829e-02f, 9.999247018e-01f, 1.533920628e-02f, 9.998823475e-01f,
+	1.840672991e-02f, 9.998305818e-01f, 2.147408028e-02f, 9.997694054e-01f,
+	2.454122852e-02f, 9.996988187e-01f, 2.760814578e-02f, 9.996188225e-01f,
+	3.067480318e-02f, 9.995294175e-01f, 3.374117185e-02f, 9.994306046e-01f,
+	3.680722294e-02f, 9.993223846e-01f, 3.987292759e-02f, 9.992047586e-01f,
+	4.293825693e-02f, 9.990777278e-01f, 4.600318213e-02f, 9.989412932e-01f,
+	4.906767433e-02f, 9.987954562e-01f, 5.213170468e-02f, 9.986402182e-01f,
+	5.519524435e-02f, 9.984755806e-01f, 5.825826450e-02f, 9.983015449e-01f,
+	6.132073630e-02f, 9.981181129e-01f, 6.438263093e-02f, 9.979252862e-01f,
+	6.744391956e-02f, 9.977230666e-01f, 7.050457339e-02f, 9.975114561e-01f,
+	7.356456360e-02f, 9.972904567e-01f, 7.662386139e-02f, 9.970600703e-01f,
+	7.968243797e-02f, 9.968202993e-01f, 8.274026455e-02f, 9.965711458e-01f,
+	8.579731234e-02f, 9.963126122e-01f, 8.885355258e-02f, 9.960447009e-01f,
+	9.190895650e-02f, 9.957674145e-01f, 9.496349533e-02f, 9.954807555e-01f,
+	9.801714033e-02f, 9.951847267e-01f, 1.010698628e-01f, 9.948793308e-01f,
+	1.041216339e-01f, 9.945645707e-01f, 1.071724250e-01f, 9.942404495e-01f,
+	1.102222073e-01f, 9.939069700e-01f, 1.132709522e-01f, 9.935641355e-01f,
+	1.163186309e-01f, 9.932119492e-01f, 1.193652148e-01f, 9.928504145e-01f,
+	1.224106752e-01f, 9.924795346e-01f, 1.254549834e-01f, 9.920993131e-01f,
+	1.284981108e-01f, 9.917097537e-01f, 1.315400287e-01f, 9.913108598e-01f,
+	1.345807085e-01f, 9.909026354e-01f, 1.376201216e-01f, 9.904850843e-01f,
+	1.406582393e-01f, 9.900582103e-01f, 1.436950332e-01f, 9.896220175e-01f,
+	1.467304745e-01f, 9.891765100e-01f, 1.497645347e-01f, 9.887216920e-01f,
+	1.527971853e-01f, 9.882575677e-01f, 1.558283977e-01f, 9.877841416e-01f,
+	1.588581433e-01f, 9.873014182e-01f, 1.618863938e-01f, 9.868094018e-01f,
+	1.649131205e-01f, 9.863080972e-01f, 1.679382950e-01f, 9.857975092e-01f,
+	1.709618888e-01f, 9.852776424e-01f, 1.739838734e-01f, 9.847485018e-01f,
+	1.770042204e-01f, 9.842100924e-01f, 1.800229014e-01f, 9.836624192e-01f,
+	1.830398880e-01f, 9.831054874e-01f, 1.860551517e-01f, 9.825393023e-01f,
+	1.890686641e-01f, 9.819638691e-01f, 1.920803970e-01f, 9.813791933e-01f,
+	1.950903220e-01f, 9.807852804e-01f, 1.980984107e-01f, 9.801821360e-01f,
+	2.011046348e-01f, 9.795697657e-01f, 2.041089661e-01f, 9.789481753e-01f,
+	2.071113762e-01f, 9.783173707e-01f, 2.101118369e-01f, 9.776773578e-01f,
+	2.131103199e-01f, 9.770281427e-01f, 2.161067971e-01f, 9.763697313e-01f,
+	2.191012402e-01f, 9.757021300e-01f, 2.220936210e-01f, 9.750253451e-01f,
+	2.250839114e-01f, 9.743393828e-01f, 2.280720832e-01f, 9.736442497e-01f,
+	2.310581083e-01f, 9.729399522e-01f, 2.340419586e-01f, 9.722264971e-01f,
+	2.370236060e-01f, 9.715038910e-01f, 2.400030224e-01f, 9.707721407e-01f,
+	2.429801799e-01f, 9.700312532e-01f, 2.459550503e-01f, 9.692812354e-01f,
+	2.489276057e-01f, 9.685220943e-01f, 2.518978182e-01f, 9.677538371e-01f,
+	2.548656596e-01f, 9.669764710e-01f, 2.578311022e-01f, 9.661900034e-01f,
+	2.607941179e-01f, 9.653944417e-01f, 2.637546790e-01f, 9.645897933e-01f,
+	2.667127575e-01f, 9.637760658e-01f, 2.696683256e-01f, 9.629532669e-01f,
+	2.726213554e-01f, 9.621214043e-01f, 2.755718193e-01f, 9.612804858e-01f,
+	2.785196894e-01f, 9.604305194e-01f, 2.814649379e-01f, 9.595715131e-01f,
+	2.844075372e-01f, 9.587034749e-01f, 2.873474595e-01f, 9.578264130e-01f,
+	2.902846773e-01f, 9.569403357e-01f, 2.932191627e-01f, 9.560452513e-01f,
+	2.961508882e-01f, 9.551411683e-01f, 2.990798263e-01f, 9.542280951e-01f,
+	3.020059493e-01f, 9.533060404e-01f, 3.049292297e-01f, 9.523750127e-01f,
+	3.078496400e-01f, 9.514350210e-01f, 3.107671527e-01f, 9.504860739e-01f,
+	3.136817404e-01f, 9.495281806e-01f, 3.165933756e-01f, 9.485613499e-01f,
+	3.195020308e-01f, 9.475855910e-01f, 3.224076788e-01f, 9.466009131e-01f,
+	3.253102922e-01f, 9.456073254e-01f, 3.282098436e-01f, 9.446048373e-01f,
+	3.311063058e-01f, 9.435934582e-01f, 3.339996514e-01f, 9.425731976e-01f,
+	3.368898534e-01f, 9.415440652e-01f, 3.397768844e-01f, 9.405060706e-01f,
+	3.426607173e-01f, 9.394592236e-01f, 3.455413250e-01f, 9.384035341e-01f,
+	3.484186802e-01f, 9.373390119e-01f, 3.512927561e-01f, 9.362656672e-01f,
+	3.541635254e-01f, 9.351835099e-01f, 3.570309612e-01f, 9.340925504e-01f,
+	3.598950365e-01f, 9.329927988e-01f, 3.627557244e-01f, 9.318842656e-01f,
+	3.656129978e-01f, 9.307669611e-01f, 3.684668300e-01f, 9.296408958e-01f,
+	3.713171940e-01f, 9.285060805e-01f, 3.741640630e-01f, 9.273625257e-01f,
+	3.770074102e-01f, 9.262102421e-01f, 3.798472089e-01f, 9.250492408e-01f,
+	3.826834324e-01f, 9.238795325e-01f, 3.855160538e-01f, 9.227011283e-01f,
+	3.883450467e-01f, 9.215140393e-01f, 3.911703843e-01f, 9.203182767e-01f,
+	3.939920401e-01f, 9.191138517e-01f, 3.968099874e-01f, 9.179007756e-01f,
+	3.996241998e-01f, 9.166790599e-01f, 4.024346509e-01f, 9.154487161e-01f,
+	4.052413140e-01f, 9.142097557e-01f, 4.080441629e-01f, 9.129621904e-01f,
+	4.108431711e-01f, 9.117060320e-01f, 4.136383122e-01f, 9.104412923e-01f,
+	4.164295601e-01f, 9.091679831e-01f, 4.192168884e-01f, 9.078861165e-01f,
+	4.220002708e-01f, 9.065957045e-01f, 4.247796812e-01f, 9.052967593e-01f,
+	4.275550934e-01f, 9.039892931e-01f, 4.303264813e-01f, 9.026733182e-01f,
+	4.330938189e-01f, 9.013488470e-01f, 4.358570799e-01f, 9.000158920e-01f,
+	4.386162385e-01f, 8.986744657e-01f, 4.413712687e-01f, 8.973245807e-01f,
+	4.441221446e-01f, 8.959662498e-01f, 4.468688402e-01f, 8.945994856e-01f,
+	4.496113297e-01f, 8.932243012e-01f, 4.523495872e-01f, 8.918407094e-01f,
+	4.550835871e-01f, 8.904487232e-01f, 4.578133036e-01f, 8.890483559e-01f,
+	4.605387110e-01f, 8.876396204e-01f, 4.632597836e-01f, 8.862225301e-01f,
+	4.659764958e-01f, 8.847970984e-01f, 4.686888220e-01f, 8.833633387e-01f,
+	4.713967368e-01f, 8.819212643e-01f, 4.741002147e-01f, 8.804708891e-01f,
+	4.767992301e-01f, 8.790122264e-01f, 4.794937577e-01f, 8.775452902e-01f,
+	4.821837721e-01f, 8.760700942e-01f, 4.848692480e-01f, 8.745866523e-01f,
+	4.875501601e-01f, 8.730949784e-01f, 4.902264833e-01f, 8.715950867e-01f,
+	4.928981922e-01f, 8.700869911e-01f, 4.955652618e-01f, 8.685707060e-01f,
+	4.982276670e-01f, 8.670462455e-01f, 5.008853826e-01f, 8.655136241e-01f,
+	5.035383837e-01f, 8.639728561e-01f, 5.061866453e-01f, 8.624239561e-01f,
+	5.088301425e-01f, 8.608669386e-01f, 5.114688504e-01f, 8.593018184e-01f,
+	5.141027442e-01f, 8.577286100e-01f, 5.167317990e-01f, 8.561473284e-01f,
+	5.193559902e-01f, 8.545579884e-01f, 5.219752929e-01f, 8.529606049e-01f,
+	5.245896827e-01f, 8.513551931e-01f, 5.271991348e-01f, 8.497417680e-01f,
+	5.298036247e-01f, 8.481203448e-01f, 5.324031279e-01f, 8.464909388e-01f,
+	5.349976199e-01f, 8.448535652e-01f, 5.375870763e-01f, 8.432082396e-01f,
+	5.401714727e-01f, 8.415549774e-01f, 5.427507849e-01f, 8.398937942e-01f,
+	5.453249884e-01f, 8.382247056e-01f, 5.478940592e-01f, 8.365477272e-01f,
+	5.504579729e-01f, 8.348628750e-01f, 5.530167056e-01f, 8.331701647e-01f,
+	5.555702330e-01f, 8.314696123e-01f, 5.581185312e-01f, 8.297612338e-01f,
+	5.606615762e-01f, 8.280450453e-01f, 5.631993440e-01f, 8.263210628e-01f,
+	5.657318108e-01f, 8.245893028e-01f, 5.682589527e-01f, 8.228497814e-01f,
+	5.707807459e-01f, 8.211025150e-01f, 5.732971667e-01f, 8.193475201e-01f,
+	5.758081914e-01f, 8.175848132e-01f, 5.783137964e-01f, 8.158144108e-01f,
+	5.808139581e-01f, 8.140363297e-01f, 5.833086529e-01f, 8.122505866e-01f,
+	5.857978575e-01f, 8.104571983e-01f, 5.882815482e-01f, 8.086561816e-01f,
+	5.907597019e-01f, 8.068475535e-01f, 5.932322950e-01f, 8.050313311e-01f,
+	5.956993045e-01f, 8.032075315e-01f, 5.981607070e-01f, 8.013761717e-01f,
+	6.006164794e-01f, 7.995372691e-01f, 6.030665985e-01f, 7.976908409e-01f,
+	6.055110414e-01f, 7.958369046e-01f, 6.079497850e-01f, 7.939754776e-01f,
+	6.103828063e-01f, 7.921065773e-01f, 6.128100824e-01f, 7.902302214e-01f,
+	6.152315906e-01f, 7.883464276e-01f, 6.176473079e-01f, 7.864552136e-01f,
+	6.200572118e-01f, 7.845565972e-01f, 6.224612794e-01f, 7.826505962e-01f,
+	6.248594881e-01f, 7.807372286e-01f, 6.272518155e-01f, 7.788165124e-01f,
+	6.296382389e-01f, 7.768884657e-01f, 6.320187359e-01f, 7.749531066e-01f,
+	6.343932842e-01f, 7.730104534e-01f, 6.367618612e-01f, 7.710605243e-01f,
+	6.391244449e-01f, 7.691033376e-01f, 6.414810128e-01f, 7.671389119e-01f,
+	6.438315429e-01f, 7.651672656e-01f, 6.461760130e-01f, 7.631884173e-01f,
+	6.485144010e-01f, 7.612023855e-01f, 6.508466850e-01f, 7.592091890e-01f,
+	6.531728430e-01f, 7.572088465e-01f, 6.554928530e-01f, 7.552013769e-01f,
+	6.578066933e-01f, 7.531867990e-01f, 6.601143421e-01f, 7.511651319e-01f,
+	6.624157776e-01f, 7.491363945e-01f, 6.647109782e-01f, 7.471006060e-01f,
+	6.669999223e-01f, 7.450577854e-01f, 6.692825883e-01f, 7.430079521e-01f,
+	6.715589548e-01f, 7.409511254e-01f, 6.738290004e-01f, 7.388873245e-01f,
+	6.760927036e-01f, 7.368165689e-01f, 6.783500431e-01f, 7.347388781e-01f,
+	6.806009978e-01f, 7.326542717e-01f, 6.828455464e-01f, 7.305627692e-01f,
+	6.850836678e-01f, 7.284643904e-01f, 6.873153409e-01f, 7.263591551e-01f,
+	6.895405447e-01f, 7.242470830e-01f, 6.917592584e-01f, 7.221281939e-01f,
+	6.939714609e-01f, 7.200025080e-01f, 6.961771315e-01f, 7.178700451e-01f,
+	6.983762494e-01f, 7.157308253e-01f, 7.005687939e-01f, 7.135848688e-01f,
+	7.027547445e-01f, 7.114321957e-01f, 7.049340804e-01f, 7.092728264e-01f,
+	7.071067812e-01f, 7.071067812e-01f, 7.092728264e-01f, 7.049340804e-01f,
+	7.114321957e-01f, 7.027547445e-01f, 7.135848688e-01f, 7.005687939e-01f,
+	7.157308253e-01f, 6.983762494e-01f, 7.178700451e-01f, 6.961771315e-01f,
+	7.200025080e-01f, 6.939714609e-01f, 7.221281939e-01f, 6.917592584e-01f,
+	7.242470830e-01f, 6.895405447e-01f, 7.263591551e-01f, 6.873153409e-01f,
+	7.284643904e-01f, 6.850836678e-01f, 7.305627692e-01f, 6.828455464e-01f,
+	7.326542717e-01f, 6.806009978e-01f, 7.347388781e-01f, 6.783500431e-01f,
+	7.368165689e-01f, 6.760927036e-01f, 7.388873245e-01f, 6.738290004e-01f,
+	7.409511254e-01f, 6.715589548e-01f, 7.430079521e-01f, 6.692825883e-01f,
+	7.450577854e-01f, 6.669999223e-01f, 7.471006060e-01f, 6.647109782e-01f,
+	7.491363945e-01f, 6.624157776e-01f, 7.511651319e-01f, 6.601143421e-01f,
+	7.531867990e-01f, 6.578066933e-01f, 7.552013769e-01f, 6.554928530e-01f,
+	7.572088465e-01f, 6.531728430e-01f, 7.592091890e-01f, 6.508466850e-01f,
+	7.612023855e-01f, 6.485144010e-01f, 7.631884173e-01f, 6.461760130e-01f,
+	7.651672656e-01f, 6.438315429e-01f, 7.671389119e-01f, 6.414810128e-01f,
+	7.691033376e-01f, 6.391244449e-01f, 7.710605243e-01f, 6.367618612e-01f,
+	7.730104534e-01f, 6.343932842e-01f, 7.749531066e-01f, 6.320187359e-01f,
+	7.768884657e-01f, 6.296382389e-01f, 7.788165124e-01f, 6.272518155e-01f,
+	7.807372286e-01f, 6.248594881e-01f, 7.826505962e-01f, 6.224612794e-01f,
+	7.845565972e-01f, 6.200572118e-01f, 7.864552136e-01f, 6.176473079e-01f,
+	7.883464276e-01f, 6.152315906e-01f, 7.902302214e-01f, 6.128100824e-01f,
+	7.921065773e-01f, 6.103828063e-01f, 7.939754776e-01f, 6.079497850e-01f,
+	7.958369046e-01f, 6.055110414e-01f, 7.976908409e-01f, 6.030665985e-01f,
+	7.995372691e-01f, 6.006164794e-01f, 8.013761717e-01f, 5.981607070e-01f,
+	8.032075315e-01f, 5.956993045e-01f, 8.050313311e-01f, 5.932322950e-01f,
+	8.068475535e-01f, 5.907597019e-01f, 8.086561816e-01f, 5.882815482e-01f,
+	8.104571983e-01f, 5.857978575e-01f, 8.122505866e-01f, 5.833086529e-01f,
+	8.140363297e-01f, 5.808139581e-01f, 8.158144108e-01f, 5.783137964e-01f,
+	8.175848132e-01f, 5.758081914e-01f, 8.193475201e-01f, 5.732971667e-01f,
+	8.211025150e-01f, 5.707807459e-01f, 8.228497814e-01f, 5.682589527e-01f,
+	8.245893028e-01f, 5.657318108e-01f, 8.263210628e-01f, 5.631993440e-01f,
+	8.280450453e-01f, 5.606615762e-01f, 8.297612338e-01f, 5.581185312e-01f,
+	8.314696123e-01f, 5.555702330e-01f, 8.331701647e-01f, 5.530167056e-01f,
+	8.348628750e-01f, 5.504579729e-01f, 8.365477272e-01f, 5.478940592e-01f,
+	8.382247056e-01f, 5.453249884e-01f, 8.398937942e-01f, 5.427507849e-01f,
+	8.415549774e-01f, 5.401714727e-01f, 8.432082396e-01f, 5.375870763e-01f,
+	8.448535652e-01f, 5.349976199e-01f, 8.464909388e-01f, 5.324031279e-01f,
+	8.481203448e-01f, 5.298036247e-01f, 8.497417680e-01f, 5.271991348e-01f,
+	8.513551931e-01f, 5.245896827e-01f, 8.529606049e-01f, 5.219752929e-01f,
+	8.545579884e-01f, 5.193559902e-01f, 8.561473284e-01f, 5.167317990e-01f,
+	8.577286100e-01f, 5.141027442e-01f, 8.593018184e-01f, 5.114688504e-01f,
+	8.608669386e-01f, 5.088301425e-01f, 8.624239561e-01f, 5.061866453e-01f,
+	8.639728561e-01f, 5.035383837e-01f, 8.655136241e-01f, 5.008853826e-01f,
+	8.670462455e-01f, 4.982276670e-01f, 8.685707060e-01f, 4.955652618e-01f,
+	8.700869911e-01f, 4.928981922e-01f, 8.715950867e-01f, 4.902264833e-01f,
+	8.730949784e-01f, 4.875501601e-01f, 8.745866523e-01f, 4.848692480e-01f,
+	8.760700942e-01f, 4.821837721e-01f, 8.775452902e-01f, 4.794937577e-01f,
+	8.790122264e-01f, 4.767992301e-01f, 8.804708891e-01f, 4.741002147e-01f,
+	8.819212643e-01f, 4.713967368e-01f, 8.833633387e-01f, 4.686888220e-01f,
+	8.847970984e-01f, 4.659764958e-01f, 8.862225301e-01f, 4.632597836e-01f,
+	8.876396204e-01f, 4.605387110e-01f, 8.890483559e-01f, 4.578133036e-01f,
+	8.904487232e-01f, 4.550835871e-01f, 8.918407094e-01f, 4.523495872e-01f,
+	8.932243012e-01f, 4.496113297e-01f, 8.945994856e-01f, 4.468688402e-01f,
+	8.959662498e-01f, 4.441221446e-01f, 8.973245807e-01f, 4.413712687e-01f,
+	8.986744657e-01f, 4.386162385e-01f, 9.000158920e-01f, 4.358570799e-01f,
+	9.013488470e-01f, 4.330938189e-01f, 9.026733182e-01f, 4.303264813e-01f,
+	9.039892931e-01f, 4.275550934e-01f, 9.052967593e-01f, 4.247796812e-01f,
+	9.065957045e-01f, 4.220002708e-01f, 9.078861165e-01f, 4.192168884e-01f,
+	9.091679831e-01f, 4.164295601e-01f, 9.104412923e-01f, 4.136383122e-01f,
+	9.117060320e-01f, 4.108431711e-01f, 9.129621904e-01f, 4.080441629e-01f,
+	9.142097557e-01f, 4.052413140e-01f, 9.154487161e-01f, 4.024346509e-01f,
+	9.166790599e-01f, 3.996241998e-01f, 9.179007756e-01f, 3.968099874e-01f,
+	9.191138517e-01f, 3.939920401e-01f, 9.203182767e-01f, 3.911703843e-01f,
+	9.215140393e-01f, 3.883450467e-01f, 9.227011283e-01f, 3.855160538e-01f,
+	9.238795325e-01f, 3.826834324e-01f, 9.250492408e-01f, 3.798472089e-01f,
+	9.262102421e-01f, 3.770074102e-01f, 9.273625257e-01f, 3.741640630e-01f,
+	9.285060805e-01f, 3.713171940e-01f, 9.296408958e-01f, 3.684668300e-01f,
+	9.307669611e-01f, 3.656129978e-01f, 9.318842656e-01f, 3.627557244e-01f,
+	9.329927988e-01f, 3.598950365e-01f, 9.340925504e-01f, 3.570309612e-01f,
+	9.351835099e-01f, 3.541635254e-01f, 9.362656672e-01f, 3.512927561e-01f,
+	9.373390119e-01f, 3.484186802e-01f, 9.384035341e-01f, 3.455413250e-01f,
+	9.394592236e-01f, 3.426607173e-01f, 9.405060706e-01f, 3.397768844e-01f,
+	9.415440652e-01f, 3.368898534e-01f, 9.425731976e-01f, 3.339996514e-01f,
+	9.435934582e-01f, 3.311063058e-01f, 9.446048373e-01f, 3.282098436e-01f,
+	9.456073254e-01f, 3.253102922e-01f, 9.466009131e-01f, 3.224076788e-01f,
+	9.475855910e-01f, 3.195020308e-01f, 9.485613499e-01f, 3.165933756e-01f,
+	9.495281806e-01f, 3.136817404e-01f, 9.504860739e-01f, 3.107671527e-01f,
+	9.514350210e-01f, 3.078496400e-01f, 9.523750127e-01f, 3.049292297e-01f,
+	9.533060404e-01f, 3.020059493e-01f, 9.542280951e-01f, 2.990798263e-01f,
+	9.551411683e-01f, 2.961508882e-01f, 9.560452513e-01f, 2.932191627e-01f,
+	9.569403357e-01f, 2.902846773e-01f, 9.578264130e-01f, 2.873474595e-01f,
+	9.587034749e-01f, 2.844075372e-01f, 9.595715131e-01f, 2.814649379e-01f,
+	9.604305194e-01f, 2.785196894e-01f, 9.612804858e-01f, 2.755718193e-01f,
+	9.621214043e-01f, 2.726213554e-01f, 9.629532669e-01f, 2.696683256e-01f,
+	9.637760658e-01f, 2.667127575e-01f, 9.645897933e-01f, 2.637546790e-01f,
+	9.653944417e-01f, 2.607941179e-01f, 9.661900034e-01f, 2.578311022e-01f,
+	9.669764710e-01f, 2.548656596e-01f, 9.677538371e-01f, 2.518978182e-01f,
+	9.685220943e-01f, 2.489276057e-01f, 9.692812354e-01f, 2.459550503e-01f,
+	9.700312532e-01f, 2.429801799e-01f, 9.707721407e-01f, 2.400030224e-01f,
+	9.715038910e-01f, 2.370236060e-01f, 9.722264971e-01f, 2.340419586e-01f,
+	9.729399522e-01f, 2.310581083e-01f, 9.736442497e-01f, 2.280720832e-01f,
+	9.743393828e-01f, 2.250839114e-01f, 9.750253451e-01f, 2.220936210e-01f,
+	9.757021300e-01f, 2.191012402e-01f, 9.763697313e-01f, 2.161067971e-01f,
+	9.770281427e-01f, 2.131103199e-01f, 9.776773578e-01f, 2.101118369e-01f,
+	9.783173707e-01f, 2.071113762e-01f, 9.789481753e-01f, 2.041089661e-01f,
+	9.795697657e-01f, 2.011046348e-01f, 9.801821360e-01f, 1.980984107e-01f,
+	9.807852804e-01f, 1.950903220e-01f, 9.813791933e-01f, 1.920803970e-01f,
+	9.819638691e-01f, 1.890686641e-01f, 9.825393023e-01f, 1.860551517e-01f,
+	9.831054874e-01f, 1.830398880e-01f, 9.836624192e-01f, 1.800229014e-01f,
+	9.842100924e-01f, 1.770042204e-01f, 9.847485018e-01f, 1.739838734e-01f,
+	9.852776424e-01f, 1.709618888e-01f, 9.857975092e-01f, 1.679382950e-01f,
+	9.863080972e-01f, 1.649131205e-01f, 9.868094018e-01f, 1.618863938e-01f,
+	9.873014182e-01f, 1.588581433e-01f, 9.877841416e-01f, 1.558283977e-01f,
+	9.882575677e-01f, 1.527971853e-01f, 9.887216920e-01f, 1.497645347e-01f,
+	9.891765100e-01f, 1.467304745e-01f, 9.896220175e-01f, 1.436950332e-01f,
+	9.900582103e-01f, 1.406582393e-01f, 9.904850843e-01f, 1.376201216e-01f,
+	9.909026354e-01f, 1.345807085e-01f, 9.913108598e-01f, 1.315400287e-01f,
+	9.917097537e-01f, 1.284981108e-01f, 9.920993131e-01f, 1.254549834e-01f,
+	9.924795346e-01f, 1.224106752e-01f, 9.928504145e-01f, 1.193652148e-01f,
+	9.932119492e-01f, 1.163186309e-01f, 9.935641355e-01f, 1.132709522e-01f,
+	9.939069700e-01f, 1.102222073e-01f, 9.942404495e-01f, 1.071724250e-01f,
+	9.945645707e-01f, 1.041216339e-01f, 9.948793308e-01f, 1.010698628e-01f,
+	9.951847267e-01f, 9.801714033e-02f, 9.954807555e-01f, 9.496349533e-02f,
+	9.957674145e-01f, 9.190895650e-02f, 9.960447009e-01f, 8.885355258e-02f,
+	9.963126122e-01f, 8.579731234e-02f, 9.965711458e-01f, 8.274026455e-02f,
+	9.968202993e-01f, 7.968243797e-02f, 9.970600703e-01f, 7.662386139e-02f,
+	9.972904567e-01f, 7.356456360e-02f, 9.975114561e-01f, 7.050457339e-02f,
+	9.977230666e-01f, 6.744391956e-02f, 9.979252862e-01f, 6.438263093e-02f,
+	9.981181129e-01f, 6.132073630e-02f, 9.983015449e-01f, 5.825826450e-02f,
+	9.984755806e-01f, 5.519524435e-02f, 9.986402182e-01f, 5.213170468e-02f,
+	9.987954562e-01f, 4.906767433e-02f, 9.989412932e-01f, 4.600318213e-02f,
+	9.990777278e-01f, 4.293825693e-02f, 9.992047586e-01f, 3.987292759e-02f,
+	9.993223846e-01f, 3.680722294e-02f, 9.994306046e-01f, 3.374117185e-02f,
+	9.995294175e-01f, 3.067480318e-02f, 9.996188225e-01f, 2.760814578e-02f,
+	9.996988187e-01f, 2.454122852e-02f, 9.997694054e-01f, 2.147408028e-02f,
+	9.998305818e-01f, 1.840672991e-02f, 9.998823475e-01f, 1.533920628e-02f,
+	9.999247018e-01f, 1.227153829e-02f, 9.999576446e-01f, 9.203754782e-03f,
+	9.999811753e-01f, 6.135884649e-03f, 9.999952938e-01f, 3.067956763e-03f,
+	1.000000000e+00f, 6.123233996e-17f, 9.999952938e-01f, -3.067956763e-03f,
+	9.999811753e-01f, -6.135884649e-03f, 9.999576446e-01f, -9.203754782e-03f,
+	9.999247018e-01f, -1.227153829e-02f, 9.998823475e-01f, -1.533920628e-02f,
+	9.998305818e-01f, -1.840672991e-02f, 9.997694054e-01f, -2.147408028e-02f,
+	9.996988187e-01f, -2.454122852e-02f, 9.996188225e-01f, -2.760814578e-02f,
+	9.995294175e-01f, -3.067480318e-02f, 9.994306046e-01f, -3.374117185e-02f,
+	9.993223846e-01f, -3.680722294e-02f, 9.992047586e-01f, -3.987292759e-02f,
+	9.990777278e-01f, -4.293825693e-02f, 9.989412932e-01f, -4.600318213e-02f,
+	9.987954562e-01f, -4.906767433e-02f, 9.986402182e-01f, -5.213170468e-02f,
+	9.984755806e-01f, -5.519524435e-02f, 9.983015449e-01f, -5.825826450e-02f,
+	9.981181129e-01f, -6.132073630e-02f, 9.979252862e-01f, -6.438263093e-02f,
+	9.977230666e-01f, -6.744391956e-02f, 9.975114561e-01f, -7.050457339e-02f,
+	9.972904567e-01f, -7.356456360e-02f, 9.970600703e-01f, -7.662386139e-02f,
+	9.968202993e-01f, -7.968243797e-02f, 9.965711458e-01f, -8.274026455e-02f,
+	9.963126122e-01f, -8.579731234e-02f, 9.960447009e-01f, -8.885355258e-02f,
+	9.957674145e-01f, -9.190895650e-02f, 9.954807555e-01f, -9.496349533e-02f,
+	9.951847267e-01f, -9.801714033e-02f, 9.948793308e-01f, -1.010698628e-01f,
+	9.945645707e-01f, -1.041216339e-01f, 9.942404495e-01f, -1.071724250e-01f,
+	9.939069700e-01f, -1.102222073e-01f, 9.935641355e-01f, -1.132709522e-01f,
+	9.932119492e-01f, -1.163186309e-01f, 9.928504145e-01f, -1.193652148e-01f,
+	9.924795346e-01f, -1.224106752e-01f, 9.920993131e-01f, -1.254549834e-01f,
+	9.917097537e-01f, -1.284981108e-01f, 9.913108598e-01f, -1.315400287e-01f,
+	9.909026354e-01f, -1.345807085e-01f, 9.904850843e-01f, -1.376201216e-01f,
+	9.900582103e-01f, -1.406582393e-01f, 9.896220175e-01f, -1.436950332e-01f,
+	9.891765100e-01f, -1.467304745e-01f, 9.887216920e-01f, -1.497645347e-01f,
+	9.882575677e-01f, -1.527971853e-01f, 9.877841416e-01f, -1.558283977e-01f,
+	9.873014182e-01f, -1.588581433e-01f, 9.868094018e-01f, -1.618863938e-01f,
+	9.863080972e-01f, -1.649131205e-01f, 9.857975092e-01f, -1.679382950e-01f,
+	9.852776424e-01f, -1.709618888e-01f, 9.847485018e-01f, -1.739838734e-01f,
+	9.842100924e-01f, -1.770042204e-01f, 9.836624192e-01f, -1.800229014e-01f,
+	9.831054874e-01f, -1.830398880e-01f, 9.825393023e-01f, -1.860551517e-01f,
+	9.819638691e-01f, -1.890686641e-01f, 9.813791933e-01f, -1.920803970e-01f,
+	9.807852804e-01f, -1.950903220e-01f, 9.801821360e-01f, -1.980984107e-01f,
+	9.795697657e-01f, -2.011046348e-01f, 9.789481753e-01f, -2.041089661e-01f,
+	9.783173707e-01f, -2.071113762e-01f, 9.776773578e-01f, -2.101118369e-01f,
+	9.770281427e-01f, -2.131103199e-01f, 9.763697313e-01f, -2.161067971e-01f,
+	9.757021300e-01f, -2.191012402e-01f, 9.750253451e-01f, -2.220936210e-01f,
+	9.743393828e-01f, -2.250839114e-01f, 9.736442497e-01f, -2.280720832e-01f,
+	9.729399522e-01f, -2.310581083e-01f, 9.722264971e-01f, -2.340419586e-01f,
+	9.715038910e-01f, -2.370236060e-01f, 9.707721407e-01f, -2.400030224e-01f,
+	9.700312532e-01f, -2.429801799e-01f, 9.692812354e-01f, -2.459550503e-01f,
+	9.685220943e-01f, -2.489276057e-01f, 9.677538371e-01f, -2.518978182e-01f,
+	9.669764710e-01f, -2.548656596e-01f, 9.661900034e-01f, -2.578311022e-01f,
+	9.653944417e-01f, -2.607941179e-01f, 9.645897933e-01f, -2.637546790e-01f,
+	9.637760658e-01f, -2.667127575e-01f, 9.629532669e-01f, -2.696683256e-01f,
+	9.621214043e-01f, -2.726213554e-01f, 9.612804858e-01f, -2.755718193e-01f,
+	9.604305194e-01f, -2.785196894e-01f, 9.595715131e-01f, -2.814649379e-01f,
+	9.587034749e-01f, -2.844075372e-01f, 9.578264130e-01f, -2.873474595e-01f,
+	9.569403357e-01f, -2.902846773e-01f, 9.560452513e-01f, -2.932191627e-01f,
+	9.551411683e-01f, -2.961508882e-01f, 9.542280951e-01f, -2.990798263e-01f,
+	9.533060404e-01f, -3.020059493e-01f, 9.523750127e-01f, -3.049292297e-01f,
+	9.514350210e-01f, -3.078496400e-01f, 9.504860739e-01f, -3.107671527e-01f,
+	9.495281806e-01f, -3.136817404e-01f, 9.485613499e-01f, -3.165933756e-01f,
+	9.475855910e-01f, -3.195020308e-01f, 9.466009131e-01f, -3.224076788e-01f,
+	9.456073254e-01f, -3.253102922e-01f, 9.446048373e-01f, -3.282098436e-01f,
+	9.435934582e-01f, -3.311063058e-01f, 9.425731976e-01f, -3.339996514e-01f,
+	9.415440652e-01f, -3.368898534e-01f, 9.405060706e-01f, -3.397768844e-01f,
+	9.394592236e-01f, -3.426607173e-01f, 9.384035341e-01f, -3.455413250e-01f,
+	9.373390119e-01f, -3.484186802e-01f, 9.362656672e-01f, -3.512927561e-01f,
+	9.351835099e-01f, -3.541635254e-01f, 9.340925504e-01f, -3.570309612e-01f,
+	9.329927988e-01f, -3.598950365e-01f, 9.318842656e-01f, -3.627557244e-01f,
+	9.307669611e-01f, -3.656129978e-01f, 9.296408958e-01f, -3.684668300e-01f,
+	9.285060805e-01f, -3.713171940e-01f, 9.273625257e-01f, -3.741640630e-01f,
+	9.262102421e-01f, -3.770074102e-01f, 9.250492408e-01f, -3.798472089e-01f,
+	9.238795325e-01f, -3.826834324e-01f, 9.227011283e-01f, -3.855160538e-01f,
+	9.215140393e-01f, -3.883450467e-01f, 9.203182767e-01f, -3.911703843e-01f,
+	9.191138517e-01f, -3.939920401e-01f, 9.179007756e-01f, -3.968099874e-01f,
+	9.166790599e-01f, -3.996241998e-01f, 9.154487161e-01f, -4.024346509e-01f,
+	9.142097557e-01f, -4.052413140e-01f, 9.129621904e-01f, -4.080441629e-01f,
+	9.117060320e-01f, -4.108431711e-01f, 9.104412923e-01f, -4.136383122e-01f,
+	9.091679831e-01f, -4.164295601e-01f, 9.078861165e-01f, -4.192168884e-01f,
+	9.065957045e-01f, -4.220002708e-01f, 9.052967593e-01f, -4.247796812e-01f,
+	9.039892931e-01f, -4.275550934e-01f, 9.026733182e-01f, -4.303264813e-01f,
+	9.013488470e-01f, -4.330938189e-01f, 9.000158920e-01f, -4.358570799e-01f,
+	8.986744657e-01f, -4.386162385e-01f, 8.973245807e-01f, -4.413712687e-01f,
+	8.959662498e-01f, -4.441221446e-01f, 8.945994856e-01f, -4.468688402e-01f,
+	8.932243012e-01f, -4.496113297e-01f, 8.918407094e-01f, -4.523495872e-01f,
+	8.904487232e-01f, -4.550835871e-01f, 8.890483559e-01f, -4.578133036e-01f,
+	8.876396204e-01f, -4.605387110e-01f, 8.862225301e-01f, -4.632597836e-01f,
+	8.847970984e-01f, -4.659764958e-01f, 8.833633387e-01f, -4.686888220e-01f,
+	8.819212643e-01f, -4.713967368e-01f, 8.804708891e-01f, -4.741002147e-01f,
+	8.790122264e-01f, -4.767992301e-01f, 8.775452902e-01f, -4.794937577e-01f,
+	8.760700942e-01f, -4.821837721e-01f, 8.745866523e-01f, -4.848692480e-01f,
+	8.730949784e-01f, -4.875501601e-01f, 8.715950867e-01f, -4.902264833e-01f,
+	8.700869911e-01f, -4.928981922e-01f, 8.685707060e-01f, -4.955652618e-01f,
+	8.670462455e-01f, -4.982276670e-01f, 8.655136241e-01f, -5.008853826e-01f,
+	8.639728561e-01f, -5.035383837e-01f, 8.624239561e-01f, -5.061866453e-01f,
+	8.608669386e-01f, -5.088301425e-01f, 8.593018184e-01f, -5.114688504e-01f,
+	8.577286100e-01f, -5.141027442e-01f, 8.561473284e-01f, -5.167317990e-01f,
+	8.545579884e-01f, -5.193559902e-01f, 8.529606049e-01f, -5.219752929e-01f,
+	8.513551931e-01f, -5.245896827e-01f, 8.497417680e-01f, -5.271991348e-01f,
+	8.481203448e-01f, -5.298036247e-01f, 8.464909388e-01f, -5.324031279e-01f,
+	8.448535652e-01f, -5.349976199e-01f, 8.432082396e-01f, -5.375870763e-01f,
+	8.415549774e-01f, -5.401714727e-01f, 8.398937942e-01f, -5.427507849e-01f,
+	8.382247056e-01f, -5.453249884e-01f, 8.365477272e-01f, -5.478940592e-01f,
+	8.348628750e-01f, -5.504579729e-01f, 8.331701647e-01f, -5.530167056e-01f,
+	8.314696123e-01f, -5.555702330e-01f, 8.297612338e-01f, -5.581185312e-01f,
+	8.280450453e-01f, -5.606615762e-01f, 8.263210628e-01f, -5.631993440e-01f,
+	8.245893028e-01f, -5.657318108e-01f, 8.228497814e-01f, -5.682589527e-01f,
+	8.211025150e-01f, -5.707807459e-01f, 8.193475201e-01f, -5.732971667e-01f,
+	8.175848132e-01f, -5.758081914e-01f, 8.158144108e-01f, -5.783137964e-01f,
+	8.140363297e-01f, -5.808139581e-01f, 8.122505866e-01f, -5.833086529e-01f,
+	8.104571983e-01f, -5.857978575e-01f, 8.086561816e-01f, -5.882815482e-01f,
+	8.068475535e-01f, -5.907597019e-01f, 8.050313311e-01f, -5.932322950e-01f,
+	8.032075315e-01f, -5.956993045e-01f, 8.013761717e-01f, -5.981607070e-01f,
+	7.995372691e-01f, -6.006164794e-01f, 7.976908409e-01f, -6.030665985e-01f,
+	7.958369046e-01f, -6.055110414e-01f, 7.939754776e-01f, -6.079497850e-01f,
+	7.921065773e-01f, -6.103828063e-01f, 7.902302214e-01f, -6.128100824e-01f,
+	7.883464276e-01f, -6.152315906e-01f, 7.864552136e-01f, -6.176473079e-01f,
+	7.845565972e-01f, -6.200572118e-01f, 7.826505962e-01f, -6.224612794e-01f,
+	7.807372286e-01f, -6.248594881e-01f, 7.788165124e-01f, -6.272518155e-01f,
+	7.768884657e-01f, -6.296382389e-01f, 7.749531066e-01f, -6.320187359e-01f,
+	7.730104534e-01f, -6.343932842e-01f, 7.710605243e-01f, -6.367618612e-01f,
+	7.691033376e-01f, -6.391244449e-01f, 7.671389119e-01f, -6.414810128e-01f,
+	7.651672656e-01f, -6.438315429e-01f, 7.631884173e-01f, -6.461760130e-01f,
+	7.612023855e-01f, -6.485144010e-01f, 7.592091890e-01f, -6.508466850e-01f,
+	7.572088465e-01f, -6.531728430e-01f, 7.552013769e-01f, -6.554928530e-01f,
+	7.531867990e-01f, -6.578066933e-01f, 7.511651319e-01f, -6.601143421e-01f,
+	7.491363945e-01f, -6.624157776e-01f, 7.471006060e-01f, -6.647109782e-01f,
+	7.450577854e-01f, -6.669999223e-01f, 7.430079521e-01f, -6.692825883e-01f,
+	7.409511254e-01f, -6.715589548e-01f, 7.388873245e-01f, -6.738290004e-01f,
+	7.368165689e-01f, -6.760927036e-01f, 7.347388781e-01f, -6.783500431e-01f,
+	7.326542717e-01f, -6.806009978e-01f, 7.305627692e-01f, -6.828455464e-01f,
+	7.284643904e-01f, -6.850836678e-01f, 7.263591551e-01f, -6.873153409e-01f,
+	7.242470830e-01f, -6.895405447e-01f, 7.221281939e-01f, -6.917592584e-01f,
+	7.200025080e-01f, -6.939714609e-01f, 7.178700451e-01f, -6.961771315e-01f,
+	7.157308253e-01f, -6.983762494e-01f, 7.135848688e-01f, -7.005687939e-01f,
+	7.114321957e-01f, -7.027547445e-01f, 7.092728264e-01f, -7.049340804e-01f,
+	7.071067812e-01f, -7.071067812e-01f, 7.049340804e-01f, -7.092728264e-01f,
+	7.027547445e-01f, -7.114321957e-01f, 7.005687939e-01f, -7.135848688e-01f,
+	6.983762494e-01f, -7.157308253e-01f, 6.961771315e-01f, -7.178700451e-01f,
+	6.939714609e-01f, -7.200025080e-01f, 6.917592584e-01f, -7.221281939e-01f,
+	6.895405447e-01f, -7.242470830e-01f, 6.873153409e-01f, -7.263591551e-01f,
+	6.850836678e-01f, -7.284643904e-01f, 6.828455464e-01f, -7.305627692e-01f,
+	6.806009978e-01f, -7.326542717e-01f, 6.783500431e-01f, -7.347388781e-01f,
+	6.760927036e-01f, -7.368165689e-01f, 6.738290004e-01f, -7.388873245e-01f,
+	6.715589548e-01f, -7.409511254e-01f, 6.692825883e-01f, -7.430079521e-01f,
+	6.669999223e-01f, -7.450577854e-01f, 6.647109782e-01f, -7.471006060e-01f,
+	6.624157776e-01f, -7.491363945e-01f, 6.601143421e-01f, -7.511651319e-01f,
+	6.578066933e-01f, -7.531867990e-01f, 6.554928530e-01f, -7.552013769e-01f,
+	6.531728430e-01f, -7.572088465e-01f, 6.508466850e-01f, -7.592091890e-01f,
+	6.485144010e-01f, -7.612023855e-01f, 6.461760130e-01f, -7.631884173e-01f,
+	6.438315429e-01f, -7.651672656e-01f, 6.414810128e-01f, -7.671389119e-01f,
+	6.391244449e-01f, -7.691033376e-01f, 6.367618612e-01f, -7.710605243e-01f,
+	6.343932842e-01f, -7.730104534e-01f, 6.320187359e-01f, -7.749531066e-01f,
+	6.296382389e-01f, -7.768884657e-01f, 6.272518155e-01f, -7.788165124e-01f,
+	6.248594881e-01f, -7.807372286e-01f, 6.224612794e-01f, -7.826505962e-01f,
+	6.200572118e-01f, -7.845565972e-01f, 6.176473079e-01f, -7.864552136e-01f,
+	6.152315906e-01f, -7.883464276e-01f, 6.128100824e-01f, -7.902302214e-01f,
+	6.103828063e-01f, -7.921065773e-01f, 6.079497850e-01f, -7.939754776e-01f,
+	6.055110414e-01f, -7.958369046e-01f, 6.030665985e-01f, -7.976908409e-01f,
+	6.006164794e-01f, -7.995372691e-01f, 5.981607070e-01f, -8.013761717e-01f,
+	5.956993045e-01f, -8.032075315e-01f, 5.932322950e-01f, -8.050313311e-01f,
+	5.907597019e-01f, -8.068475535e-01f, 5.882815482e-01f, -8.086561816e-01f,
+	5.857978575e-01f, -8.104571983e-01f, 5.833086529e-01f, -8.122505866e-01f,
+	5.808139581e-01f, -8.140363297e-01f, 5.783137964e-01f, -8.158144108e-01f,
+	5.758081914e-01f, -8.175848132e-01f, 5.732971667e-01f, -8.193475201e-01f,
+	5.707807459e-01f, -8.211025150e-01f, 5.682589527e-01f, -8.228497814e-01f,
+	5.657318108e-01f, -8.245893028e-01f, 5.631993440e-01f, -8.263210628e-01f,
+	5.606615762e-01f, -8.280450453e-01f, 5.581185312e-01f, -8.297612338e-01f,
+	5.555702330e-01f, -8.314696123e-01f, 5.530167056e-01f, -8.331701647e-01f,
+	5.504579729e-01f, -8.348628750e-01f, 5.478940592e-01f, -8.365477272e-01f,
+	5.453249884e-01f, -8.382247056e-01f, 5.427507849e-01f, -8.398937942e-01f,
+	5.401714727e-01f, -8.415549774e-01f, 5.375870763e-01f, -8.432082396e-01f,
+	5.349976199e-01f, -8.448535652e-01f, 5.324031279e-01f, -8.464909388e-01f,
+	5.298036247e-01f, -8.481203448e-01f, 5.271991348e-01f, -8.497417680e-01f,
+	5.245896827e-01f, -8.513551931e-01f, 5.219752929e-01f, -8.529606049e-01f,
+	5.193559902e-01f, -8.545579884e-01f, 5.167317990e-01f, -8.561473284e-01f,
+	5.141027442e-01f, -8.577286100e-01f, 5.114688504e-01f, -8.593018184e-01f,
+	5.088301425e-01f, -8.608669386e-01f, 5.061866453e-01f, -8.624239561e-01f,
+	5.035383837e-01f, -8.639728561e-01f, 5.008853826e-01f, -8.655136241e-01f,
+	4.982276670e-01f, -8.670462455e-01f, 4.955652618e-01f, -8.685707060e-01f,
+	4.928981922e-01f, -8.700869911e-01f, 4.902264833e-01f, -8.715950867e-01f,
+	4.875501601e-01f, -8.730949784e-01f, 4.848692480e-01f, -8.745866523e-01f,
+	4.821837721e-01f, -8.760700942e-01f, 4.794937577e-01f, -8.775452902e-01f,
+	4.767992301e-01f, -8.790122264e-01f, 4.741002147e-01f, -8.804708891e-01f,
+	4.713967368e-01f, -8.819212643e-01f, 4.686888220e-01f, -8.833633387e-01f,
+	4.659764958e-01f, -8.847970984e-01f, 4.632597836e-01f, -8.862225301e-01f,
+	4.605387110e-01f, -8.876396204e-01f, 4.578133036e-01f, -8.890483559e-01f,
+	4.550835871e-01f, -8.904487232e-01f, 4.523495872e-01f, -8.918407094e-01f,
+	4.496113297e-01f, -8.932243012e-01f, 4.468688402e-01f, -8.945994856e-01f,
+	4.441221446e-01f, -8.959662498e-01f, 4.413712687e-01f, -8.973245807e-01f,
+	4.386162385e-01f, -8.986744657e-01f, 4.358570799e-01f, -9.000158920e-01f,
+	4.330938189e-01f, -9.013488470e-01f, 4.303264813e-01f, -9.026733182e-01f,
+	4.275550934e-01f, -9.039892931e-01f, 4.247796812e-01f, -9.052967593e-01f,
+	4.220002708e-01f, -9.065957045e-01f, 4.192168884e-01f, -9.078861165e-01f,
+	4.164295601e-01f, -9.091679831e-01f, 4.136383122e-01f, -9.104412923e-01f,
+	4.108431711e-01f, -9.117060320e-01f, 4.080441629e-01f, -9.129621904e-01f,
+	4.052413140e-01f, -9.142097557e-01f, 4.024346509e-01f, -9.154487161e-01f,
+	3.996241998e-01f, -9.166790599e-01f, 3.968099874e-01f, -9.179007756e-01f,
+	3.939920401e-01f, -9.191138517e-01f, 3.911703843e-01f, -9.203182767e-01f,
+	3.883450467e-01f, -9.215140393e-01f, 3.855160538e-01f, -9.227011283e-01f,
+	3.826834324e-01f, -9.238795325e-01f, 3.798472089e-01f, -9.250492408e-01f,
+	3.770074102e-01f, -9.262102421e-01f, 3.741640630e-01f, -9.273625257e-01f,
+	3.713171940e-01f, -9.285060805e-01f, 3.684668300e-01f, -9.296408958e-01f,
+	3.656129978e-01f, -9.307669611e-01f, 3.627557244e-01f, -9.318842656e-01f,
+	3.598950365e-01f, -9.329927988e-01f, 3.570309612e-01f, -9.340925504e-01f,
+	3.541635254e-01f, -9.351835099e-01f, 3.512927561e-01f, -9.362656672e-01f,
+	3.484186802e-01f, -9.373390119e-01f, 3.455413250e-01f, -9.384035341e-01f,
+	3.426607173e-01f, -9.394592236e-01f, 3.397768844e-01f, -9.405060706e-01f,
+	3.368898534e-01f, -9.415440652e-01f, 3.339996514e-01f, -9.425731976e-01f,
+	3.311063058e-01f, -9.435934582e-01f, 3.282098436e-01f, -9.446048373e-01f,
+	3.253102922e-01f, -9.456073254e-01f, 3.224076788e-01f, -9.466009131e-01f,
+	3.195020308e-01f, -9.475855910e-01f, 3.165933756e-01f, -9.485613499e-01f,
+	3.136817404e-01f, -9.495281806e-01f, 3.107671527e-01f, -9.504860739e-01f,
+	3.078496400e-01f, -9.514350210e-01f, 3.049292297e-01f, -9.523750127e-01f,
+	3.020059493e-01f, -9.533060404e-01f, 2.990798263e-01f, -9.542280951e-01f,
+	2.961508882e-01f, -9.551411683e-01f, 2.932191627e-01f, -9.560452513e-01f,
+	2.902846773e-01f, -9.569403357e-01f, 2.873474595e-01f, -9.578264130e-01f,
+	2.844075372e-01f, -9.587034749e-01f, 2.814649379e-01f, -9.595715131e-01f,
+	2.785196894e-01f, -9.604305194e-01f, 2.755718193e-01f, -9.612804858e-01f,
+	2.726213554e-01f, -9.621214043e-01f, 2.696683256e-01f, -9.629532669e-01f,
+	2.667127575e-01f, -9.637760658e-01f, 2.637546790e-01f, -9.645897933e-01f,
+	2.607941179e-01f, -9.653944417e-01f, 2.578311022e-01f, -9.661900034e-01f,
+	2.548656596e-01f, -9.669764710e-01f, 2.518978182e-01f, -9.677538371e-01f,
+	2.489276057e-01f, -9.685220943e-01f, 2.459550503e-01f, -9.692812354e-01f,
+	2.429801799e-01f, -9.700312532e-01f, 2.400030224e-01f, -9.707721407e-01f,
+	2.370236060e-01f, -9.715038910e-01f, 2.340419586e-01f, -9.722264971e-01f,
+	2.310581083e-01f, -9.729399522e-01f, 2.280720832e-01f, -9.736442497e-01f,
+	2.250839114e-01f, -9.743393828e-01f, 2.220936210e-01f, -9.750253451e-01f,
+	2.191012402e-01f, -9.757021300e-01f, 2.161067971e-01f, -9.763697313e-01f,
+	2.131103199e-01f, -9.770281427e-01f, 2.101118369e-01f, -9.776773578e-01f,
+	2.071113762e-01f, -9.783173707e-01f, 2.041089661e-01f, -9.789481753e-01f,
+	2.011046348e-01f, -9.795697657e-01f, 1.980984107e-01f, -9.801821360e-01f,
+	1.950903220e-01f, -9.807852804e-01f, 1.920803970e-01f, -9.813791933e-01f,
+	1.890686641e-01f, -9.819638691e-01f, 1.860551517e-01f, -9.825393023e-01f,
+	1.830398880e-01f, -9.831054874e-01f, 1.800229014e-01f, -9.836624192e-01f,
+	1.770042204e-01f, -9.842100924e-01f, 1.739838734e-01f, -9.847485018e-01f,
+	1.709618888e-01f, -9.852776424e-01f, 1.679382950e-01f, -9.857975092e-01f,
+	1.649131205e-01f, -9.863080972e-01f, 1.618863938e-01f, -9.868094018e-01f,
+	1.588581433e-01f, -9.873014182e-01f, 1.558283977e-01f, -9.877841416e-01f,
+	1.527971853e-01f, -9.882575677e-01f, 1.497645347e-01f, -9.887216920e-01f,
+	1.467304745e-01f, -9.891765100e-01f, 1.436950332e-01f, -9.896220175e-01f,
+	1.406582393e-01f, -9.900582103e-01f, 1.376201216e-01f, -9.904850843e-01f,
+	1.345807085e-01f, -9.909026354e-01f, 1.315400287e-01f, -9.913108598e-01f,
+	1.284981108e-01f, -9.917097537e-01f, 1.254549834e-01f, -9.920993131e-01f,
+	1.224106752e-01f, -9.924795346e-01f, 1.193652148e-01f, -9.928504145e-01f,
+	1.163186309e-01f, -9.932119492e-01f, 1.132709522e-01f, -9.935641355e-01f,
+	1.102222073e-01f, -9.939069700e-01f, 1.071724250e-01f, -9.942404495e-01f,
+	1.041216339e-01f, -9.945645707e-01f, 1.010698628e-01f, -9.948793308e-01f,
+	9.801714033e-02f, -9.951847267e-01f, 9.496349533e-02f, -9.954807555e-01f,
+	9.190895650e-02f, -9.957674145e-01f, 8.885355258e-02f, -9.960447009e-01f,
+	8.579731234e-02f, -9.963126122e-01f, 8.274026455e-02f, -9.965711458e-01f,
+	7.968243797e-02f, -9.968202993e-01f, 7.662386139e-02f, -9.970600703e-01f,
+	7.356456360e-02f, -9.972904567e-01f, 7.050457339e-02f, -9.975114561e-01f,
+	6.744391956e-02f, -9.977230666e-01f, 6.438263093e-02f, -9.979252862e-01f,
+	6.132073630e-02f, -9.981181129e-01f, 5.825826450e-02f, -9.983015449e-01f,
+	5.519524435e-02f, -9.984755806e-01f, 5.213170468e-02f, -9.986402182e-01f,
+	4.906767433e-02f, -9.987954562e-01f, 4.600318213e-02f, -9.989412932e-01f,
+	4.293825693e-02f, -9.990777278e-01f, 3.987292759e-02f, -9.992047586e-01f,
+	3.680722294e-02f, -9.993223846e-01f, 3.374117185e-02f, -9.994306046e-01f,
+	3.067480318e-02f, -9.995294175e-01f, 2.760814578e-02f, -9.996188225e-01f,
+	2.454122852e-02f, -9.996988187e-01f, 2.147408028e-02f, -9.997694054e-01f,
+	1.840672991e-02f, -9.998305818e-01f, 1.533920628e-02f, -9.998823475e-01f,
+	1.227153829e-02f, -9.999247018e-01f, 9.203754782e-03f, -9.999576446e-01f,
+	6.135884649e-03f, -9.999811753e-01f, 3.067956763e-03f, -9.999952938e-01f,
+};
+
+const arm_rfft_fast_instance_f32 fftPlan2048 =
+{
+	{ 1024, fftTwiddle1024, armBitRevIndexTable1024, ARMBITREVINDEXTABLE1024_TABLE_LENGTH },
+	2048,
+	(float32_t *)fftTwiddleRfft2048
+};
+
+#pragma DATA_SECTION(fftArbTwiddle245, ".const:fftArbTwiddle245")
+const float32_t fftArbTwiddle245[490] =
+{
+	1.000000000e+00f, -0.000000000e+00f, 9.996711682e-01f, -2.564284322e-02f,
+	9.986848892e-01f, -5.126882207e-02f, 9.970418115e-01f, -7.686108329e-02f,
+	9.947430158e-01f, -1.024027958e-01f, 9.917900138e-01f, -1.278771617e-01f,
+	9.881847477e-01f, -1.532674274e-01f, 9.839295886e-01f, -1.785568948e-01f,
+	9.790273348e-01f, -2.037289318e-01f, 9.734812105e-01f, -2.287669837e-01f,
+	9.672948630e-01f, -2.536545839e-01f, 9.604723610e-01f, -2.783753647e-01f,
+	9.530181914e-01f, -3.029130682e-01f, 9.449372564e-01f, -3.272515569e-01f,
+	9.362348706e-01f, -3.513748241e-01f, 9.269167573e-01f, -3.752670049e-01f,
+	9.169890447e-01f, -3.989123863e-01f, 9.064582618e-01f, -4.222954175e-01f,
+	8.953313343e-01f, -4.454007204e-01f, 8.836155801e-01f, -4.682130996e-01f,
+	8.713187041e-01f, -4.907175520e-01f, 8.584487936e-01f, -5.128992774e-01f,
+	8.450143126e-01f, -5.347436877e-01f, 8.310240965e-01f, -5.562364165e-01f,
+	8.164873462e-01f, -5.773633289e-01f, 8.014136219e-01f, -5.981105305e-01f,
+	7.858128370e-01f, -6.184643766e-01f, 7.696952518e-01f, -6.384114812e-01f,
+	7.530714660e-01f, -6.579387259e-01f, 7.359524126e-01f, -6.770332683e-01f,
+	7.183493501e-01f, -6.956825506e-01f, 7.002738554e-01f, -7.138743078e-01f,
+	6.817378162e-01f, -7.315965760e-01f, 6.627534228e-01f, -7.488376997e-01f,
+	6.433331607e-01f, -7.655863402e-01f, 6.234898019e-01f, -7.818314825e-01f,
+	6.032363965e-01f, -7.975624427e-01f, 5.825862645e-01f, -8.127688751e-01f,
+	5.615529868e-01f, -8.274407792e-01f, 5.401503962e-01f, -8.415685055e-01f,
+	5.183925683e-01f, -8.551427630e-01f, 4.962938126e-01f, -8.681546243e-01f,
+	4.738686625e-01f, -8.805955319e-01f, 4.511318662e-01f, -8.924573039e-01f,
+	4.280983770e-01f, -9.037321393e-01f, 4.047833431e-01f, -9.144126230e-01f,
+	3.812020980e-01f, -9.244917309e-01f, 3.573701501e-01f, -9.339628343e-01f,
+	3.333031729e-01f, -9.428197044e-01f, 3.090169944e-01f, -9.510565163e-01f,
+	2.845275866e-01f, -9.586678530e-01f, 2.598510555e-01f, -9.656487089e-01f,
+	2.350036297e-01f, -9.719944928e-01f, 2.100016507e-01f, -9.777010314e-01f,
+	1.848615612e-01f, -9.827645716e-01f, 1.595998950e-01f, -9.871817834e-01f,
+	1.342332658e-01f, -9.909497618e-01f, 1.087783563e-01f, -9.940660286e-01f,
+	8.325190718e-02f, -9.965285344e-01f, 5.767070634e-02f, -9.983356598e-01f,
+	3.205157757e-02f, -9.994862162e-01f, 6.411369654e-03f, -9.999794470e-01f,
+	-1.923305479e-02f, -9.998150277e-01f, -4.486483035e-02f, -9.989930665e-01f,
+	-7.046709995e-02f, -9.975141041e-01f, -9.602302591e-02f, -9.953791129e-01f,
+	-1.215158010e-01f, -9.925894973e-01f, -1.469286596e-01f, -9.891470917e-01f,
+	-1.722448886e-01f, -9.850541601e-01f, -1.974478384e-01f, -9.803133943e-01f,
+	-2.225209340e-01f, -9.749279122e-01f, -2.474476856e-01f, -9.689012555e-01f,
+	-2.722116999e-01f, -9.622373878e-01f, -2.967966906e-01f, -9.549406916e-01f,
+	-3.211864888e-01f, -9.470159658e-01f, -3.453650544e-01f, -9.384684220e-01f,
+	-3.693164860e-01f, -9.293036819e-01f, -3.930250317e-01f, -9.195277726e-01f,
+	-4.164750990e-01f, -9.091471233e-01f, -4.396512659e-01f, -8.981685612e-01f,
+	-4.625382902e-01f, -8.865993064e-01f, -4.851211200e-01f, -8.744469675e-01f,
+	-5.073849032e-01f, -8.617195367e-01f, -5.293149979e-01f, -8.484253844e-01f,
+	-5.508969815e-01f, -8.345732537e-01f, -5.721166601e-01f, -8.201722546e-01f,
+	-5.929600785e-01f, -8.052318581e-01f, -6.134135287e-01f, -7.897618899e-01f,
+	-6.334635592e-01f, -7.737725242e-01f, -6.530969838e-01f, -7.572742765e-01f,
+	-6.723008903e-01f, -7.402779971e-01f, -6.910626490e-01f, -7.227948638e-01f,
+	-7.093699210e-01f, -7.048363748e-01f, -7.272106663e-01f, -6.864143405e-01f,
+	-7.445731516e-01f, -6.675408765e-01f, -7.614459584e-01f, -6.482283953e-01f,
+	-7.778179899e-01f, -6.284895979e-01f, -7.936784788e-01f, -6.083374658e-01f,
+	-8.090169944e-01f, -5.877852523e-01f, -8.238234490e-01f, -5.668464739e-01f,
+	-8.380881049e-01f, -5.455349012e-01f, -8.518015808e-01f, -5.238645501e-01f,
+	-8.649548579e-01f, -5.018496724e-01f, -8.775392858e-01f, -4.795047465e-01f,
+	-8.895465880e-01f, -4.568444678e-01f, -9.009688679e-01f, -4.338837391e-01f,
+	-9.117986134e-01f, -4.106376609e-01f, -9.220287022e-01f, -3.871215213e-01f,
+	-9.316524064e-01f, -3.633507860e-01f, -9.406633967e-01f, -3.393410882e-01f,
+	-9.490557470e-01f, -3.151082180e-01f, -9.568239380e-01f, -2.906681127e-01f,
+	-9.639628607e-01f, -2.660368456e-01f, -9.704678202e-01f, -2.412306157e-01f,
+	-9.763345384e-01f, -2.162657372e-01f, -9.815591570e-01f, -1.911586287e-01f,
+	-9.861382399e-01f, -1.659258021e-01f, -9.900687756e-01f, -1.405838521e-01f,
+	-9.933481793e-01f, -1.151494453e-01f, -9.959742940e-01f, -8.963930890e-02f,
+	-9.979453928e-01f, -6.407021998e-02f, -9.992601792e-01f, -3.845899441e-02f,
+	-9.999177887e-01f, -1.282247576e-02f, -9.999177887e-01f, 1.282247576e-02f,
+	-9.992601792e-01f, 3.845899441e-02f, -9.979453928e-01f, 6.407021998e-02f,
+	-9.959742940e-01f, 8.963930890e-02f, -9.933481793e-01f, 1.151494453e-01f,
+	-9.900687756e-01f, 1.405838521e-01f, -9.861382399e-01f, 1.659258021e-01f,
+	-9.815591570e-01f, 1.911586287e-01f, -9.763345384e-01f, 2.162657372e-01f,
+	-9.704678202e-01f, 2.412306157e-01f, -9.639628607e-01f, 2.660368456e-01f,
+	-9.568239380e-01f, 2.906681127e-01f, -9.490557470e-01f, 3.151082180e-01f,
+	-9.406633967e-01f, 3.393410882e-01f, -9.316524064e-01f, 3.633507860e-01f,
+	-9.220287022e-01f, 3.871215213e-01f, -9.117986134e-01f, 4.106376609e-01f,
+	-9.009688679e-01f, 4.338837391e-01f, -8.895465880e-01f, 4.568444678e-01f,
+	-8.775392858e-01f, 4.795047465e-01f, -8.649548579e-01f, 5.018496724e-01f,
+	-8.518015808e-01f, 5.238645501e-01f, -8.380881049e-01f, 5.455349012e-01f,
+	-8.238234490e-01f, 5.668464739e-01f, -8.090169944e-01f, 5.877852523e-01f,
+	-7.936784788e-01f, 6.083374658e-01f, -7.778179899e-01f, 6.284895979e-01f,
+	-7.614459584e-01f, 6.482283953e-01f, -7.445731516e-01f, 6.675408765e-01f,
+	-7.272106663e-01f, 6.864143405e-01f, -7.093699210e-01f, 7.048363748e-01f,
+	-6.910626490e-01f, 7.227948638e-01f, -6.723008903e-01f, 7.402779971e-01f,
+	-6.530969838e-01f, 7.572742765e-01f, -6.334635592e-01f, 7.737725242e-01f,
+	-6.134135287e-01f, 7.897618899e-01f, -5.929600785e-01f, 8.052318581e-01f,
+	-5.721166601e-01f, 8.201722546e-01f, -5.508969815e-01f, 8.345732537e-01f,
+	-5.293149979e-01f, 8.484253844e-01f, -5.073849032e-01f, 8.617195367e-01f,
+	-4.851211200e-01f, 8.744469675e-01f, -4.625382902e-01f, 8.865993064e-01f,
+	-4.396512659e-01f, 8.981685612e-01f, -4.164750990e-01f, 9.091471233e-01f,
+	-3.930250317e-01f, 9.195277726e-01f, -3.693164860e-01f, 9.293036819e-01f,
+	-3.453650544e-01f, 9.384684220e-01f, -3.211864888e-01f, 9.470159658e-01f,
+	-2.967966906e-01f, 9.549406916e-01f, -2.722116999e-01f, 9.622373878e-01f,
+	-2.474476856e-01f, 9.689012555e-01f, -2.225209340e-01f, 9.749279122e-01f,
+	-1.974478384e-01f, 9.803133943e-01f, -1.722448886e-01f, 9.850541601e-01f,
+	-1.469286596e-01f, 9.891470917e-01f, -1.215158010e-01f, 9.925894973e-01f,
+	-9.602302591e-02f, 9.953791129e-01f, -7.046709995e-02f, 9.975141041e-01f,
+	-4.486483035e-02f, 9.989930665e-01f, -1.923305479e-02f, 9.998150277e-01f,
+	6.411369654e-03f, 9.999794470e-01f, 3.205157757e-02f, 9.994862162e-01f,
+	5.767070634e-02f, 9.983356598e-01f, 8.325190718e-02f, 9.965285344e-01f,
+	1.087783563e-01f, 9.940660286e-01f, 1.342332658e-01f, 9.909497618e-01f,
+	1.595998950e-01f, 9.871817834e-01f, 1.848615612e-01f, 9.827645716e-01f,
+	2.100016507e-01f, 9.777010314e-01f, 2.350036297e-01f, 9.719944928e-01f,
+	2.598510555e-01f, 9.656487089e-01f, 2.845275866e-01f, 9.586678530e-01f,
+	3.090169944e-01f, 9.510565163e-01f, 3.333031729e-01f, 9.428197044e-01f,
+	3.573701501e-01f, 9.339628343e-01f, 3.812020980e-01f, 9.244917309e-01f,
+	4.047833431e-01f, 9.144126230e-01f, 4.280983770e-01f, 9.037321393e-01f,
+	4.511318662e-01f, 8.924573039e-01f, 4.738686625e-01f, 8.805955319e-01f,
+	4.962938126e-01f, 8.681546243e-01f, 5.183925683e-01f, 8.551427630e-01f,
+	5.401503962e-01f, 8.415685055e-01f, 5.615529868e-01f, 8.274407792e-01f,
+	5.825862645e-01f, 8.127688751e-01f, 6.032363965e-01f, 7.975624427e-01f,
+	6.234898019e-01f, 7.818314825e-01f, 6.433331607e-01f, 7.655863402e-01f,
+	6.627534228e-01f, 7.488376997e-01f, 6.817378162e-01f, 7.315965760e-01f,
+	7.002738554e-01f, 7.138743078e-01f, 7.183493501e-01f, 6.956825506e-01f,
+	7.359524126e-01f, 6.770332683e-01f, 7.530714660e-01f, 6.579387259e-01f,
+	7.696952518e-01f, 6.384114812e-01f, 7.858128370e-01f, 6.184643766e-01f,
+	8.014136219e-01f, 5.981105305e-01f, 8.164873462e-01f, 5.773633289e-01f,
+	8.310240965e-01f, 5.562364165e-01f, 8.450143126e-01f, 5.347436877e-01f,
+	8.584487936e-01f, 5.128992774e-01f, 8.713187041e-01f, 4.907175520e-01f,
+	8.836155801e-01f, 4.682130996e-01f, 8.953313343e-01f, 4.454007204e-01f,
+	9.064582618e-01f, 4.222954175e-01f, 9.169890447e-01f, 3.989123863e-01f,
+	9.269167573e-01f, 3.752670049e-01f, 9.362348706e-01f, 3.513748241e-01f,
+	9.449372564e-01f, 3.272515569e-01f, 9.530181914e-01f, 3.029130682e-01f,
+	9.604723610e-01f, 2.783753647e-01f, 9.672948630e-01f, 2.536545839e-01f,
+	9.734812105e-01f, 2.287669837e-01f, 9.790273348e-01f, 2.037289318e-01f,
+	9.839295886e-01f, 1.785568948e-01f, 9.881847477e-01f, 1.532674274e-01f,
+	9.917900138e-01f, 1.278771617e-01f, 9.947430158e-01f, 1.024027958e-01f,
+	9.970418115e-01f, 7.686108329e-02f, 9.986848892e-01f, 5.126882207e-02f,
+	9.996711682e-01f, 2.564284322e-02f,
+};
+
+const arbfftPlan fftArbPlan245 =
+{
+	245, ARBFFT_MIXED_RADIX,
+	3, { 5, 7, 7 },
+	fftArbTwiddle245, 0, 0, 0
+};
+
+#pragma DATA_SECTION(fftBandRows256_44100, ".const:fftBandRows256_44100")
+const uint16_t fftBandRows256_44100[20] =
+{
+	0, 1, 2, 3, 4, 5, 6, 8,
+	10, 13, 16, 20, 26, 32, 41, 52,
+	65, 82, 104, 127,
+};
+
+#pragma DATA_SECTION(fftBandColumns256_44100, ".const:fftBandColumns256_44100")
+const uint16_t fftBandColumns256_44100[127] =
+{
+	1, 2, 3, 4, 5, 6, 7, 8,
+	9, 10, 11, 12, 13, 14, 15, 16,
+	17, 18, 19, 20, 21, 22, 23, 24,
+	25, 26, 27, 28, 29, 30, 31, 32,
+	33, 34, 35, 36, 37, 38, 39, 40,
+	41, 42, 43, 44, 45, 46, 47, 48,
+	49, 50, 51, 52, 53, 54, 55, 56,
+	57, 58, 59, 60, 61, 62, 63, 64,
+	65, 66, 67, 68, 69, 70, 71, 72,
+	73, 74, 75, 76, 77, 78, 79, 80,
+	81, 82, 83, 84, 85, 86, 87, 88,
+	89, 90, 91, 92, 93, 94, 95, 96,
+	97, 98, 99, 100, 101, 102, 103, 104,
+	105, 106, 107, 108, 109, 110, 111, 112,
+	113, 114, 115, 116, 117, 118, 119, 120,
+	121, 122, 123, 124, 125, 126, 127,
+};
+
+#pragma DATA_SECTION(fftBandWeights256_44100, ".const:fftBandWeights256_44100")
+const float32_t fftBandWeights256_44100[127] =
+{
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+};
+
+#pragma DATA_SECTION(fftBandCenters256_44100, ".const:fftBandCenters256_44100")
+const uint16_t fftBandCenters256_44100[19] =
+{
+	157, 315, 500, 630, 794, 1000, 1260, 1587,
+	2000, 2520, 3175, 4000, 5040, 6350, 8000, 10079,
+	12699, 16000, 20159,
+};
+
+const bandsWeights fftBands256_44100 =
+{
+	19, fftBandRows256_44100, fftBandColumns256_44100, fftBandWeights256_44100,
+	fftBandCenters256_44100
+};
+
+#pragma DATA_SECTION(fftBandRows256_16000, ".const:fftBandRows256_16000")
+const uint16_t fftBandRows256_16000[20] =
+{
+	0, 1, 2, 3, 4, 5, 7, 8,
+	11, 14, 17, 22, 28, 35, 45, 57,
+	71, 90, 114, 127,
+};
+
+#pragma DATA_SECTION(fftBandColumns256_16000, ".const:fftBandColumns256_16000")
+const uint16_t fftBandColumns256_16000[127] =
+{
+	1, 2, 3, 4, 5, 6, 7, 8,
+	9, 10, 11, 12, 13, 14, 15, 16,
+	17, 18, 19, 20, 21, 22, 23, 24,
+	25, 26, 27, 28, 29, 30, 31, 32,
+	33, 34, 35, 36, 37, 38, 39, 40,
+	41, 42, 43, 44, 45, 46, 47, 48,
+	49, 50, 51, 52, 53, 54, 55, 56,
+	57, 58, 59, 60, 61, 62, 63, 64,
+	65, 66, 67, 68, 69, 70, 71, 72,
+	73, 74, 75, 76, 77, 78, 79, 80,
+	81, 82, 83, 84, 85, 86, 87, 88,
+	89, 90, 91, 92, 93, 94, 95, 96,
+	97, 98, 99, 100, 101, 102, 103, 104,
+	105, 106, 107, 108, 109, 110, 111, 112,
+	113, 114, 115, 116, 117, 118, 119, 120,
+	121, 122, 123, 124, 125, 126, 127,
+};
+
+#pragma DATA_SECTION(fftBandWeights256_16000, ".const:fftBandWeights256_16000")
+const float32_t fftBandWeights256_16000[127] =
+{
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+};
+
+#pragma DATA_SECTION(fftBandCenters256_16000, ".const:fftBandCenters256_16000")
+const uint16_t fftBandCenters256_16000[19] =
+{
+	62, 125, 198, 250, 315, 397, 500, 630,
+	794, 1000, 1260, 1587, 2000, 2520, 3175, 4000,
+	5040, 6350, 8000,
+};
+
+const bandsWeights fftBands256_16000 =
+{
+	19, fftBandRows256_16000, fftBandColumns256_16000, fftBandWeights256_16000,
+	fftBandCenters256_16000
+};
+
+#pragma DATA_SECTION(fftBandRows512_44100, ".const:fftBandRows512_44100")
+const uint16_t fftBandRows512_44100[23] =
+{
+	0, 1, 2, 3, 4, 5, 6, 8,
+	10, 13, 16, 20, 26, 32, 41, 52,
+	65, 82, 104, 131, 165, 208, 255,
+};
+
+#pragma DATA_SECTION(fftBandColumns512_44100, ".const:fftBandColumns512_44100")
+const uint16_t fftBandColumns512_44100[255] =
+{
+	1, 2, 3, 4, 5, 6, 7, 8,
+	9, 10, 11, 12, 13, 14, 15, 16,
+	17, 18, 19, 20, 21, 22, 23, 24,
+	25, 26, 27, 28, 29, 30, 31, 32,
+	33, 34, 35, 36, 37, 38, 39, 40,
+	41, 42, 43, 44, 45, 46, 47, 48,
+	49, 50, 51, 52, 53, 54, 55, 56,
+	57, 58, 59, 60, 61, 62, 63, 64,
+	65, 66, 67, 68, 69, 70, 71, 72,
+	73, 74, 75, 76, 77, 78, 79, 80,
+	81, 82, 83, 84, 85, 86, 87, 88,
+	89, 90, 91, 92, 93, 94, 95, 96,
+	97, 98, 99, 100, 101, 102, 103, 104,
+	105, 106, 107, 108, 109, 110, 111, 112,
+	113, 114, 115, 116, 117, 118, 119, 120,
+	121, 122, 123, 124, 125, 126, 127, 128,
+	129, 130, 131, 132, 133, 134, 135, 136,
+	137, 138, 139, 140, 141, 142, 143, 144,
+	145, 146, 147, 148, 149, 150, 151, 152,
+	153, 154, 155, 156, 157, 158, 159, 160,
+	161, 162, 163, 164, 165, 166, 167, 168,
+	169, 170, 171, 172, 173, 174, 175, 176,
+	177, 178, 179, 180, 181, 182, 183, 184,
+	185, 186, 187, 188, 189, 190, 191, 192,
+	193, 194, 195, 196, 197, 198, 199, 200,
+	201, 202, 203, 204, 205, 206, 207, 208,
+	209, 210, 211, 212, 213, 214, 215, 216,
+	217, 218, 219, 220, 221, 222, 223, 224,
+	225, 226, 227, 228, 229, 230, 231, 232,
+	233, 234, 235, 236, 237, 238, 239, 240,
+	241, 242, 243, 244, 245, 246, 247, 248,
+	249, 250, 251, 252, 253, 254, 255,
+};
+
+#pragma DATA_SECTION(fftBandWeights512_44100, ".const:fftBandWeights512_44100")
+const float32_t fftBandWeights512_44100[255] =
+{
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+};
+
+#pragma DATA_SECTION(fftBandCenters512_44100, ".const:fftBandCenters512_44100")
+const uint16_t fftBandCenters512_44100[22] =
+{
+	79, 157, 250, 315, 397, 500, 630, 794,
+	1000, 1260, 1587, 2000, 2520, 3175, 4000, 5040,
+	6350, 8000, 10079, 12699, 16000, 20159,
+};
+
+const bandsWeights fftBands512_44100 =
+{
+	22, fftBandRows512_44100, fftBandColumns512_44100, fftBandWeights512_44100,
+	fftBandCenters512_44100
+};
+
+#pragma DATA_SECTION(fftBandRows512_16000, ".const:fftBandRows512_16000")
+const uint16_t fftBandRows512_16000[23] =
+{
+	0, 1, 2, 3, 4, 5, 7, 8,
+	11, 14, 17, 22, 28, 35, 45, 57,
+	71, 90, 114, 143, 181, 228, 255,
+};
+
+#pragma DATA_SECTION(fftBandColumns512_16000, ".const:fftBandColumns512_16000")
+const uint16_t fftBandColumns512_16000[255] =
+{
+	1, 2, 3, 4, 5, 6, 7, 8,
+	9, 10, 11, 12, 13, 14, 15, 16,
+	17, 18, 19, 20, 21, 22, 23, 24,
+	25, 26, 27, 28, 29, 30, 31, 32,
+	33, 34, 35, 36, 37, 38, 39, 40,
+	41, 42, 43, 44, 45, 46, 47, 48,
+	49, 50, 51, 52, 53, 54, 55, 56,
+	57, 58, 59, 60, 61, 62, 63, 64,
+	65, 66, 67, 68, 69, 70, 71, 72,
+	73, 74, 75, 76, 77, 78, 79, 80,
+	81, 82, 83, 84, 85, 86, 87, 88,
+	89, 90, 91, 92, 93, 94, 95, 96,
+	97, 98, 99, 100, 101, 102, 103, 104,
+	105, 106, 107, 108, 109, 110, 111, 112,
+	113, 114, 115, 116, 117, 118, 119, 120,
+	121, 122, 123, 124, 125, 126, 127, 128,
+	129, 130, 131, 132, 133, 134, 135, 136,
+	137, 138, 139, 140, 141, 142, 143, 144,
+	145, 146, 147, 148, 149, 150, 151, 152,
+	153, 154, 155, 156, 157, 158, 159, 160,
+	161, 162, 163, 164, 165, 166, 167, 168,
+	169, 170, 171, 172, 173, 174, 175, 176,
+	177, 178, 179, 180, 181, 182, 183, 184,
+	185, 186, 187, 188, 189, 190, 191, 192,
+	193, 194, 195, 196, 197, 198, 199, 200,
+	201, 202, 203, 204, 205, 206, 207, 208,
+	209, 210, 211, 212, 213, 214, 215, 216,
+	217, 218, 219, 220, 221, 222, 223, 224,
+	225, 226, 227, 228, 229, 230, 231, 232,
+	233, 234, 235, 236, 237, 238, 239, 240,
+	241, 242, 243, 244, 245, 246, 247, 248,
+	249, 250, 251, 252, 253, 254, 255,
+};
+
+#pragma DATA_SECTION(fftBandWeights512_16000, ".const:fftBandWeights512_16000")
+const float32_t fftBandWeights512_16000[255] =
+{
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+};
+
+#pragma DATA_SECTION(fftBandCenters512_16000, ".const:fftBandCenters512_16000")
+const uint16_t fftBandCenters512_16000[22] =
+{
+	31, 62, 99, 125, 157, 198, 250, 315,
+	397, 500, 630, 794, 1000, 1260, 1587, 2000,
+	2520, 3175, 4000, 5040, 6350, 8000,
+};
+
+const bandsWeights fftBands512_16000 =
+{
+	22, fftBandRows512_16000, fftBandColumns512_16000, fftBandWeights512_16000,
+	fftBandCenters512_16000
+};
+
+#pragma DATA_SECTION(fftBandRows1024_44100, ".const:fftBandRows1024_44100")
+const uint16_t fftBandRows1024_44100[26] =
+{
+	0, 1, 2, 3, 4, 5, 6, 8,
+	10, 13, 16, 20, 26, 32, 41, 52,
+	65, 82, 104, 131, 165, 208, 262, 330,
+	417, 511,
+};
+
+#pragma DATA_SECTION(fftBandColumns1024_44100, ".const:fftBandColumns1024_44100")
+const uint16_t fftBandColumns1024_44100[511] =
+{
+	1, 2, 3, 4, 5, 6, 7, 8,
+	9, 10, 11, 12, 13, 14, 15, 16,
+	17, 18, 19, 20, 21, 22, 23, 24,
+	25, 26, 27, 28, 29, 30, 31, 32,
+	33, 34, 35, 36, 37, 38, 39, 40,
+	41, 42, 43, 44, 45, 46, 47, 48,
+	49, 50, 51, 52, 53, 54, 55, 56,
+	57, 58, 59, 60, 61, 62, 63, 64,
+	65, 66, 67, 68, 69, 70, 71, 72,
+	73, 74, 75, 76, 77, 78, 79, 80,
+	81, 82, 83, 84, 85, 86, 87, 88,
+	89, 90, 91, 92, 93, 94, 95, 96,
+	97, 98, 99, 100, 101, 102, 103, 104,
+	105, 106, 107, 108, 109, 110, 111, 112,
+	113, 114, 115, 116, 117, 118, 119, 120,
+	121, 122, 123, 124, 125, 126, 127, 128,
+	129, 130, 131, 132, 133, 134, 135, 136,
+	137, 138, 139, 140, 141, 142, 143, 144,
+	145, 146, 147, 148, 149, 150, 151, 152,
+	153, 154, 155, 156, 157, 158, 159, 160,
+	161, 162, 163, 164, 165, 166, 167, 168,
+	169, 170, 171, 172, 173, 174, 175, 176,
+	177, 178, 179, 180, 181, 182, 183, 184,
+	185, 186, 187, 188, 189, 190, 191, 192,
+	193, 194, 195, 196, 197, 198, 199, 200,
+	201, 202, 203, 204, 205, 206, 207, 208,
+	209, 210, 211, 212, 213, 214, 215, 216,
+	217, 218, 219, 220, 221, 222, 223, 224,
+	225, 226, 227, 228, 229, 230, 231, 232,
+	233, 234, 235, 236, 237, 238, 239, 240,
+	241, 242, 243, 244, 245, 246, 247, 248,
+	249, 250, 251, 252, 253, 254, 255, 256,
+	257, 258, 259, 260, 261, 262, 263, 264,
+	265, 266, 267, 268, 269, 270, 271, 272,
+	273, 274, 275, 276, 277, 278, 279, 280,
+	281, 282, 283, 284, 285, 286, 287, 288,
+	289, 290, 291, 292, 293, 294, 295, 296,
+	297, 298, 299, 300, 301, 302, 303, 304,
+	305, 306, 307, 308, 309, 310, 311, 312,
+	313, 314, 315, 316, 317, 318, 319, 320,
+	321, 322, 323, 324, 325, 326, 327, 328,
+	329, 330, 331, 332, 333, 334, 335, 336,
+	337, 338, 339, 340, 341, 342, 343, 344,
+	345, 346, 347, 348, 349, 350, 351, 352,
+	353, 354, 355, 356, 357, 358, 359, 360,
+	361, 362, 363, 364, 365, 366, 367, 368,
+	369, 370, 371, 372, 373, 374, 375, 376,
+	377, 378, 379, 380, 381, 382, 383, 384,
+	385, 386, 387, 388, 389, 390, 391, 392,
+	393, 394, 395, 396, 397, 398, 399, 400,
+	401, 402, 403, 404, 405, 406, 407, 408,
+	409, 410, 411, 412, 413, 414, 415, 416,
+	417, 418, 419, 420, 421, 422, 423, 424,
+	425, 426, 427, 428, 429, 430, 431, 432,
+	433, 434, 435, 436, 437, 438, 439, 440,
+	441, 442, 443, 444, 445, 446, 447, 448,
+	449, 450, 451, 452, 453, 454, 455, 456,
+	457, 458, 459, 460, 461, 462, 463, 464,
+	465, 466, 467, 468, 469, 470, 471, 472,
+	473, 474, 475, 476, 477, 478, 479, 480,
+	481, 482, 483, 484, 485, 486, 487, 488,
+	489, 490, 491, 492, 493, 494, 495, 496,
+	497, 498, 499, 500, 501, 502, 503, 504,
+	505, 506, 507, 508, 509, 510, 511,
+};
+
+#pragma DATA_SECTION(fftBandWeights1024_44100, ".const:fftBandWeights1024_44100")
+const float32_t fftBandWeights1024_44100[511] =
+{
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+};
+
+#pragma DATA_SECTION(fftBandCenters1024_44100, ".const:fftBandCenters1024_44100")
+const uint16_t fftBandCenters1024_44100[25] =
+{
+	39, 79, 125, 157, 198, 250, 315, 397,
+	500, 630, 794, 1000, 1260, 1587, 2000, 2520,
+	3175, 4000, 5040, 6350, 8000, 10079, 12699, 16000,
+	20159,
+};
+
+const bandsWeights fftBands1024_44100 =
+{
+	25, fftBandRows1024_44100, fftBandColumns1024_44100, fftBandWeights1024_44100,
+	fftBandCenters1024_44100
+};
+
+#pragma DATA_SECTION(fftBandRows1024_16000, ".const:fftBandRows1024_16000")
+const uint16_t fftBandRows1024_16000[26] =
+{
+	0, 1, 2, 3, 4, 5, 7, 8,
+	11, 14, 17, 22, 28, 35, 45, 57,
+	71, 90, 114, 143, 181, 228, 287, 362,
+	456, 511,
+};
+
+#pragma DATA_SECTION(fftBandColumns1024_16000, ".const:fftBandColumns1024_16000")
+const uint16_t fftBandColumns1024_16000[511] =
+{
+	1, 2, 3, 4, 5, 6, 7, 8,
+	9, 10, 11, 12, 13, 14, 15, 16,
+	17, 18, 19, 20, 21, 22, 23, 24,
+	25, 26, 27, 28, 29, 30, 31, 32,
+	33, 34, 35, 36, 37, 38, 39, 40,
+	41, 42, 43, 44, 45, 46, 47, 48,
+	49, 50, 51, 52, 53, 54, 55, 56,
+	57, 58, 59, 60, 61, 62, 63, 64,
+	65, 66, 67, 68, 69, 70, 71, 72,
+	73, 74, 75, 76, 77, 78, 79, 80,
+	81, 82, 83, 84, 85, 86, 87, 88,
+	89, 90, 91, 92, 93, 94, 95, 96,
+	97, 98, 99, 100, 101, 102, 103, 104,
+	105, 106, 107, 108, 109, 110, 111, 112,
+	113, 114, 115, 116, 117, 118, 119, 120,
+	121, 122, 123, 124, 125, 126, 127, 128,
+	129, 130, 131, 132, 133, 134, 135, 136,
+	137, 138, 139, 140, 141, 142, 143, 144,
+	145, 146, 147, 148, 149, 150, 151, 152,
+	153, 154, 155, 156, 157, 158, 159, 160,
+	161, 162, 163, 164, 165, 166, 167, 168,
+	169, 170, 171, 172, 173, 174, 175, 176,
+	177, 178, 179, 180, 181, 182, 183, 184,
+	185, 186, 187, 188, 189, 190, 191, 192,
+	193, 194, 195, 196, 197, 198, 199, 200,
+	201, 202, 203, 204, 205, 206, 207, 208,
+	209, 210, 211, 212, 213, 214, 215, 216,
+	217, 218, 219, 220, 221, 222, 223, 224,
+	225, 226, 227, 228, 229, 230, 231, 232,
+	233, 234, 235, 236, 237, 238, 239, 240,
+	241, 242, 243, 244, 245, 246, 247, 248,
+	249, 250, 251, 252, 253, 254, 255, 256,
+	257, 258, 259, 260, 261, 262, 263, 264,
+	265, 266, 267, 268, 269, 270, 271, 272,
+	273, 274, 275, 276, 277, 278, 279, 280,
+	281, 282, 283, 284, 285, 286, 287, 288,
+	289, 290, 291, 292, 293, 294, 295, 296,
+	297, 298, 299, 300, 301, 302, 303, 304,
+	305, 306, 307, 308, 309, 310, 311, 312,
+	313, 314, 315, 316, 317, 318, 319, 320,
+	321, 322, 323, 324, 325, 326, 327, 328,
+	329, 330, 331, 332, 333, 334, 335, 336,
+	337, 338, 339, 340, 341, 342, 343, 344,
+	345, 346, 347, 348, 349, 350, 351, 352,
+	353, 354, 355, 356, 357, 358, 359, 360,
+	361, 362, 363, 364, 365, 366, 367, 368,
+	369, 370, 371, 372, 373, 374, 375, 376,
+	377, 378, 379, 380, 381, 382, 383, 384,
+	385, 386, 387, 388, 389, 390, 391, 392,
+	393, 394, 395, 396, 397, 398, 399, 400,
+	401, 402, 403, 404, 405, 406, 407, 408,
+	409, 410, 411, 412, 413, 414, 415, 416,
+	417, 418, 419, 420, 421, 422, 423, 424,
+	425, 426, 427, 428, 429, 430, 431, 432,
+	433, 434, 435, 436, 437, 438, 439, 440,
+	441, 442, 443, 444, 445, 446, 447, 448,
+	449, 450, 451, 452, 453, 454, 455, 456,
+	457, 458, 459, 460, 461, 462, 463, 464,
+	465, 466, 467, 468, 469, 470, 471, 472,
+	473, 474, 475, 476, 477, 478, 479, 480,
+	481, 482, 483, 484, 485, 486, 487, 488,
+	489, 490, 491, 492, 493, 494, 495, 496,
+	497, 498, 499, 500, 501, 502, 503, 504,
+	505, 506, 507, 508, 509, 510, 511,
+};
+
+#pragma DATA_SECTION(fftBandWeights1024_16000, ".const:fftBandWeights1024_16000")
+const float32_t fftBandWeights1024_16000[511] =
+{
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+};
+
+#pragma DATA_SECTION(fftBandCenters1024_16000, ".const:fftBandCenters1024_16000")
+const uint16_t fftBandCenters1024_16000[25] =
+{
+	16, 31, 50, 62, 79, 99, 125, 157,
+	198, 250, 315, 397, 500, 630, 794, 1000,
+	1260, 1587, 2000, 2520, 3175, 4000, 5040, 6350,
+	8000,
+};
+
+const bandsWeights fftBands1024_16000 =
+{
+	25, fftBandRows1024_16000, fftBandColumns1024_16000, fftBandWeights1024_16000,
+	fftBandCenters1024_16000
+};
+
+#if DSP_RUNTIME_FFT_INIT
+static arm_rfft_fast_instance_f32 fftRuntimePlan[4];
+
+// Plan for size from arm_rfft_fast_init_f32(), on first use
+static const arm_rfft_fast_instance_f32 *fftPlanInit(
+		arm_rfft_fast_instance_f32 *plan, uint16_t size)
+{
+	if (plan->fftLenRFFT != size &&
+			arm_rfft_fast_init_f32(plan, size) != ARM_MATH_SUCCESS)
+	{
+		return 0;
+	}
+	return plan;
+}
+#endif
+
+const arm_rfft_fast_instance_f32 *fftPlanRfft(uint32_t size)
+{
+	switch (size)
+	{
+	case 256:
+#if DSP_RUNTIME_FFT_INIT
+		return fftPlanInit(&fftRuntimePlan[0], 256);
+#else
+		return &fftPlan256;
+#endif
+	case 512:
+#if DSP_RUNTIME_FFT_INIT
+		return fftPlanInit(&fftRuntimePlan[1], 512);
+#else
+		return &fftPlan512;
+#endif
+	case 1024:
+#if DSP_RUNTIME_FFT_INIT
+		return fftPlanInit(&fftRuntimePlan[2], 1024);
+#else
+		return &fftPlan1024;
+#endif
+	case 2048:
+#if DSP_RUNTIME_FFT_INIT
+		return fftPlanInit(&fftRuntimePlan[3], 2048);
+#else
+		return &fftPlan2048;
+#endif
+	default:
+		return 0;
+	}
+}
+
+const float32_t *fftWindowHann(uint32_t size)
+{
+	switch (size)
+	{
+	case 256:
+		return fftWindowHann256;
+	case 512:
+		return fftWindowHann512;
+	case 1024:
+		return fftWindowHann1024;
+	default:
+		return 0;
+	}
+}
+
+const arbfftPlan *fftPlanArb(uint32_t size)
+{
+	switch (size)
+	{
+	case 245:
+		return &fftArbPlan245;
+	default:
+		return 0;
+	}
+}
+
+const bandsWeights *fftBands(uint32_t size, uint32_t rate)
+{
+	if (size == 256 && rate == 44100)
+	{
+		return &fftBands256_44100;
+	}
+	if (size == 256 && rate == 16000)
+	{
+		return &fftBands256_16000;
+	}
+	if (size == 512 && rate == 44100)
+	{
+		return &fftBands512_44100;
+	}
+	if (size == 512 && rate == 16000)
+	{
+		return &fftBands512_16000;
+	}
+	if (size == 1024 && rate == 44100)
+	{
+		return &fftBands1024_44100;
+	}
+	if (size == 1024 && rate == 16000)
+	{
+		return &fftBands1024_16000;
+	}
+	return 0;
+}
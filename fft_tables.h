@@ -0,0 +1,64 @@
+/*
+ * fft_tables.h
+ *
+ *  Generated by tools/gen_fft_tables.py for RFFT sizes 256, 512, 1024, 2048 and arbitrary length 245,
+ *  bands at 44100, 16000 Hz.
+ *  Do not edit; rerun the generator instead.
+ */
+
+#ifndef FFT_TABLES_H_
+#define FFT_TABLES_H_
+
+#include <stdint.h>
+
+#include "arm_math.h"
+#include "arbfft.h"
+#include "bands.h"
+
+extern const float32_t fftTwiddle128[256];
+extern const float32_t fftTwiddleRfft256[256];
+extern const float32_t fftWindowHann256[256];
+extern const arm_rfft_fast_instance_f32 fftPlan256;
+
+extern const float32_t fftTwiddle256[512];
+extern const float32_t fftTwiddleRfft512[512];
+extern const float32_t fftWindowHann512[512];
+extern const arm_rfft_fast_instance_f32 fftPlan512;
+
+extern const float32_t fftTwiddle512[1024];
+extern const float32_t fftTwiddleRfft1024[1024];
+extern const float32_t fftWindowHann1024[1024];
+extern const arm_rfft_fast_instance_f32 fftPlan1024;
+
+extern const float32_t fftTwiddle1024[2048];
+extern const float32_t fftTwiddleRfft2048[2048];
+extern const arm_rfft_fast_instance_f32 fftPlan2048;
+
+extern const float32_t fftArbTwiddle245[490];
+extern const arbfftPlan fftArbPlan245;
+
+// Work buffer arbfftRun needs for the arbitrary-length plan
+#define FFT_ARB_WORK_FLOATS 0
+
+extern const bandsWeights fftBands256_44100;
+extern const bandsWeights fftBands256_16000;
+extern const bandsWeights fftBands512_44100;
+extern const bandsWeights fftBands512_16000;
+extern const bandsWeights fftBands1024_44100;
+extern const bandsWeights fftBands1024_16000;
+
+// Largest band count of the generated band weights
+#define FFT_BANDS_MAX 25
+
+const arm_rfft_fast_instance_f32 *fftPlanRfft(uint32_t size);
+const float32_t *fftWindowHann(uint32_t size);
+const arbfftPlan *fftPlanArb(uint32_t size);
+const bandsWeights *fftBands(uint32_t size, uint32_t rate);
+
+/*
+ * Flash taken by tables: 36512 bytes of FFT twiddles and CMSIS
+ * bit-reversal tables, where arm_rfft_fast_init_f32() would link 78936,
+ * and 20384 bytes of windows, band weights and arbitrary-length plan.
+ */
+
+#endif /* FFT_TABLES_H_ */
@@ -0,0 +1,59 @@
+/*
+ * fir_design.c
+ *
+ *  Windowed-sinc FIR design for the fast convolution filters.
+ *
+ *  Runs once at startup, so it favours clarity over speed. numTaps
+ *  should be odd so that the filters are symmetric about a whole sample.
+ */
+
+#include <stdint.h>
+#include <math.h>
+
+#include "arm_math.h"
+#include "fir_design.h"
+
+// Ideal low-pass impulse response with cutoff fc (as a fraction of the
+// sample rate), sampled at offset n from the centre tap
+static float32_t lowPass(float32_t fc, float32_t n)
+{
+	if (n == 0.0f)
+	{
+		return 2.0f * fc;
+	}
+	return sinf(2.0f * PI * fc * n) / (PI * n);
+}
+
+static float32_t hamming(uint32_t i, uint32_t numTaps)
+{
+	return 0.54f - 0.46f * cosf(2.0f * PI * i / (numTaps - 1));
+}
+
+void firDesignBandPass(float32_t *taps, uint32_t numTaps, float32_t lowHz,
+		float32_t highHz, float32_t sampleRate)
+{
+	uint32_t i;
+	float32_t n;
+
+	for (i = 0; i < numTaps; i++)
+	{
+		n = (float32_t)i - (numTaps - 1) / 2.0f;
+		taps[i] = (lowPass(highHz / sampleRate, n) -
+				lowPass(lowHz / sampleRate, n)) * hamming(i, numTaps);
+	}
+}
+
+void firDesignBandStop(float32_t *taps, uint32_t numTaps, float32_t lowHz,
+		float32_t highHz, float32_t sampleRate)
+{
+	uint32_t i;
+
+	firDesignBandPass(taps, numTaps, lowHz, highHz, sampleRate);
+
+	// Spectral inversion: an impulse minus the band-pass
+	for (i = 0; i < numTaps; i++)
+	{
+		taps[i] = -taps[i];
+	}
+	taps[(numTaps - 1) / 2] += 1.0f;
+}
@@ -0,0 +1,19 @@
+/*
+ * fir_design.h
+ *
+ *  Windowed-sinc FIR design for the fast convolution filters.
+ */
+
+#ifndef FIR_DESIGN_H_
+#define FIR_DESIGN_H_
+
+#include <stdint.h>
+
+#include "arm_math.h"
+
+void firDesignBandPass(float32_t *taps, uint32_t numTaps, float32_t lowHz,
+		float32_t highHz, float32_t sampleRate);
+void firDesignBandStop(float32_t *taps, uint32_t numTaps, float32_t lowHz,
+		float32_t highHz, float32_t sampleRate);
+
+#endif /* FIR_DESIGN_H_ */
@@ -0,0 +1,113 @@
+/*
+ * ramfunc.c
+ *
+ *  Copies hot code and lookup tables from flash into SRAM at startup.
+ */
+
+#include <stdint.h>
+
+#include "ramfunc.h"
+#include "report.h"
+
+// Linker symbols for the .ramfunc and .ramconst sections, see
+// tm4c1294ncpdt.cmd. The value of a SIZE() symbol is its address.
+extern uint32_t ramfuncLoadStart;
+extern uint32_t ramfuncRunStart;
+extern uint32_t ramfuncSize;
+extern uint32_t ramconstLoadStart;
+extern uint32_t ramconstRunStart;
+extern uint32_t ramconstSize;
+
+static ramfuncRegion ramfuncRegions[2];
+
+static int rangesOverlap(const void *a, uint32_t sizeA, const void *b, uint32_t sizeB)
+{
+	return sizeA && sizeB &&
+			((uintptr_t)a < (uintptr_t)b + sizeB) &&
+			((uintptr_t)b < (uintptr_t)a + sizeA);
+}
+
+ramfuncStatus ramfuncRelocate(const ramfuncRegion *regions, uint32_t count)
+{
+	uint32_t i, j, word;
+
+	// Check every region before copying anything, so a bad link never
+	// leaves half of the code relocated
+	for (i = 0; i < count; i++)
+	{
+		if (((uintptr_t)regions[i].load | (uintptr_t)regions[i].run |
+				regions[i].size) & 3)
+		{
+			return RAMFUNC_MISALIGNED;
+		}
+
+		if (regions[i].load != regions[i].run &&
+				rangesOverlap(regions[i].load, regions[i].size,
+						regions[i].run, regions[i].size))
+		{
+			return RAMFUNC_OVERLAP;
+		}
+
+		for (j = 0; j < i; j++)
+		{
+			if (rangesOverlap(regions[i].run, regions[i].size,
+					regions[j].run, regions[j].size))
+			{
+				return RAMFUNC_OVERLAP;
+			}
+		}
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		// Sections linked to run in place need no copy
+		if (regions[i].load == regions[i].run)
+		{
+			continue;
+		}
+
+		for (word = 0; word < regions[i].size / sizeof(uint32_t); word++)
+		{
+			regions[i].run[word] = regions[i].load[word];
+		}
+	}
+
+	return RAMFUNC_OK;
+}
+
+void ramfuncInit(void)
+{
+	ramfuncRegions[0].name = ".ramfunc";
+	ramfuncRegions[0].load = &ramfuncLoadStart;
+	ramfuncRegions[0].run = &ramfuncRunStart;
+	ramfuncRegions[0].size = (uint32_t)(uintptr_t)&ramfuncSize;
+
+	ramfuncRegions[1].name = ".ramconst";
+	ramfuncRegions[1].load = &ramconstLoadStart;
+	ramfuncRegions[1].run = &ramconstRunStart;
+	ramfuncRegions[1].size = (uint32_t)(uintptr_t)&ramconstSize;
+
+	if (ramfuncRelocate(ramfuncRegions, 2) != RAMFUNC_OK)
+	{
+		// The linker command file placed the sections inconsistently.
+		// Enter an infinite loop, preserving the system state for
+		// examination by a debugger.
+		while(1)
+		{
+		}
+	}
+}
+
+void ramfuncReport(void)
+{
+	uint32_t i;
+
+	for (i = 0; i < 2; i++)
+	{
+		reportString(ramfuncRegions[i].name);
+		reportString(ramfuncRegions[i].load == ramfuncRegions[i].run ?
+				": in flash, " : ": copied to SRAM, ");
+		reportUint(ramfuncRegions[i].size);
+		reportString(" bytes\n");
+	}
+}
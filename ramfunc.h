@@ -0,0 +1,37 @@
+/*
+ * ramfunc.h
+ *
+ *  Copies hot code and lookup tables from flash into SRAM at startup.
+ *
+ *  At 120 MHz the flash needs wait states, so the sections listed under
+ *  .ramfunc and .ramconst in tm4c1294ncpdt.cmd are linked to run from
+ *  SRAM but loaded into flash. ramfuncInit() must run before any of
+ *  them is called or read, and before interrupts are enabled.
+ */
+
+#ifndef RAMFUNC_H_
+#define RAMFUNC_H_
+
+#include <stdint.h>
+
+// One load (flash) to run (SRAM) copy
+typedef struct
+{
+	const char *name;
+	const uint32_t *load;
+	uint32_t *run;
+	uint32_t size;
+} ramfuncRegion;
+
+typedef enum
+{
+	RAMFUNC_OK,
+	RAMFUNC_MISALIGNED,
+	RAMFUNC_OVERLAP
+} ramfuncStatus;
+
+ramfuncStatus ramfuncRelocate(const ramfuncRegion *regions, uint32_t count);
+void ramfuncInit(void);
+void ramfuncReport(void);
+
+#endif /* RAMFUNC_H_ */
@@ -0,0 +1,101 @@
+/*
+ * report.c
+ *
+ *  Plain text output over UART0 (the ICDI virtual COM port).
+ *
+ *  Output is blocking and meant for start-up reports and debugging,
+ *  never for use from an ISR.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "driverlib/rom.h"
+#include "driverlib/rom_map.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/gpio.h"
+#include "driverlib/pin_map.h"
+#include "driverlib/uart.h"
+
+#include "inc/hw_memmap.h"
+
+#include "report.h"
+
+void reportInit(uint32_t sysClock)
+{
+	MAP_SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOA);
+	MAP_SysCtlPeripheralEnable(SYSCTL_PERIPH_UART0);
+
+	MAP_SysCtlDelay(2);
+
+	MAP_GPIOPinConfigure(GPIO_PA0_U0RX);
+	MAP_GPIOPinConfigure(GPIO_PA1_U0TX);
+	MAP_GPIOPinTypeUART(GPIO_PORTA_BASE, GPIO_PIN_0 | GPIO_PIN_1);
+
+	MAP_UARTConfigSetExpClk(UART0_BASE, sysClock, REPORT_BAUD_RATE,
+			UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE | UART_CONFIG_PAR_NONE);
+}
+
+void reportString(const char *str)
+{
+	while (*str)
+	{
+		if (*str == '\n')
+		{
+			MAP_UARTCharPut(UART0_BASE, '\r');
+		}
+		MAP_UARTCharPut(UART0_BASE, *str++);
+	}
+}
+
+void reportUint(uint32_t value)
+{
+	char digits[11];
+	int i = sizeof(digits) - 1;
+
+	digits[i] = '\0';
+	do
+	{
+		digits[--i] = '0' + (value % 10);
+		value /= 10;
+	} while (value);
+
+	reportString(&digits[i]);
+}
+
+void reportInt(int32_t value)
+{
+	if (value < 0)
+	{
+		reportString("-");
+		reportUint((uint32_t)0 - (uint32_t)value);
+	}
+	else
+	{
+		reportUint((uint32_t)value);
+	}
+}
+
+// Integer part of a level in dB or the like. The infinities log10f()
+// gives for a zero energy, and anything else past REPORT_LEVEL_LIMIT,
+// print as the limit and NaN as 0, as none of them has an int32_t
+// conversion.
+void reportLevel(float value)
+{
+	if (value != value)
+	{
+		reportInt(0);
+	}
+	else if (value < -REPORT_LEVEL_LIMIT)
+	{
+		reportInt(-REPORT_LEVEL_LIMIT);
+	}
+	else if (value > REPORT_LEVEL_LIMIT)
+	{
+		reportInt(REPORT_LEVEL_LIMIT);
+	}
+	else
+	{
+		reportInt((int32_t)value);
+	}
+}
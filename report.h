@@ -0,0 +1,23 @@
+/*
+ * report.h
+ *
+ *  Plain text output over UART0 (the ICDI virtual COM port).
+ */
+
+#ifndef REPORT_H_
+#define REPORT_H_
+
+#include <stdint.h>
+
+#define REPORT_BAUD_RATE 115200
+
+// Largest magnitude reportLevel() prints
+#define REPORT_LEVEL_LIMIT 9999
+
+void reportInit(uint32_t sysClock);
+void reportString(const char *str);
+void reportUint(uint32_t value);
+void reportInt(int32_t value);
+void reportLevel(float value);
+
+#endif /* REPORT_H_ */
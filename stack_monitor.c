@@ -0,0 +1,136 @@
+/*
+ * stack_monitor.c
+ *
+ *  Stack high-water mark, per-ISR peak depth and overflow guard.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "stack_monitor.h"
+#include "report.h"
+
+static uint32_t *stackBase;
+static uint32_t *stackTop;
+
+static uint32_t isrPeak[STACK_ISR_COUNT];
+static uint32_t isrNesting;
+static uint32_t isrMaxNesting;
+
+// Set by an ISR that found the guard overwritten, for stackCheckGuard()
+static volatile bool guardTripped;
+
+void stackMonitorInit(uint32_t *base, uint32_t *top)
+{
+	uint32_t i;
+
+	stackBase = base;
+	stackTop = top;
+
+	for (i = 0; i < STACK_ISR_COUNT; i++)
+	{
+		isrPeak[i] = 0;
+	}
+	isrNesting = 0;
+	isrMaxNesting = 0;
+	guardTripped = false;
+
+	*stackBase = STACK_GUARD_WORD;
+}
+
+uint32_t stackHighWaterMark(void)
+{
+	uint32_t *word = stackBase + 1;
+
+	while (word < stackTop && *word == STACK_PAINT_WORD)
+	{
+		word++;
+	}
+
+	return (uint32_t)((uint8_t *)stackTop - (uint8_t *)word);
+}
+
+uint32_t stackIsrPeak(stackIsr isr)
+{
+	return isrPeak[isr];
+}
+
+uint32_t stackMaxNesting(void)
+{
+	return isrMaxNesting;
+}
+
+void stackIsrEnter(stackIsr isr)
+{
+	uint32_t marker;
+
+	stackIsrEnterAt(isr, (uintptr_t)&marker);
+}
+
+void stackIsrEnterAt(stackIsr isr, uintptr_t sp)
+{
+	uint32_t depth = (uint32_t)((uintptr_t)stackTop - sp);
+
+	if (depth > isrPeak[isr])
+	{
+		isrPeak[isr] = depth;
+	}
+
+	if (++isrNesting > isrMaxNesting)
+	{
+		isrMaxNesting = isrNesting;
+	}
+}
+
+// Runs at the sample rate, so it only does a single load and compare;
+// reporting is left to stackCheckGuard() in the main loop
+void stackIsrExit(stackIsr isr)
+{
+	isrNesting--;
+
+	if (*stackBase != STACK_GUARD_WORD)
+	{
+		guardTripped = true;
+	}
+}
+
+bool stackGuardIntact(void)
+{
+	return *stackBase == STACK_GUARD_WORD;
+}
+
+// Main loop only: reports over the UART before halting
+void stackCheckGuard(void)
+{
+	if (guardTripped || !stackGuardIntact())
+	{
+		reportString("Stack overflow: guard word overwritten\n");
+
+		// Whatever sits below the stack has been corrupted. Enter an
+		// infinite loop, preserving the system state for examination
+		// by a debugger.
+		while(1)
+		{
+		}
+	}
+}
+
+// Main loop only, see stackHighWaterMark()
+void stackReport(void)
+{
+	uint32_t i;
+
+	reportString("Stack: high-water mark ");
+	reportUint(stackHighWaterMark());
+	reportString(" of ");
+	reportUint((uint32_t)((uint8_t *)stackTop - (uint8_t *)stackBase));
+	reportString(" bytes, ISR entry peak");
+	for (i = 0; i < STACK_ISR_COUNT; i++)
+	{
+		reportString(" ");
+		reportUint(isrPeak[i]);
+	}
+	reportString(", max nesting ");
+	reportUint(isrMaxNesting);
+	reportString("\n");
+}
@@ -0,0 +1,52 @@
+/*
+ * stack_monitor.h
+ *
+ *  Stack high-water mark, per-ISR peak depth and overflow guard.
+ *
+ *  ResetISR() paints the whole .stack section with STACK_PAINT_WORD
+ *  before jumping to the C runtime; the high-water mark is the deepest
+ *  word that no longer holds the paint. The lowest word of the region
+ *  holds STACK_GUARD_WORD; ISR exits only flag it being overwritten,
+ *  and stackCheckGuard() reports and halts from the main loop.
+ *
+ *  The high-water mark is a linear scan of the painted region, so it
+ *  is only taken from the main loop or the report path, never from an
+ *  ISR.
+ *
+ *  The monitor only works on the region passed to stackMonitorInit(), so
+ *  it can equally be pointed at a simulated stack.
+ */
+
+#ifndef STACK_MONITOR_H_
+#define STACK_MONITOR_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define STACK_PAINT_WORD 0xDEADBEEF
+#define STACK_GUARD_WORD 0x5AFEC0DE
+
+// ISRs that report their stack depth. Peak depth is the deepest stack
+// pointer seen on entry; what the handler itself pushes shows up in the
+// overall high-water mark.
+typedef enum
+{
+	STACK_ISR_ADC0,
+	STACK_ISR_COUNT
+} stackIsr;
+
+void stackMonitorInit(uint32_t *base, uint32_t *top);
+
+uint32_t stackHighWaterMark(void);
+uint32_t stackIsrPeak(stackIsr isr);
+uint32_t stackMaxNesting(void);
+
+void stackIsrEnter(stackIsr isr);
+void stackIsrEnterAt(stackIsr isr, uintptr_t sp);
+void stackIsrExit(stackIsr isr);
+
+bool stackGuardIntact(void);
+void stackCheckGuard(void);
+void stackReport(void);
+
+#endif /* STACK_MONITOR_H_ */
@@ -0,0 +1,90 @@
+/*
+ * telemetry.c
+ *
+ *  Running counters for sample capture, frame hand-over and deadlines.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "telemetry.h"
+#include "report.h"
+
+static volatile telemetryCounters counters;
+
+// Bumped after every ISR side update
+static volatile uint32_t isrGeneration;
+
+void telemetrySample(uint32_t latencyCycles, bool overflow, bool underflow)
+{
+	counters.samplesCaptured++;
+
+	if (overflow)
+	{
+		counters.adcOverflows++;
+	}
+	if (underflow)
+	{
+		counters.adcUnderflows++;
+	}
+	if (latencyCycles > counters.isrMaxLatency)
+	{
+		counters.isrMaxLatency = latencyCycles;
+	}
+
+	isrGeneration++;
+}
+
+void telemetryFrameDropped(void)
+{
+	counters.framesDropped++;
+	isrGeneration++;
+}
+
+// cycles is how long the frame took to process; more than budgetCycles
+// (one frame of samples) means the main loop is falling behind
+void telemetryFrameCompleted(uint32_t cycles, uint32_t budgetCycles)
+{
+	counters.framesCompleted++;
+
+	if (cycles > budgetCycles)
+	{
+		counters.deadlineMisses++;
+	}
+}
+
+// Must be called from the main loop. The ISR cannot be interrupted by
+// it, so an unchanged generation means no ISR update fell inside the copy.
+void telemetrySnapshot(telemetryCounters *snapshot)
+{
+	uint32_t generation;
+
+	do
+	{
+		generation = isrGeneration;
+		*snapshot = counters;
+	} while (generation != isrGeneration);
+}
+
+void telemetryReport(void)
+{
+	telemetryCounters snapshot;
+
+	telemetrySnapshot(&snapshot);
+
+	reportString("Samples ");
+	reportUint(snapshot.samplesCaptured);
+	reportString(", frames ");
+	reportUint(snapshot.framesCompleted);
+	reportString(", dropped ");
+	reportUint(snapshot.framesDropped);
+	reportString(", adc overflow ");
+	reportUint(snapshot.adcOverflows);
+	reportString(", underflow ");
+	reportUint(snapshot.adcUnderflows);
+	reportString(", isr latency ");
+	reportUint(snapshot.isrMaxLatency);
+	reportString(", deadline misses ");
+	reportUint(snapshot.deadlineMisses);
+	reportString("\n");
+}
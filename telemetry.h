@@ -0,0 +1,43 @@
+/*
+ * telemetry.h
+ *
+ *  Running counters for sample capture, frame hand-over and deadlines.
+ *
+ *  Counters only ever increase (ISR latency keeps its maximum) and are
+ *  updated from two contexts: the ADC ISR and the main loop. Each ISR
+ *  update also bumps a generation count, so the main loop can copy a
+ *  consistent snapshot by retrying if the ISR ran during the copy,
+ *  without masking interrupts.
+ *
+ *  The module never touches the hardware; callers pass in what they
+ *  measured, so it can equally be driven by a simulated stream.
+ */
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct
+{
+	uint32_t samplesCaptured;
+	uint32_t framesCompleted;       // processed by the main loop
+	uint32_t framesDropped;         // refilled because no buffer was free
+	uint32_t adcOverflows;          // sequencer FIFO overflow, lost samples
+	uint32_t adcUnderflows;         // sequencer FIFO read while empty
+	uint32_t isrMaxLatency;         // cycles from trigger to ISR entry
+	uint32_t deadlineMisses;        // frames processed slower than real time
+} telemetryCounters;
+
+// ADC ISR side
+void telemetrySample(uint32_t latencyCycles, bool overflow, bool underflow);
+void telemetryFrameDropped(void);
+
+// Main loop side
+void telemetryFrameCompleted(uint32_t cycles, uint32_t budgetCycles);
+
+void telemetrySnapshot(telemetryCounters *snapshot);
+void telemetryReport(void);
+
+#endif /* TELEMETRY_H_ */
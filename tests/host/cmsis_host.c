@@ -0,0 +1,450 @@
+/*
+ * cmsis_host.c
+ *
+ *  Host implementations of the CMSIS-DSP functions the firmware calls,
+ *  with the same data layouts and scaling:
+ *
+ *  - arm_cfft_f32: in-place complex FFT, inverse scaled by 1 / N
+ *  - arm_rfft_fast_f32: packed real FFT (element 0 the DC bin, element
+ *    1 the Nyquist bin), inverse scaled so it undoes the forward one.
+ *    Like CMSIS, it uses its input as scratch, so the forward transform
+ *    leaves garbage there.
+ *  - arm_fir_decimate_f32: output n is the filter at input n * M
+ *
+ *  The FFTs are plain radix-2 with a shared twiddle table, so they are
+ *  only as fast as a simple O(N log N) FFT on the host. Of the plan's
+ *  tables only the RFFT split twiddles are read, so a table in the wrong
+ *  layout shows up in the host tests; plans without them (pTwiddleRFFT
+ *  zero) fall back to the shared table. The generated bit-reversal
+ *  tables are defined as stubs.
+ *  Each RFFT spends hostRfftCycles of simulated time, see hw_host.h.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+#include "hw_host.h"
+
+// Largest complex FFT: the 8192-point RFFT, or a 4096-point CFFT
+#define HOST_FFT_MAX 4096
+
+static DWT_Type hostDwt;
+static CoreDebug_Type hostCoreDebug;
+DWT_Type *DWT = &hostDwt;
+CoreDebug_Type *CoreDebug = &hostCoreDebug;
+
+const uint16_t armBitRevIndexTable16[1];
+const uint16_t armBitRevIndexTable32[1];
+const uint16_t armBitRevIndexTable64[1];
+const uint16_t armBitRevIndexTable128[1];
+const uint16_t armBitRevIndexTable256[1];
+const uint16_t armBitRevIndexTable512[1];
+const uint16_t armBitRevIndexTable1024[1];
+const uint16_t armBitRevIndexTable2048[1];
+const uint16_t armBitRevIndexTable4096[1];
+
+// exp(-2 pi i k / (2 HOST_FFT_MAX)), enough for the RFFT split too
+static float32_t twiddleRe[HOST_FFT_MAX];
+static float32_t twiddleIm[HOST_FFT_MAX];
+static int twiddleReady;
+
+static float32_t work[2 * HOST_FFT_MAX];
+
+static void initTwiddles(void)
+{
+	uint32_t k;
+
+	for (k = 0; k < HOST_FFT_MAX; k++)
+	{
+		twiddleRe[k] = (float32_t)cos(M_PI * k / HOST_FFT_MAX);
+		twiddleIm[k] = (float32_t)-sin(M_PI * k / HOST_FFT_MAX);
+	}
+	twiddleReady = 1;
+}
+
+// exp(-+2 pi i k / n), n a power of two up to 2 * HOST_FFT_MAX
+static void twiddle(uint32_t k, uint32_t n, int inverse, float32_t *re, float32_t *im)
+{
+	uint32_t index = k * (2 * HOST_FFT_MAX / n);
+
+	if (!twiddleReady)
+	{
+		initTwiddles();
+	}
+
+	if (index < HOST_FFT_MAX)
+	{
+		*re = twiddleRe[index];
+		*im = twiddleIm[index];
+	}
+	else
+	{
+		// exp(-i (pi + a)) = -exp(-i a)
+		*re = -twiddleRe[index - HOST_FFT_MAX];
+		*im = -twiddleIm[index - HOST_FFT_MAX];
+	}
+
+	if (inverse)
+	{
+		*im = -*im;
+	}
+}
+
+// Unscaled in-place radix-2 FFT of n interleaved complex values
+static void fft(float32_t *data, uint32_t n, int inverse)
+{
+	uint32_t i, j, bit, length, half, k;
+	float32_t wr, wi, tr, ti;
+
+	for (i = 1, j = 0; i < n; i++)
+	{
+		for (bit = n >> 1; j & bit; bit >>= 1)
+		{
+			j ^= bit;
+		}
+		j |= bit;
+
+		if (i < j)
+		{
+			tr = data[2 * i];
+			ti = data[2 * i + 1];
+			data[2 * i] = data[2 * j];
+			data[2 * i + 1] = data[2 * j + 1];
+			data[2 * j] = tr;
+			data[2 * j + 1] = ti;
+		}
+	}
+
+	for (length = 2; length <= n; length <<= 1)
+	{
+		half = length >> 1;
+		for (k = 0; k < half; k++)
+		{
+			twiddle(k, length, inverse, &wr, &wi);
+			for (i = k; i < n; i += length)
+			{
+				j = i + half;
+				tr = data[2 * j] * wr - data[2 * j + 1] * wi;
+				ti = data[2 * j] * wi + data[2 * j + 1] * wr;
+				data[2 * j] = data[2 * i] - tr;
+				data[2 * j + 1] = data[2 * i + 1] - ti;
+				data[2 * i] += tr;
+				data[2 * i + 1] += ti;
+			}
+		}
+	}
+}
+
+void arm_cfft_f32(const arm_cfft_instance_f32 *S, float32_t *p1, uint8_t ifftFlag,
+		uint8_t bitReverseFlag)
+{
+	uint32_t n = S->fftLen;
+	uint32_t i;
+
+	fft(p1, n, ifftFlag);
+
+	if (ifftFlag)
+	{
+		for (i = 0; i < 2 * n; i++)
+		{
+			p1[i] /= (float32_t)n;
+		}
+	}
+}
+
+// sin and cos of 2 pi k / N from the plan's twiddleCoef_rfft layout, or
+// from the shared table for plans built on the host without one
+static void rfftTwiddle(const arm_rfft_fast_instance_f32 *S, uint32_t k,
+		float32_t *twR, float32_t *twI)
+{
+	float32_t re, im;
+
+	if (S->pTwiddleRFFT)
+	{
+		*twR = S->pTwiddleRFFT[2 * k];
+		*twI = S->pTwiddleRFFT[2 * k + 1];
+	}
+	else
+	{
+		twiddle(k, S->fftLenRFFT, 0, &re, &im);
+		*twR = -im;
+		*twI = re;
+	}
+}
+
+// Real FFT of N points through an N/2 point complex FFT of the even and
+// odd samples, then the split step of CMSIS stage_rfft_f32() and
+// merge_rfft_f32(), reading the plan's twiddles the same way
+void arm_rfft_fast_f32(arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut,
+		uint8_t ifftFlag)
+{
+	uint32_t n = S->fftLenRFFT;
+	uint32_t m = n / 2;
+	uint32_t k;
+	float32_t twR, twI, xAR, xAI, xBR, xBI, t1a, t1b;
+
+	hostAdvance(hostRfftCycles);
+
+	if (!ifftFlag)
+	{
+		memcpy(work, p, n * sizeof(float32_t));
+		fft(work, m, 0);
+
+		pOut[0] = work[0] + work[1];
+		pOut[1] = work[0] - work[1];
+		for (k = 1; k < m; k++)
+		{
+			// Z[k] and Z[m - k]
+			xAR = work[2 * k];
+			xAI = work[2 * k + 1];
+			xBR = work[2 * (m - k)];
+			xBI = work[2 * (m - k) + 1];
+
+			rfftTwiddle(S, k, &twR, &twI);
+			t1a = xBR - xAR;
+			t1b = xBI + xAI;
+			pOut[2 * k] = 0.5f * (xAR + xBR + twR * t1a + twI * t1b);
+			pOut[2 * k + 1] = 0.5f * (xAI - xBI + twI * t1a - twR * t1b);
+		}
+
+		// CMSIS uses the input as scratch
+		for (k = 0; k < n; k++)
+		{
+			p[k] = 12345.0f;
+		}
+	}
+	else
+	{
+		work[0] = 0.5f * (p[0] + p[1]);
+		work[1] = 0.5f * (p[0] - p[1]);
+		for (k = 1; k < m; k++)
+		{
+			// X[k] and X[m - k]
+			xAR = p[2 * k];
+			xAI = p[2 * k + 1];
+			xBR = p[2 * (m - k)];
+			xBI = p[2 * (m - k) + 1];
+
+			rfftTwiddle(S, k, &twR, &twI);
+			t1a = xAR - xBR;
+			t1b = xAI + xBI;
+			work[2 * k] = 0.5f * (xAR + xBR - twR * t1a - twI * t1b);
+			work[2 * k + 1] = 0.5f * (xAI - xBI + twI * t1a - twR * t1b);
+		}
+
+		fft(work, m, 1);
+		for (k = 0; k < n; k++)
+		{
+			pOut[k] = work[k] / (float32_t)m;
+		}
+	}
+}
+
+// For DSP_RUNTIME_FFT_INIT builds. The lengths CMSIS supports; the plan
+// gets no twiddles, so the split step uses the shared table
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 *S, uint16_t fftLen)
+{
+	if (fftLen < 32 || fftLen > 2 * HOST_FFT_MAX || (fftLen & (fftLen - 1)))
+	{
+		return ARM_MATH_ARGUMENT_ERROR;
+	}
+
+	S->fftLenRFFT = fftLen;
+	S->Sint.fftLen = fftLen / 2;
+	S->pTwiddleRFFT = 0;
+
+	return ARM_MATH_SUCCESS;
+}
+
+void arm_cmplx_mag_f32(float32_t *pSrc, float32_t *pDst, uint32_t numSamples)
+{
+	uint32_t i;
+
+	for (i = 0; i < numSamples; i++)
+	{
+		pDst[i] = sqrtf(pSrc[2 * i] * pSrc[2 * i] + pSrc[2 * i + 1] * pSrc[2 * i + 1]);
+	}
+}
+
+void arm_cmplx_mag_squared_f32(float32_t *pSrc, float32_t *pDst, uint32_t numSamples)
+{
+	uint32_t i;
+
+	for (i = 0; i < numSamples; i++)
+	{
+		pDst[i] = pSrc[2 * i] * pSrc[2 * i] + pSrc[2 * i + 1] * pSrc[2 * i + 1];
+	}
+}
+
+void arm_cmplx_mult_cmplx_f32(float32_t *pSrcA, float32_t *pSrcB, float32_t *pDst,
+		uint32_t numSamples)
+{
+	uint32_t i;
+	float32_t ar, ai, br, bi;
+
+	for (i = 0; i < numSamples; i++)
+	{
+		ar = pSrcA[2 * i];
+		ai = pSrcA[2 * i + 1];
+		br = pSrcB[2 * i];
+		bi = pSrcB[2 * i + 1];
+		pDst[2 * i] = ar * br - ai * bi;
+		pDst[2 * i + 1] = ar * bi + ai * br;
+	}
+}
+
+void arm_max_f32(float32_t *pSrc, uint32_t blockSize, float32_t *pResult,
+		uint32_t *pIndex)
+{
+	uint32_t i;
+
+	*pResult = pSrc[0];
+	*pIndex = 0;
+	for (i = 1; i < blockSize; i++)
+	{
+		if (pSrc[i] > *pResult)
+		{
+			*pResult = pSrc[i];
+			*pIndex = i;
+		}
+	}
+}
+
+void arm_mult_f32(float32_t *pSrcA, float32_t *pSrcB, float32_t *pDst,
+		uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = pSrcA[i] * pSrcB[i];
+	}
+}
+
+void arm_scale_f32(float32_t *pSrc, float32_t scale, float32_t *pDst,
+		uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = pSrc[i] * scale;
+	}
+}
+
+void arm_copy_f32(float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+	memmove(pDst, pSrc, blockSize * sizeof(float32_t));
+}
+
+void arm_fill_f32(float32_t value, float32_t *pDst, uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = value;
+	}
+}
+
+void arm_power_f32(float32_t *pSrc, uint32_t blockSize, float32_t *pResult)
+{
+	uint32_t i;
+	float32_t sum = 0.0f;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		sum += pSrc[i] * pSrc[i];
+	}
+	*pResult = sum;
+}
+
+void arm_dot_prod_f32(float32_t *pSrcA, float32_t *pSrcB, uint32_t blockSize,
+		float32_t *result)
+{
+	uint32_t i;
+	float32_t sum = 0.0f;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		sum += pSrcA[i] * pSrcB[i];
+	}
+	*result = sum;
+}
+
+// State: numTaps - 1 samples of history followed by blockSize new ones
+arm_status arm_fir_decimate_init_f32(arm_fir_decimate_instance_f32 *S,
+		uint16_t numTaps, uint8_t M, float32_t *pCoeffs, float32_t *pState,
+		uint32_t blockSize)
+{
+	if (blockSize % M)
+	{
+		return ARM_MATH_LENGTH_ERROR;
+	}
+
+	S->M = M;
+	S->numTaps = numTaps;
+	S->pCoeffs = pCoeffs;
+	S->pState = pState;
+	memset(pState, 0, (numTaps + blockSize - 1) * sizeof(float32_t));
+
+	return ARM_MATH_SUCCESS;
+}
+
+void arm_fir_decimate_f32(const arm_fir_decimate_instance_f32 *S, float32_t *pSrc,
+		float32_t *pDst, uint32_t blockSize)
+{
+	uint32_t numTaps = S->numTaps;
+	uint32_t i, k;
+	float32_t *history = S->pState;
+	float32_t sum;
+
+	memcpy(&history[numTaps - 1], pSrc, blockSize * sizeof(float32_t));
+
+	for (i = 0; i < blockSize / S->M; i++)
+	{
+		sum = 0.0f;
+		for (k = 0; k < numTaps; k++)
+		{
+			sum += S->pCoeffs[k] * history[i * S->M + numTaps - 1 - k];
+		}
+		pDst[i] = sum;
+	}
+
+	memmove(history, &history[blockSize], (numTaps - 1) * sizeof(float32_t));
+}
+
+void arm_fir_init_f32(arm_fir_instance_f32 *S, uint16_t numTaps, float32_t *pCoeffs,
+		float32_t *pState, uint32_t blockSize)
+{
+	S->numTaps = numTaps;
+	S->pCoeffs = pCoeffs;
+	S->pState = pState;
+	memset(pState, 0, (numTaps + blockSize - 1) * sizeof(float32_t));
+}
+
+void arm_fir_f32(const arm_fir_instance_f32 *S, float32_t *pSrc, float32_t *pDst,
+		uint32_t blockSize)
+{
+	uint32_t numTaps = S->numTaps;
+	uint32_t i, k;
+	float32_t *history = S->pState;
+	float32_t sum;
+
+	memcpy(&history[numTaps - 1], pSrc, blockSize * sizeof(float32_t));
+
+	for (i = 0; i < blockSize; i++)
+	{
+		sum = 0.0f;
+		for (k = 0; k < numTaps; k++)
+		{
+			sum += S->pCoeffs[k] * history[i + numTaps - 1 - k];
+		}
+		pDst[i] = sum;
+	}
+
+	memmove(history, &history[blockSize], (numTaps - 1) * sizeof(float32_t));
+}
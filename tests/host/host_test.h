@@ -0,0 +1,25 @@
+/*
+ * host_test.h
+ *
+ *  Check macro shared by the host tests.
+ */
+
+#ifndef HOST_TEST_H_
+#define HOST_TEST_H_
+
+#include <stdio.h>
+
+// Counts and prints a failed check without stopping the test
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			testFailures++; \
+		} \
+	} while (0)
+
+static int testFailures;
+
+#endif /* HOST_TEST_H_ */
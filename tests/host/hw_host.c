@@ -0,0 +1,92 @@
+/*
+ * hw_host.c
+ *
+ *  Host stand-in for the peripherals behind tivaware_host.h. Tests set
+ *  the hostAdc* and hostUartEcho variables to drive them.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "arm_math.h"
+#include "tivaware_host.h"
+#include "hw_host.h"
+
+uint32_t hostTimerLoad;
+uint32_t hostTimerElapsed;
+uint32_t hostAdcValue;
+bool hostAdcOverflow;
+bool hostAdcUnderflow;
+bool hostUartEcho;
+uint32_t hostUartChars;
+void (*hostSampleInterrupt)(void);
+uint32_t hostUartCharCycles;
+uint32_t hostRfftCycles;
+
+uint32_t hostSysCtlClockFreqSet(uint32_t config, uint32_t frequency)
+{
+	return frequency;
+}
+
+void hostTimerLoadSet(uint32_t load)
+{
+	hostTimerLoad = load;
+}
+
+uint32_t hostTimerLoadGet(void)
+{
+	return hostTimerLoad;
+}
+
+// The timer counts down from its load value after each trigger
+uint32_t hostTimerValueGet(void)
+{
+	return hostTimerLoad - hostTimerElapsed;
+}
+
+int32_t hostAdcSequenceDataGet(uint32_t *buffer)
+{
+	*buffer = hostAdcValue;
+	return 1;
+}
+
+bool hostAdcSequenceOverflow(void)
+{
+	return hostAdcOverflow;
+}
+
+bool hostAdcSequenceUnderflow(void)
+{
+	return hostAdcUnderflow;
+}
+
+void hostUartCharPut(char c)
+{
+	hostUartChars++;
+	if (hostUartEcho)
+	{
+		putchar(c);
+	}
+	hostAdvance(hostUartCharCycles);
+}
+
+// Steps to each TIMER1 trigger in turn, so the interrupt sees the
+// counter at the moment it fires
+void hostAdvance(uint32_t cycles)
+{
+	uint32_t step;
+
+	while (hostSampleInterrupt && hostTimerLoad &&
+			hostTimerLoad - hostTimerElapsed <= cycles)
+	{
+		step = hostTimerLoad - hostTimerElapsed;
+		DWT->CYCCNT += step;
+		cycles -= step;
+		hostTimerElapsed = 0;
+		hostSampleInterrupt();
+	}
+
+	DWT->CYCCNT += cycles;
+	hostTimerElapsed += cycles;
+}
@@ -0,0 +1,37 @@
+/*
+ * hw_host.h
+ *
+ *  Peripheral state of the host stand-ins, see hw_host.c.
+ */
+
+#ifndef HW_HOST_H_
+#define HW_HOST_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// TIMER1 load value and the ticks since its last trigger
+extern uint32_t hostTimerLoad;
+extern uint32_t hostTimerElapsed;
+
+// Next ADC result and sequencer status
+extern uint32_t hostAdcValue;
+extern bool hostAdcOverflow;
+extern bool hostAdcUnderflow;
+
+// UART0 output: echoed to stdout if set, and counted
+extern bool hostUartEcho;
+extern uint32_t hostUartChars;
+
+// Simulated time. hostAdvance() moves the cycle counter on and, as
+// TIMER1 would, calls hostSampleInterrupt (if set) each time another
+// hostTimerLoad cycles have passed. The UART and RFFT stand-ins spend
+// hostUartCharCycles and hostRfftCycles through it, so a test can make
+// the main loop block or overrun while the interrupt keeps sampling.
+extern void (*hostSampleInterrupt)(void);
+extern uint32_t hostUartCharCycles;
+extern uint32_t hostRfftCycles;
+
+void hostAdvance(uint32_t cycles);
+
+#endif /* HW_HOST_H_ */
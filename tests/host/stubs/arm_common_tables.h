@@ -0,0 +1,33 @@
+/*
+ * arm_common_tables.h
+ *
+ *  Host stand-in: bit-reversal table lengths as in CMSIS-DSP. The host
+ *  FFT in cmsis_host.c does not read the tables.
+ */
+
+#ifndef ARM_COMMON_TABLES_H
+#define ARM_COMMON_TABLES_H
+
+#include "arm_math.h"
+
+#define ARMBITREVINDEXTABLE__16_TABLE_LENGTH ((uint16_t)20)
+#define ARMBITREVINDEXTABLE__32_TABLE_LENGTH ((uint16_t)48)
+#define ARMBITREVINDEXTABLE__64_TABLE_LENGTH ((uint16_t)56)
+#define ARMBITREVINDEXTABLE_128_TABLE_LENGTH ((uint16_t)208)
+#define ARMBITREVINDEXTABLE_256_TABLE_LENGTH ((uint16_t)440)
+#define ARMBITREVINDEXTABLE_512_TABLE_LENGTH ((uint16_t)448)
+#define ARMBITREVINDEXTABLE1024_TABLE_LENGTH ((uint16_t)1800)
+#define ARMBITREVINDEXTABLE2048_TABLE_LENGTH ((uint16_t)3808)
+#define ARMBITREVINDEXTABLE4096_TABLE_LENGTH ((uint16_t)4032)
+
+extern const uint16_t armBitRevIndexTable16[];
+extern const uint16_t armBitRevIndexTable32[];
+extern const uint16_t armBitRevIndexTable64[];
+extern const uint16_t armBitRevIndexTable128[];
+extern const uint16_t armBitRevIndexTable256[];
+extern const uint16_t armBitRevIndexTable512[];
+extern const uint16_t armBitRevIndexTable1024[];
+extern const uint16_t armBitRevIndexTable2048[];
+extern const uint16_t armBitRevIndexTable4096[];
+
+#endif /* ARM_COMMON_TABLES_H */
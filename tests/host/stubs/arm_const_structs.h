@@ -0,0 +1,13 @@
+/*
+ * arm_const_structs.h
+ *
+ *  Host stand-in, see arm_common_tables.h.
+ */
+
+#ifndef ARM_CONST_STRUCTS_H
+#define ARM_CONST_STRUCTS_H
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+#endif /* ARM_CONST_STRUCTS_H */
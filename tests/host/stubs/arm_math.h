@@ -0,0 +1,112 @@
+/*
+ * arm_math.h
+ *
+ *  Host stand-in for the CMSIS-DSP and CMSIS-Core declarations the
+ *  firmware uses. The functions are implemented in cmsis_host.c.
+ */
+
+#ifndef ARM_MATH_H
+#define ARM_MATH_H
+
+#include <stdint.h>
+#include <math.h>
+
+typedef float float32_t;
+typedef double float64_t;
+typedef int32_t q31_t;
+typedef int16_t q15_t;
+
+typedef enum
+{
+	ARM_MATH_SUCCESS = 0,
+	ARM_MATH_ARGUMENT_ERROR = -1,
+	ARM_MATH_LENGTH_ERROR = -2
+} arm_status;
+
+#define PI 3.14159265358979f
+
+typedef struct
+{
+	uint16_t fftLen;
+	const float32_t *pTwiddle;
+	const uint16_t *pBitRevTable;
+	uint16_t bitRevLength;
+} arm_cfft_instance_f32;
+
+typedef struct
+{
+	arm_cfft_instance_f32 Sint;
+	uint16_t fftLenRFFT;
+	float32_t *pTwiddleRFFT;
+} arm_rfft_fast_instance_f32;
+
+typedef struct
+{
+	uint8_t M;
+	uint16_t numTaps;
+	float32_t *pCoeffs;
+	float32_t *pState;
+} arm_fir_decimate_instance_f32;
+
+typedef struct
+{
+	uint16_t numTaps;
+	float32_t *pState;
+	float32_t *pCoeffs;
+} arm_fir_instance_f32;
+
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 *S, uint16_t fftLen);
+void arm_rfft_fast_f32(arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut,
+		uint8_t ifftFlag);
+void arm_cfft_f32(const arm_cfft_instance_f32 *S, float32_t *p1, uint8_t ifftFlag,
+		uint8_t bitReverseFlag);
+void arm_cmplx_mag_f32(float32_t *pSrc, float32_t *pDst, uint32_t numSamples);
+void arm_cmplx_mag_squared_f32(float32_t *pSrc, float32_t *pDst, uint32_t numSamples);
+void arm_cmplx_mult_cmplx_f32(float32_t *pSrcA, float32_t *pSrcB, float32_t *pDst,
+		uint32_t numSamples);
+void arm_max_f32(float32_t *pSrc, uint32_t blockSize, float32_t *pResult,
+		uint32_t *pIndex);
+void arm_mult_f32(float32_t *pSrcA, float32_t *pSrcB, float32_t *pDst,
+		uint32_t blockSize);
+void arm_scale_f32(float32_t *pSrc, float32_t scale, float32_t *pDst,
+		uint32_t blockSize);
+void arm_copy_f32(float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+void arm_fill_f32(float32_t value, float32_t *pDst, uint32_t blockSize);
+void arm_power_f32(float32_t *pSrc, uint32_t blockSize, float32_t *pResult);
+void arm_dot_prod_f32(float32_t *pSrcA, float32_t *pSrcB, uint32_t blockSize,
+		float32_t *result);
+arm_status arm_fir_decimate_init_f32(arm_fir_decimate_instance_f32 *S,
+		uint16_t numTaps, uint8_t M, float32_t *pCoeffs, float32_t *pState,
+		uint32_t blockSize);
+void arm_fir_decimate_f32(const arm_fir_decimate_instance_f32 *S, float32_t *pSrc,
+		float32_t *pDst, uint32_t blockSize);
+void arm_fir_init_f32(arm_fir_instance_f32 *S, uint16_t numTaps, float32_t *pCoeffs,
+		float32_t *pState, uint32_t blockSize);
+void arm_fir_f32(const arm_fir_instance_f32 *S, float32_t *pSrc, float32_t *pDst,
+		uint32_t blockSize);
+
+static inline arm_status arm_sqrt_f32(float32_t in, float32_t *pOut)
+{
+	*pOut = sqrtf(in);
+	return ARM_MATH_SUCCESS;
+}
+
+// Cycle counter: a plain variable the tests advance to simulate time
+typedef struct
+{
+	volatile uint32_t CTRL;
+	volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+	volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern DWT_Type *DWT;
+extern CoreDebug_Type *CoreDebug;
+
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk 1UL
+
+#endif /* ARM_MATH_H */
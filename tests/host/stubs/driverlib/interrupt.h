@@ -0,0 +1 @@
+#include "../tivaware_host.h"
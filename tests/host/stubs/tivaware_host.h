@@ -0,0 +1,100 @@
+/*
+ * tivaware_host.h
+ *
+ *  Host stand-in for the TivaWare driverlib and register headers the
+ *  firmware includes. Peripheral calls that matter to the tests go to
+ *  hw_host.c, the rest compile to nothing.
+ */
+
+#ifndef TIVAWARE_HOST_H
+#define TIVAWARE_HOST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ADC0_BASE 0x40038000
+#define TIMER1_BASE 0x40031000
+#define UART0_BASE 0x4000C000
+#define GPIO_PORTA_BASE 0x40058000
+#define GPIO_PORTD_BASE 0x4005B000
+
+#define GPIO_PIN_0 0x01
+#define GPIO_PIN_1 0x02
+#define GPIO_PIN_7 0x80
+#define GPIO_PA0_U0RX 0x00000001
+#define GPIO_PA1_U0TX 0x00000401
+
+#define SYSCTL_PERIPH_ADC0 1
+#define SYSCTL_PERIPH_GPIOD 2
+#define SYSCTL_PERIPH_GPIOA 3
+#define SYSCTL_PERIPH_TIMER1 4
+#define SYSCTL_PERIPH_UART0 5
+#define SYSCTL_USE_PLL 0
+#define SYSCTL_XTAL_25MHZ 0
+#define SYSCTL_OSC_MAIN 0
+#define SYSCTL_CFG_VCO_480 0
+
+#define TIMER_CFG_PERIODIC 0
+#define TIMER_A 0xff
+#define TIMER_ADC_TIMEOUT_A 1
+
+#define ADC_TRIGGER_TIMER 5
+#define ADC_CTL_CH4 4
+#define ADC_CTL_IE 0x40
+#define ADC_CTL_END 0x20
+#define INT_ADC0SS3 33
+
+#define UART_CONFIG_WLEN_8 0x60
+#define UART_CONFIG_STOP_ONE 0
+#define UART_CONFIG_PAR_NONE 0
+
+// hw_host.c
+uint32_t hostSysCtlClockFreqSet(uint32_t config, uint32_t frequency);
+void hostTimerLoadSet(uint32_t load);
+uint32_t hostTimerLoadGet(void);
+uint32_t hostTimerValueGet(void);
+int32_t hostAdcSequenceDataGet(uint32_t *buffer);
+bool hostAdcSequenceOverflow(void);
+bool hostAdcSequenceUnderflow(void);
+void hostUartCharPut(char c);
+
+#define ROM_SysCtlClockFreqSet(a, b) hostSysCtlClockFreqSet(a, b)
+#define MAP_SysCtlPeripheralEnable(a) ((void)(a))
+#define MAP_SysCtlDelay(a) ((void)(a))
+#define MAP_FPULazyStackingEnable() ((void)0)
+#define MAP_FPUEnable() ((void)0)
+
+#define MAP_GPIOPinTypeADC(a, b) ((void)0)
+#define MAP_GPIOPinTypeUART(a, b) ((void)0)
+#define MAP_GPIOPinConfigure(a) ((void)0)
+
+#define MAP_TimerConfigure(a, b) ((void)0)
+#define MAP_TimerLoadSet(a, b, c) hostTimerLoadSet(c)
+#define MAP_TimerLoadGet(a, b) hostTimerLoadGet()
+#define MAP_TimerValueGet(a, b) hostTimerValueGet()
+#define MAP_TimerControlTrigger(a, b, c) ((void)0)
+#define MAP_TimerADCEventSet(a, b) ((void)0)
+#define MAP_TimerEnable(a, b) ((void)0)
+#define MAP_TimerDisable(a, b) ((void)0)
+
+#define MAP_ADCSequenceDisable(a, b) ((void)0)
+#define MAP_ADCSequenceEnable(a, b) ((void)0)
+#define MAP_ADCSequenceConfigure(a, b, c, d) ((void)0)
+#define MAP_ADCSequenceStepConfigure(a, b, c, d) ((void)0)
+#define MAP_ADCIntClear(a, b) ((void)0)
+#define MAP_ADCIntEnable(a, b) ((void)0)
+#define MAP_ADCIntDisable(a, b) ((void)0)
+#define MAP_ADCSequenceDataGet(a, b, c) hostAdcSequenceDataGet(c)
+#define MAP_ADCSequenceOverflow(a, b) hostAdcSequenceOverflow()
+#define MAP_ADCSequenceUnderflow(a, b) hostAdcSequenceUnderflow()
+#define MAP_ADCSequenceOverflowClear(a, b) ((void)0)
+#define MAP_ADCSequenceUnderflowClear(a, b) ((void)0)
+
+#define MAP_IntEnable(a) ((void)0)
+#define MAP_IntMasterEnable() ((void)0)
+#define MAP_IntMasterDisable() false
+
+#define MAP_UARTConfigSetExpClk(a, b, c, d) ((void)0)
+#define MAP_UARTCharPut(a, b) hostUartCharPut(b)
+
+#endif /* TIVAWARE_HOST_H */
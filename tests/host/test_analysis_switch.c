@@ -0,0 +1,169 @@
+/*
+ * test_analysis_switch.c
+ *
+ *  Host simulation of run-time analysis switches: the main loop requests
+ *  random frame sizes, sample rates and windows (some unsupported) while
+ *  the ADC ISR samples and the main loop processes with random delays,
+ *  so requests land at every point of the frame hand-over.
+ *
+ *  The whole firmware is compiled in, with its main() renamed, on the
+ *  simulated time of hw_host.h. Each ADC sample is the TIMER1 load it
+ *  was taken at, so a frame captured partly at another rate shows up.
+ *  Every frame must
+ *
+ *  - hold only samples at the rate of the settings it carries, and
+ *  - be processed with those settings throughout: plans, band weights,
+ *    filter spectrum, distortion measurement, and a constant-Q spectrum
+ *    that is restarted when the rate changes.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define main firmwareMain
+#include "arm_fft_bin_example_f32.c"
+#undef main
+
+#include "hw_host.h"
+#include "host_test.h"
+
+#define SYSCLOCK 120000000
+#define STACK_WORDS 256
+#define FRAMES 600
+
+// Marks constant-Q bins from before a rate change; powers are never
+// negative
+#define STALE -1.0f
+
+// Linker symbols of the firmware, unused here
+uint32_t __stack;
+uint32_t __STACK_TOP;
+
+static uint32_t stack[STACK_WORDS];
+
+void ramfuncInit(void)
+{
+}
+
+void ramfuncReport(void)
+{
+}
+
+// Each sample is the TIMER1 load it was taken at
+static void sampleAtRate(void)
+{
+	hostAdcValue = hostTimerLoad;
+	ADC0_SampleHandler();
+}
+
+// Samples of the frame about to be processed, against its settings
+static bool frameIntact(const float32_t *frame, const analysisConfig *config)
+{
+	uint32_t n;
+
+	for (n = 0; n < config->fftSize; n++)
+	{
+		if (frame[n] != (float32_t)config->timerLoad)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Stage state after processing a frame captured with config
+static bool stagesCurrent(const analysisConfig *config)
+{
+	uint32_t bin;
+
+	for (bin = 0; bin < DSP_CQT_OCTAVES * DSP_CQT_BINS_PER_OCTAVE; bin++)
+	{
+		if (cqt.spectrum[bin] == STALE)
+		{
+			return false;
+		}
+	}
+
+	return current.id == config->id &&
+			fft->fftLenRFFT == config->fftSize &&
+			current.acfPlan->fftLenRFFT == 2 * config->fftSize &&
+			current.bands == fftBands(config->fftSize, config->sampleRate) &&
+			fir.filterSpectrum == firSpectra[config->rateIndex] &&
+			distortion.fftSize == config->fftSize &&
+			distortion.sampleRate == config->sampleRate;
+}
+
+int main(void)
+{
+	static const uint32_t sizes[] = { 128, 256, 512, 1024, 2048 };
+	static const uint32_t rates[] = { 44100, 16000, 8000 };
+	const analysisConfig *config;
+	uint32_t frames = 0, switches = 0, requests = 0, accepted = 0;
+	uint32_t lastId = 0, bin;
+	telemetryCounters counters;
+
+	g_ui32SysClock = SYSCLOCK;
+	stackMonitorInit(stack, stack + STACK_WORDS);
+	reportInit(g_ui32SysClock);
+	allocateDSPMemory();
+	configureFilter();
+	configureAnalysis();
+	configureADC();
+	hostSampleInterrupt = sampleAtRate;
+
+	srand(1);
+	while (frames < FRAMES)
+	{
+		hostAdvance(1 + rand() % 4000);
+
+		if (rand() % 2000 == 0)
+		{
+			requests++;
+			if (analysisRequest(sizes[rand() % 5], rates[rand() % 3],
+					rand() % 2 ? ANALYSIS_WINDOW_HANN : ANALYSIS_WINDOW_RECTANGULAR,
+					g_ui32SysClock))
+			{
+				accepted++;
+			}
+		}
+
+		if (!frameReady)
+		{
+			continue;
+		}
+
+		config = readyConfig;
+		CHECK(frameIntact(readyFrame, config));
+		if (config->id != lastId)
+		{
+			switches++;
+			lastId = config->id;
+		}
+		if (config->rateIndex != current.rateIndex)
+		{
+			for (bin = 0; bin < DSP_CQT_OCTAVES * DSP_CQT_BINS_PER_OCTAVE; bin++)
+			{
+				cqt.spectrum[bin] = STALE;
+			}
+		}
+
+		// Processing takes anywhere up to two frame periods
+		hostRfftCycles = rand() % (2 * config->fftSize * config->timerLoad / 4);
+		serviceFrame();
+		hostRfftCycles = 0;
+		frames++;
+
+		CHECK(stagesCurrent(config));
+	}
+
+	telemetrySnapshot(&counters);
+	printf("%u frames, %u dropped, %u of %u requests accepted, %u switches\n",
+			frames, counters.framesDropped, accepted, requests, switches);
+	CHECK(accepted > 0 && accepted < requests);
+	CHECK(switches > 1);
+	CHECK(counters.framesDropped > 0);
+
+	printf("test_analysis_switch: %s\n", testFailures ? "FAILED" : "ok");
+	return testFailures != 0;
+}
@@ -0,0 +1,227 @@
+/*
+ * test_arbfft.c
+ *
+ *  Host test and benchmark of the arbitrary-length FFT against a direct
+ *  DFT: the generated DSP_ARBFFT_LENGTH plan, and plans built here the
+ *  way tools/gen_fft_tables.py builds them for other mixed-radix and
+ *  Bluestein lengths.
+ *
+ *  The timings are host nanoseconds per frame of arbfftRun() against
+ *  the generated 256-point RFFT plan, the power of two the default 245
+ *  sits below. As with test_fastconv, only the ratio carries over, and
+ *  only with SANITIZE=.
+ */
+
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+
+#include "arm_math.h"
+#include "arbfft.h"
+#include "fft_tables.h"
+#include "dsp_config.h"
+#include "host_test.h"
+
+#define MAX_LENGTH 1024
+#define MAX_CFFT 2048
+#define BENCH_POINTS 4000000
+
+static float32_t input[MAX_LENGTH];
+static float32_t output[2 * MAX_LENGTH];
+static float32_t work[2 * MAX_CFFT];
+static float32_t rfftInput[256];
+static float32_t rfftOutput[256];
+
+// Tables of a plan built at run time
+static float32_t twiddle[2 * MAX_LENGTH];
+static float32_t chirp[2 * MAX_LENGTH];
+static float32_t chirpSpectrum[2 * MAX_CFFT];
+static arm_cfft_instance_f32 cfft;
+
+static double now(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+// Plan for length as gen_fft_tables.py arb_plan() emits it: radices 4,
+// then 2, then odd, or Bluestein if a factor is too large
+static void buildPlan(arbfftPlan *plan, uint32_t length)
+{
+	uint32_t rest = length, p = 4, k, m;
+	double angle;
+
+	plan->length = length;
+	plan->numFactors = 0;
+	while (rest > 1)
+	{
+		while (rest % p)
+		{
+			p = (p == 4) ? 2 : (p == 2) ? 3 : p + 2;
+		}
+		if (plan->numFactors < ARBFFT_MAX_FACTORS)
+		{
+			plan->factors[plan->numFactors] = p;
+		}
+		plan->numFactors++;
+		rest /= p;
+	}
+
+	if (p <= ARBFFT_MAX_RADIX && plan->numFactors <= ARBFFT_MAX_FACTORS)
+	{
+		for (k = 0; k < length; k++)
+		{
+			twiddle[2 * k] = cos(2.0 * M_PI * k / length);
+			twiddle[2 * k + 1] = -sin(2.0 * M_PI * k / length);
+		}
+		plan->method = ARBFFT_MIXED_RADIX;
+		plan->twiddle = twiddle;
+		return;
+	}
+
+	m = 1;
+	while (m < 2 * length - 1)
+	{
+		m *= 2;
+	}
+
+	// Chirp, and the CFFT of its conjugate wrapped around M
+	for (k = 0; k < 2 * m; k++)
+	{
+		chirpSpectrum[k] = 0.0f;
+	}
+	for (k = 0; k < length; k++)
+	{
+		angle = M_PI * (double)((uint64_t)k * k % (2 * length)) / length;
+		chirp[2 * k] = cos(angle);
+		chirp[2 * k + 1] = -sin(angle);
+		chirpSpectrum[2 * k] = chirpSpectrum[2 * ((m - k) % m)] = cos(angle);
+		chirpSpectrum[2 * k + 1] = chirpSpectrum[2 * ((m - k) % m) + 1] = sin(angle);
+	}
+	cfft.fftLen = m;
+	arm_cfft_f32(&cfft, chirpSpectrum, 0, 1);
+
+	plan->method = ARBFFT_BLUESTEIN;
+	plan->numFactors = 0;
+	plan->twiddle = 0;
+	plan->chirp = chirp;
+	plan->chirpSpectrum = chirpSpectrum;
+	plan->cfft = &cfft;
+}
+
+// Largest error of the N bins against a direct DFT, relative to the
+// largest bin
+static double checkPlan(const arbfftPlan *plan)
+{
+	uint32_t length = plan->length;
+	uint32_t n, k;
+	double re, im, err = 0.0, peak = 0.0;
+
+	for (n = 0; n < length; n++)
+	{
+		input[n] = sinf(0.37f * n) + 0.25f * cosf(1.9f * n) +
+				0.1f * (float32_t)(n % 7);
+	}
+	arbfftRun(plan, input, output, work);
+
+	for (k = 0; k < length; k++)
+	{
+		re = 0.0;
+		im = 0.0;
+		for (n = 0; n < length; n++)
+		{
+			re += input[n] * cos(2.0 * M_PI * ((uint64_t)k * n % length) / length);
+			im -= input[n] * sin(2.0 * M_PI * ((uint64_t)k * n % length) / length);
+		}
+		err = fmax(err, hypot(output[2 * k] - re, output[2 * k + 1] - im));
+		peak = fmax(peak, hypot(re, im));
+	}
+	return err / peak;
+}
+
+// Host seconds per frame of plan
+static double timePlan(const arbfftPlan *plan)
+{
+	uint32_t rep, reps = BENCH_POINTS / plan->length + 1;
+	double start = now();
+
+	for (rep = 0; rep < reps; rep++)
+	{
+		arbfftRun(plan, input, output, work);
+	}
+	return (now() - start) / reps;
+}
+
+// Host seconds per frame of the generated 256-point RFFT plan
+static double timeRfft256(void)
+{
+	arm_rfft_fast_instance_f32 *plan = (arm_rfft_fast_instance_f32 *)fftPlanRfft(256);
+	uint32_t rep, reps = BENCH_POINTS / 256 + 1;
+	double start = now();
+
+	for (rep = 0; rep < reps; rep++)
+	{
+		arm_rfft_fast_f32(plan, rfftInput, rfftOutput, 0);
+	}
+	return (now() - start) / reps;
+}
+
+int main(void)
+{
+	// Mixed radix up to radix 13 and with radix 4 and 2 together, then
+	// Bluestein for a prime and for a factor of 17
+	static const struct
+	{
+		uint32_t length;
+		arbfftMethod method;
+	} cases[] =
+	{
+		{ 245, ARBFFT_MIXED_RADIX },
+		{ 441, ARBFFT_MIXED_RADIX },
+		{ 1000, ARBFFT_MIXED_RADIX },
+		{ 156, ARBFFT_MIXED_RADIX },
+		{ 1009, ARBFFT_BLUESTEIN },
+		{ 204, ARBFFT_BLUESTEIN }
+	};
+	const arbfftPlan *generated = fftPlanArb(DSP_ARBFFT_LENGTH);
+	arbfftPlan plan;
+	uint32_t i, k;
+	double err, arbTime, rfftTime;
+
+	// The generated plan, with the radices buildPlan() picks
+	CHECK(generated != 0);
+	if (generated)
+	{
+		buildPlan(&plan, DSP_ARBFFT_LENGTH);
+		CHECK(generated->method == plan.method);
+		CHECK(generated->numFactors == plan.numFactors);
+		for (k = 0; k < generated->numFactors && k < plan.numFactors; k++)
+		{
+			CHECK(generated->factors[k] == plan.factors[k]);
+		}
+		err = checkPlan(generated);
+		CHECK(err < 1e-5);
+		printf("generated %u: relative error %.1e\n", DSP_ARBFFT_LENGTH, err);
+	}
+
+	rfftTime = timeRfft256();
+	printf("   N  method       error  ns/frame  vs 256-point rfft\n");
+	for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+	{
+		buildPlan(&plan, cases[i].length);
+		CHECK(plan.method == cases[i].method);
+		err = checkPlan(&plan);
+		CHECK(err < 1e-5);
+
+		arbTime = timePlan(&plan);
+		printf("%4u  %-11s  %.1e  %8.0f  %16.1fx\n", cases[i].length,
+				plan.method == ARBFFT_BLUESTEIN ? "bluestein" : "mixed radix",
+				err, 1e9 * arbTime, arbTime / rfftTime);
+	}
+	printf("256-point rfft: %.0f ns/frame\n", 1e9 * rfftTime);
+
+	printf("test_arbfft: %s\n", testFailures ? "FAILED" : "ok");
+	return testFailures != 0;
+}
@@ -0,0 +1,219 @@
+/*
+ * test_autocorr.c
+ *
+ *  Host test of the FFT autocorrelation against a direct time-domain
+ *  one, and of the period search on tones with harmonics across the
+ *  DSP_PITCH_MIN_HZ .. DSP_PITCH_MAX_HZ range, at every frame size.
+ *
+ *  The timings are host nanoseconds per frame of autocorrCompute()
+ *  against a direct float autocorrelation over the lags runFFT()
+ *  searches, and over all N / 2 that autocorrCompute() returns. As with
+ *  test_fastconv, only the ratios carry over, and only with SANITIZE=.
+ */
+
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+
+#include "arm_math.h"
+#include "autocorr.h"
+#include "dsp_config.h"
+#include "host_test.h"
+
+#define RATE 44100
+#define MAX_FRAME 1024
+#define BENCH_MACS 20000000
+
+static float32_t frame[MAX_FRAME];
+static float32_t acf[2 * MAX_FRAME];
+static float32_t work[2 * MAX_FRAME];
+static double direct[MAX_FRAME];
+static float32_t directFloat[MAX_FRAME];
+
+static double now(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+// Linear autocorrelation of the frame minus its mean, scaled by
+// N / (N - t) like autocorrCompute()
+static void directAcf(uint32_t frameSize)
+{
+	uint32_t lag, n;
+	double mean = 0.0;
+
+	for (n = 0; n < frameSize; n++)
+	{
+		mean += frame[n];
+	}
+	mean /= frameSize;
+
+	for (lag = 0; lag <= frameSize / 2; lag++)
+	{
+		direct[lag] = 0.0;
+		for (n = lag; n < frameSize; n++)
+		{
+			direct[lag] += (frame[n] - mean) * (frame[n - lag] - mean);
+		}
+		direct[lag] *= (double)frameSize / (frameSize - lag);
+	}
+}
+
+// What a direct implementation would run per frame: lags 0 .. lags - 1
+// of the frame minus its mean, in float
+static void directLags(uint32_t frameSize, uint32_t lags)
+{
+	uint32_t lag, n;
+	float32_t mean = 0.0f, sum;
+
+	for (n = 0; n < frameSize; n++)
+	{
+		mean += frame[n];
+	}
+	mean /= frameSize;
+
+	for (lag = 0; lag < lags; lag++)
+	{
+		sum = 0.0f;
+		for (n = lag; n < frameSize; n++)
+		{
+			sum += (frame[n] - mean) * (frame[n - lag] - mean);
+		}
+		directFloat[lag] = sum * frameSize / (frameSize - lag);
+	}
+}
+
+// Host seconds per frame of the direct autocorrelation over lags
+static double timeDirect(uint32_t frameSize, uint32_t lags)
+{
+	uint32_t rep, reps = BENCH_MACS / (frameSize * lags) + 1;
+	double start = now();
+
+	for (rep = 0; rep < reps; rep++)
+	{
+		directLags(frameSize, lags);
+	}
+	return (now() - start) / reps;
+}
+
+// Host seconds per frame of autocorrCompute()
+static double timeFft(arm_rfft_fast_instance_f32 *plan, uint32_t frameSize)
+{
+	uint32_t rep, reps = BENCH_MACS / (frameSize * 64) + 1;
+	double start = now();
+
+	for (rep = 0; rep < reps; rep++)
+	{
+		autocorrCompute(plan, frame, work, acf);
+	}
+	return (now() - start) / reps;
+}
+
+static void tone(uint32_t frameSize, float32_t hz)
+{
+	uint32_t n;
+	float32_t phase;
+
+	for (n = 0; n < frameSize; n++)
+	{
+		phase = 2.0f * PI * hz * n / RATE;
+		frame[n] = 0.3f + sinf(phase) + 0.6f * sinf(2.0f * phase) +
+				0.5f * sinf(3.0f * phase);
+	}
+}
+
+int main(void)
+{
+	static const uint32_t sizes[] = { 256, 512, 1024 };
+	arm_rfft_fast_instance_f32 plan = { { 0 } };
+	autocorrPeriod period;
+	uint32_t i, lag, frameSize, searched;
+	float32_t hz, err;
+	double worst, searchedTime, halfTime, fftTime;
+	bool found;
+
+	// A peak at maxLag itself is in range
+	for (lag = 0; lag < 64; lag++)
+	{
+		acf[lag] = cosf(2.0f * PI * lag / 40.0f);
+	}
+	CHECK(autocorrFindPeriod(acf, 10, 40, 0.5f, &period));
+	CHECK(fabsf(period.lag - 40.0f) < 0.1f);
+	CHECK(!autocorrFindPeriod(acf, 10, 39, 0.5f, &period));
+
+	for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+	{
+		frameSize = sizes[i];
+		plan.Sint.fftLen = frameSize;
+		plan.fftLenRFFT = 2 * frameSize;
+
+		// Lags past the first period, where the circular
+		// autocorrelation picks up N - t
+		tone(frameSize, 523.0f);
+		directAcf(frameSize);
+		autocorrCompute(&plan, frame, work, acf);
+		worst = 0.0;
+		for (lag = 0; lag <= frameSize / 2; lag++)
+		{
+			worst = fmax(worst, fabs(acf[lag] - direct[lag]));
+		}
+		CHECK(worst < 1e-4 * direct[0]);
+
+		// With the search range of runFFT(), DSP_PITCH_MIN_HZ puts the
+		// peak right at maxLag
+		for (hz = DSP_PITCH_MIN_HZ; hz <= 1600.0f; hz *= 1.07f)
+		{
+			tone(frameSize, hz);
+			autocorrCompute(&plan, frame, work, acf);
+			found = autocorrFindPeriod(acf, RATE / DSP_PITCH_MAX_HZ,
+					RATE / DSP_PITCH_MIN_HZ + 1, DSP_PITCH_MIN_CLARITY, &period);
+			CHECK(found);
+			if (!found)
+			{
+				printf("N %u, %.1f Hz: not found\n", frameSize, hz);
+				continue;
+			}
+
+			err = fabsf(RATE / period.lag - hz) / hz;
+			CHECK(err < 0.01f);
+			CHECK(period.clarity > 0.9f);
+			if (err >= 0.01f || period.clarity <= 0.9f)
+			{
+				printf("N %u, %.1f Hz: %.1f Hz, clarity %.2f\n", frameSize, hz,
+						RATE / period.lag, period.clarity);
+			}
+		}
+	}
+
+	// Lags 0 .. maxLag + 1, for the parabolic fit at maxLag
+	searched = RATE / DSP_PITCH_MIN_HZ + 3;
+	printf("   N  direct ns/frame (%u lags)  direct ns/frame (N/2 lags)"
+			"  fft ns/frame  speed-up\n", searched);
+	for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+	{
+		frameSize = sizes[i];
+		plan.Sint.fftLen = frameSize;
+		plan.fftLenRFFT = 2 * frameSize;
+
+		tone(frameSize, 523.0f);
+		autocorrCompute(&plan, frame, work, acf);
+		directLags(frameSize, frameSize / 2 + 1);
+		for (lag = 0; lag <= frameSize / 2; lag++)
+		{
+			CHECK(fabsf(acf[lag] - directFloat[lag]) < 1e-4f * directFloat[0]);
+		}
+
+		searchedTime = timeDirect(frameSize, searched);
+		halfTime = timeDirect(frameSize, frameSize / 2 + 1);
+		fftTime = timeFft(&plan, frameSize);
+		printf("%4u  %24.0f  %26.0f  %12.0f  %7.1fx\n", frameSize,
+				1e9 * searchedTime, 1e9 * halfTime, 1e9 * fftTime,
+				searchedTime / fftTime);
+	}
+
+	printf("test_autocorr: %s\n", testFailures ? "FAILED" : "ok");
+	return testFailures != 0;
+}
@@ -0,0 +1,233 @@
+/*
+ * test_bands.c
+ *
+ *  Host test and benchmark of the CSR band weights against a dense
+ *  evaluation of the band definitions, for every generated FFT size and
+ *  sample rate at the configured DSP_BANDS_SCALE.
+ *
+ *  The dense weights are rebuilt here from the definitions in
+ *  tools/gen_fft_tables.py rather than read back from the tables, so a
+ *  band the generator dropped or mis-binned shows up as an error. The
+ *  timings are host nanoseconds per frame of a dense float
+ *  matrix-vector product against bandsApply(); as with test_fastconv,
+ *  only the ratio carries over, and only with SANITIZE=.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#include "arm_math.h"
+#include "bands.h"
+#include "fft_tables.h"
+#include "dsp_config.h"
+#include "host_test.h"
+
+#define MAX_FFT 1024
+#define MAX_BANDS 64
+#define BENCH_MACS 20000000
+
+static float32_t spectrum[MAX_FFT];
+static float32_t energy[MAX_BANDS];
+static float32_t denseEnergy[MAX_BANDS];
+static double reference[MAX_BANDS];
+static double weights[MAX_BANDS][MAX_FFT / 2];
+static float32_t denseWeights[MAX_BANDS][MAX_FFT / 2];
+
+static double now(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+static double mel(double hz)
+{
+	return 2595.0 * log10(1.0 + hz / 700.0);
+}
+
+static double melToHz(double m)
+{
+	return 700.0 * (pow(10.0, m / 2595.0) - 1.0);
+}
+
+// Keeps the row if it caught a bin, as the generator does; returns the
+// new band count
+static uint32_t keepBand(uint32_t band, uint32_t half)
+{
+	uint32_t k;
+
+	for (k = 1; k < half; k++)
+	{
+		if (weights[band][k] != 0.0)
+		{
+			return band + 1;
+		}
+	}
+	return band;
+}
+
+// Dense weights over bins 0 .. N/2 - 1; returns the number of bands
+static uint32_t denseBands(uint32_t n, uint32_t rate)
+{
+	uint32_t half = n / 2;
+	double nyquist = rate / 2.0;
+	double lo, centre, hi, f, edges[DSP_BANDS_MEL_COUNT + 2];
+	uint32_t band = 0, b, k, perOctave;
+	int32_t i;
+
+	if (DSP_BANDS_SCALE == DSP_BANDS_MEL)
+	{
+		for (b = 0; b < DSP_BANDS_MEL_COUNT + 2; b++)
+		{
+			edges[b] = melToHz(mel(nyquist) * b / (DSP_BANDS_MEL_COUNT + 1));
+		}
+		for (b = 0; b < DSP_BANDS_MEL_COUNT; b++)
+		{
+			lo = edges[b];
+			centre = edges[b + 1];
+			hi = edges[b + 2];
+			for (k = 0; k < half; k++)
+			{
+				f = k * (double)rate / n;
+				weights[band][k] = (k == 0 || f <= lo || f >= hi) ? 0.0 :
+						(f <= centre) ? (f - lo) / (centre - lo) :
+						(hi - f) / (hi - centre);
+			}
+			band = keepBand(band, half);
+		}
+		return band;
+	}
+
+	perOctave = (DSP_BANDS_SCALE == DSP_BANDS_THIRD_OCTAVE) ? 3 : 1;
+	for (i = -10 * (int32_t)perOctave; ; i++)
+	{
+		centre = 1000.0 * pow(2.0, (double)i / perOctave);
+		lo = centre / pow(2.0, 0.5 / perOctave);
+		hi = centre * pow(2.0, 0.5 / perOctave);
+		if (lo >= nyquist)
+		{
+			break;
+		}
+		for (k = 0; k < half; k++)
+		{
+			f = k * (double)rate / n;
+			weights[band][k] = (k != 0 && lo <= f && f < hi) ? 1.0 : 0.0;
+		}
+		band = keepBand(band, half);
+	}
+	return band;
+}
+
+// Every bin-by-band product, zero weights included
+static void denseApply(uint32_t numBands, uint32_t half)
+{
+	uint32_t band, k;
+	float32_t sum;
+
+	for (band = 0; band < numBands; band++)
+	{
+		sum = 0.0f;
+		for (k = 0; k < half; k++)
+		{
+			sum += denseWeights[band][k] * (spectrum[2 * k] * spectrum[2 * k] +
+					spectrum[2 * k + 1] * spectrum[2 * k + 1]);
+		}
+		denseEnergy[band] = sum;
+	}
+}
+
+int main(void)
+{
+	static const uint32_t sizes[] = { DSP_FFT_SIZES };
+	static const uint32_t rates[] = { DSP_SAMPLE_RATES };
+	const bandsWeights *bands;
+	uint32_t s, r, n, half, numBands, band, k, reps, rep;
+	double err, worst = 0.0, denseTime, sparseTime, power;
+
+	srand(1);
+	printf("   N   rate  bands  weights  dense ns/frame  csr ns/frame  speed-up\n");
+	for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+	{
+		for (r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+		{
+			n = sizes[s];
+			half = n / 2;
+			bands = fftBands(n, rates[r]);
+			CHECK(bands != 0);
+			if (!bands)
+			{
+				continue;
+			}
+
+			numBands = denseBands(n, rates[r]);
+			CHECK(bands->numBands == numBands);
+			CHECK(numBands <= FFT_BANDS_MAX);
+
+			// DC and Nyquist share slot 0; the CSR rows must not touch it
+			for (k = 0; k < bands->rowStart[bands->numBands]; k++)
+			{
+				CHECK(bands->column[k] >= 1 && bands->column[k] < half);
+			}
+
+			for (k = 0; k < n; k++)
+			{
+				spectrum[k] = 2.0f * rand() / RAND_MAX - 1.0f;
+			}
+			bandsApply(bands, spectrum, energy);
+
+			for (band = 0; band < numBands && band < bands->numBands; band++)
+			{
+				reference[band] = 0.0;
+				for (k = 1; k < half; k++)
+				{
+					power = (double)spectrum[2 * k] * spectrum[2 * k] +
+							(double)spectrum[2 * k + 1] * spectrum[2 * k + 1];
+					reference[band] += weights[band][k] * power;
+				}
+				err = fabs(energy[band] - reference[band]) / reference[band];
+				worst = fmax(worst, err);
+				CHECK(err < 1e-5);
+			}
+
+			// Slot 0 holds DC and Nyquist, which the dense weights zero
+			for (band = 0; band < numBands; band++)
+			{
+				for (k = 0; k < half; k++)
+				{
+					denseWeights[band][k] = (float32_t)weights[band][k];
+				}
+			}
+
+			reps = BENCH_MACS / (numBands * half) + 1;
+			denseTime = now();
+			for (rep = 0; rep < reps; rep++)
+			{
+				denseApply(numBands, half);
+			}
+			denseTime = (now() - denseTime) / reps;
+
+			sparseTime = now();
+			for (rep = 0; rep < reps; rep++)
+			{
+				bandsApply(bands, spectrum, energy);
+			}
+			sparseTime = (now() - sparseTime) / reps;
+
+			for (band = 0; band < numBands; band++)
+			{
+				CHECK(fabs(denseEnergy[band] - energy[band]) <= 1e-5 * reference[band]);
+			}
+
+			printf("%4u  %5u  %5u  %7u  %14.0f  %12.0f  %7.1fx\n", n, rates[r],
+					numBands, bands->rowStart[bands->numBands], 1e9 * denseTime,
+					1e9 * sparseTime, denseTime / sparseTime);
+		}
+	}
+	printf("largest relative error against the dense definition: %.1e\n", worst);
+
+	printf("test_bands: %s\n", testFailures ? "FAILED" : "ok");
+	return testFailures != 0;
+}
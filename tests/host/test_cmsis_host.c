@@ -0,0 +1,139 @@
+/*
+ * test_cmsis_host.c
+ *
+ *  Checks the host CMSIS stand-ins the other tests rely on against a
+ *  direct DFT, and the generated RFFT plans, whose split twiddles the
+ *  host RFFT reads, against the twiddleCoef_rfft layout of CMSIS.
+ */
+
+#include <stdint.h>
+#include <math.h>
+
+#include "arm_math.h"
+#include "fft_tables.h"
+#include "dsp_config.h"
+#include "host_test.h"
+
+#define MAX_N 2048
+
+static float32_t input[MAX_N], scratch[MAX_N], packed[MAX_N], restored[MAX_N];
+static float32_t complexData[2 * MAX_N];
+
+static void checkRfft(arm_rfft_fast_instance_f32 *plan)
+{
+	uint32_t n = plan->fftLenRFFT;
+	uint32_t i, k;
+	double re, im, err = 0.0, peak = 0.0;
+
+	for (i = 0; i < n; i++)
+	{
+		input[i] = sinf(0.37f * i) + 0.25f * cosf(1.9f * i) + 0.1f * (float32_t)(i % 7);
+		scratch[i] = input[i];
+	}
+
+	arm_rfft_fast_f32(plan, scratch, packed, 0);
+
+	for (k = 0; k <= n / 2; k++)
+	{
+		re = 0.0;
+		im = 0.0;
+		for (i = 0; i < n; i++)
+		{
+			re += input[i] * cos(2.0 * M_PI * k * i / n);
+			im -= input[i] * sin(2.0 * M_PI * k * i / n);
+		}
+		if (k == 0)
+		{
+			err = fmax(err, fabs(packed[0] - re));
+		}
+		else if (k == n / 2)
+		{
+			err = fmax(err, fabs(packed[1] - re));
+		}
+		else
+		{
+			err = fmax(err, fabs(packed[2 * k] - re));
+			err = fmax(err, fabs(packed[2 * k + 1] - im));
+		}
+		peak = fmax(peak, hypot(re, im));
+	}
+	CHECK(err < 1e-5 * peak * log2(n));
+
+	arm_rfft_fast_f32(plan, packed, restored, 1);
+	err = 0.0;
+	for (i = 0; i < n; i++)
+	{
+		err = fmax(err, fabs(restored[i] - input[i]));
+	}
+	CHECK(err < 1e-5 * log2(n));
+}
+
+// sin, cos pairs like twiddleCoef_rfft_<N>, which starts 0, 1
+static void checkRfftTwiddles(const arm_rfft_fast_instance_f32 *plan)
+{
+	uint32_t n = plan->fftLenRFFT;
+	uint32_t k;
+	double err = 0.0;
+
+	for (k = 0; k < n / 2; k++)
+	{
+		err = fmax(err, fabs(plan->pTwiddleRFFT[2 * k] - sin(2.0 * M_PI * k / n)));
+		err = fmax(err, fabs(plan->pTwiddleRFFT[2 * k + 1] - cos(2.0 * M_PI * k / n)));
+	}
+	CHECK(err < 1e-6);
+}
+
+static void checkCfft(uint32_t n)
+{
+	arm_cfft_instance_f32 plan = { 0 };
+	uint32_t i;
+	double err = 0.0;
+
+	plan.fftLen = n;
+	for (i = 0; i < 2 * n; i++)
+	{
+		complexData[i] = sinf(0.11f * i * i);
+	}
+
+	arm_cfft_f32(&plan, complexData, 0, 1);
+	arm_cfft_f32(&plan, complexData, 1, 1);
+	for (i = 0; i < 2 * n; i++)
+	{
+		err = fmax(err, fabs(complexData[i] - sinf(0.11f * i * i)));
+	}
+	CHECK(err < 1e-5 * log2(n));
+}
+
+int main(void)
+{
+	static const uint32_t sizes[] = { DSP_FFT_SIZES };
+	arm_rfft_fast_instance_f32 plan = { { 0 } };
+	const arm_rfft_fast_instance_f32 *generated;
+	uint32_t n, i;
+
+	for (n = 16; n <= MAX_N; n *= 2)
+	{
+		plan.fftLenRFFT = n;
+		checkRfft(&plan);
+		checkCfft(n / 2);
+	}
+
+	// Every generated plan, with its own split twiddles
+	for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+	{
+		CHECK(fftPlanRfft(sizes[i]) != 0);
+	}
+	for (n = 16; n <= MAX_N; n *= 2)
+	{
+		generated = fftPlanRfft(n);
+		if (generated)
+		{
+			CHECK(generated->fftLenRFFT == n && generated->Sint.fftLen == n / 2);
+			checkRfftTwiddles(generated);
+			checkRfft((arm_rfft_fast_instance_f32 *)generated);
+		}
+	}
+
+	printf("test_cmsis_host: %s\n", testFailures ? "FAILED" : "ok");
+	return testFailures != 0;
+}
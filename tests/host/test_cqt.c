@@ -0,0 +1,131 @@
+/*
+ * test_cqt.c
+ *
+ *  Host test of the constant-Q cascade at the configured size and
+ *  SAMPLING_RATE, with the generated plan and window: a tone at the
+ *  geometric centre of each bin, the lowest octave included, must peak
+ *  in that bin, and at the analytic level wherever the decimators pass
+ *  it. Tones below the lowest bin must not show up in any bin.
+ *
+ *  The top bins of each octave below the first lie in the transition
+ *  band of the decimators (see CQT_DECIMATOR_CUTOFF), so only their
+ *  placement is checked.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+#include "arm_math.h"
+#include "cqt.h"
+#include "fft_tables.h"
+#include "dsp_config.h"
+#include "host_test.h"
+
+#define RATE ((float32_t)SAMPLING_RATE)
+#define NUM_BINS (DSP_CQT_OCTAVES * DSP_CQT_BINS_PER_OCTAVE)
+#define AMPLITUDE 1.0f
+
+// Enough for the lowest octave to fill with the settled output of every
+// decimator, a multiple of CQT_BLOCK
+#define TONE_SAMPLES 16384
+
+// Highest tone, as a fraction of an octave's own rate, its decimator
+// passes within the level tolerance
+#define PASSBAND 0.41f
+#define LEVEL_DB 0.5f
+
+// A tone out of range stays this far below one in range
+#define REJECTION_DB 50.0f
+
+static float32_t workspace[CQT_WORK_FLOATS(DSP_CQT_OCTAVES, DSP_CQT_FFT_SIZE,
+		DSP_CQT_DECIMATOR_TAPS, DSP_CQT_BINS_PER_OCTAVE)];
+static float32_t tone[TONE_SAMPLES];
+static cqtInstance cqt;
+
+// Runs a tone at hz through a restarted cascade; returns the bin with
+// the most power
+static uint32_t analyseTone(float32_t hz)
+{
+	uint32_t n, bin, peak = 0;
+
+	for (n = 0; n < TONE_SAMPLES; n++)
+	{
+		tone[n] = AMPLITUDE * sinf(2.0f * PI * hz * n / RATE);
+	}
+
+	cqtReset(&cqt);
+	cqtProcess(&cqt, tone, TONE_SAMPLES);
+
+	for (bin = 1; bin < NUM_BINS; bin++)
+	{
+		if (cqt.spectrum[bin] > cqt.spectrum[peak])
+		{
+			peak = bin;
+		}
+	}
+	return peak;
+}
+
+int main(void)
+{
+	static const float32_t belowHz[] = { 100.0f, 350.0f, 600.0f };
+	uint32_t bin, peak, octaveIndex, i;
+	float32_t lo, hi, hz, octaveRate, level, total, expected;
+	bool passed;
+
+	cqtInit(&cqt, (arm_rfft_fast_instance_f32 *)fftPlanRfft(DSP_CQT_FFT_SIZE),
+			fftWindowHann(DSP_CQT_FFT_SIZE), DSP_CQT_OCTAVES,
+			DSP_CQT_BINS_PER_OCTAVE, DSP_CQT_DECIMATOR_TAPS, workspace);
+
+	// A Hann windowed tone puts (A / 2)^2 N sum(w^2) = 3 A^2 N^2 / 32 into
+	// its half of the spectrum
+	expected = 10.0f * log10f(3.0f * AMPLITUDE * AMPLITUDE *
+			DSP_CQT_FFT_SIZE * DSP_CQT_FFT_SIZE / 32.0f);
+
+	for (bin = 0; bin < NUM_BINS; bin++)
+	{
+		lo = cqtBinHz(&cqt, RATE, bin);
+		hi = (bin + 1 < NUM_BINS) ? cqtBinHz(&cqt, RATE, bin + 1) : RATE / 2.0f;
+		hz = sqrtf(lo * hi);
+
+		peak = analyseTone(hz);
+		CHECK(peak == bin);
+
+		total = 0.0f;
+		for (i = 0; i < NUM_BINS; i++)
+		{
+			total += cqt.spectrum[i];
+		}
+		level = 10.0f * log10f(cqt.spectrum[bin]);
+
+		// Octave 0, the input rate, is the top one and never decimated
+		octaveIndex = DSP_CQT_OCTAVES - 1 - bin / DSP_CQT_BINS_PER_OCTAVE;
+		octaveRate = RATE / (float32_t)(1u << octaveIndex);
+		passed = octaveIndex == 0 || hz < PASSBAND * octaveRate;
+		if (passed)
+		{
+			CHECK(fabsf(level - expected) < LEVEL_DB);
+			CHECK(cqt.spectrum[bin] > 0.99f * total);
+		}
+		if (peak != bin || (passed && fabsf(level - expected) >= LEVEL_DB))
+		{
+			printf("bin %u, %.1f Hz: peak in bin %u, %.2f dB\n", bin, hz, peak,
+					level);
+		}
+	}
+
+	// Below the lowest octave nothing is analysed
+	for (i = 0; i < sizeof(belowHz) / sizeof(belowHz[0]); i++)
+	{
+		CHECK(belowHz[i] < cqtBinHz(&cqt, RATE, 0));
+		peak = analyseTone(belowHz[i]);
+		level = 10.0f * log10f(cqt.spectrum[peak]);
+		CHECK(level < expected - REJECTION_DB);
+		printf("%.0f Hz: highest bin %.1f dB below a tone in range\n",
+				belowHz[i], expected - level);
+	}
+
+	printf("test_cqt: %s\n", testFailures ? "FAILED" : "ok");
+	return testFailures != 0;
+}
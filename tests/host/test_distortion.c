@@ -0,0 +1,212 @@
+/*
+ * test_distortion.c
+ *
+ *  Host test of the tone quality measurement: a frame of constant ADC
+ *  input, which has no tone, must neither be measured nor poison the
+ *  average of the tone frames that follow it. Levels that still come
+ *  out infinite, from a zero energy, must report as a clamped integer.
+ *
+ *  THD, SNR and SINAD are then checked against their analytic values
+ *  for a 9 kHz tone whose harmonics from the third on lie above Nyquist
+ *  and fold back into the band, in white Gaussian noise of known power,
+ *  averaged over AVERAGE_FRAMES frames. The timing is host nanoseconds
+ *  per distortionMeasure() at 1024 points and 44.1 kHz; as with
+ *  test_fastconv, only the ratio to the frame period carries over, and
+ *  only with SANITIZE=.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#include "arm_math.h"
+#include "distortion.h"
+#include "report.h"
+#include "hw_host.h"
+#include "host_test.h"
+
+#define N 1024
+#define RATE 44100.0f
+#define TONE_HZ 1000.0f
+#define HARMONIC_DB -40.0f
+
+// Analytic case: amplitude, harmonics 2 .. 6 in dB relative to the
+// fundamental, and the noise power relative to the fundamental's
+#define FOLDED_HZ 9000.0f
+#define FOLDED_AMPLITUDE 1000.0
+#define FOLDED_HARMONICS 5
+#define NOISE_DB -60.0
+#define AVERAGE_FRAMES 32
+#define BENCH_FRAMES 2000
+
+static const double harmonicDb[FOLDED_HARMONICS] = { -50.0, -55.0, -60.0, -65.0, -70.0 };
+
+static float32_t frame[N];
+static float32_t spectrum[N];
+static float32_t power[N / 2 + 1];
+
+static double now(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+// Zero mean, unit variance
+static double gaussian(void)
+{
+	double u1 = (rand() + 1.0) / (RAND_MAX + 2.0);
+	double u2 = (rand() + 1.0) / (RAND_MAX + 2.0);
+
+	return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+// Characters reportLevel() prints for value
+static uint32_t levelChars(float value)
+{
+	uint32_t chars = hostUartChars;
+
+	reportLevel(value);
+	return hostUartChars - chars;
+}
+
+// Packed RFFT of an offset, and of a tone with its second harmonic and
+// a little noise on top if tone is set
+static void capture(bool tone)
+{
+	arm_rfft_fast_instance_f32 plan = { { 0 } };
+	float32_t phase;
+	uint32_t n;
+
+	for (n = 0; n < N; n++)
+	{
+		frame[n] = 2048.0f;
+		if (tone)
+		{
+			phase = 2.0f * PI * TONE_HZ * n / RATE;
+			frame[n] += 1000.0f * sinf(phase) +
+					1000.0f * powf(10.0f, HARMONIC_DB / 20.0f) * sinf(2.0f * phase) +
+					0.01f * (float32_t)((int32_t)((n * 7919u) % 101) - 50);
+		}
+	}
+
+	plan.Sint.fftLen = N / 2;
+	plan.fftLenRFFT = N;
+	arm_rfft_fast_f32(&plan, frame, spectrum, 0);
+}
+
+// Packed RFFT of the analytic case, with a random phase. Harmonics
+// above Nyquist are sampled as they are, so they alias.
+static void captureFolded(void)
+{
+	arm_rfft_fast_instance_f32 plan = { { 0 } };
+	double phase = 2.0 * M_PI * rand() / RAND_MAX, value;
+	double sigma = FOLDED_AMPLITUDE * sqrt(0.5 * pow(10.0, NOISE_DB / 10.0));
+	uint32_t n, h;
+
+	for (n = 0; n < N; n++)
+	{
+		value = FOLDED_AMPLITUDE * sin(2.0 * M_PI * FOLDED_HZ * n / RATE + phase);
+		for (h = 0; h < FOLDED_HARMONICS; h++)
+		{
+			value += FOLDED_AMPLITUDE * pow(10.0, harmonicDb[h] / 20.0) *
+					sin((h + 2) * (2.0 * M_PI * FOLDED_HZ * n / RATE + phase));
+		}
+		frame[n] = (float32_t)(2048.0 + value + sigma * gaussian());
+	}
+
+	plan.Sint.fftLen = N / 2;
+	plan.fftLenRFFT = N;
+	arm_rfft_fast_f32(&plan, frame, spectrum, 0);
+}
+
+int main(void)
+{
+	distortionInstance S;
+	distortionResult result;
+	double harmonics = 0.0, noise, thd, snr, sinad, elapsed;
+	uint32_t h, i;
+
+	distortionInit(&S, N, RATE, &distortionWindowBlackmanHarris, 5, power);
+
+	// Constant input: nothing to measure and nothing accumulated
+	capture(false);
+	distortionMeasure(&S, spectrum);
+	CHECK(S.frames == 0);
+	CHECK(S.fundamentalBin == 0.0f);
+	CHECK(!distortionResults(&S, &result));
+
+	// A silent frame in the middle of an average is skipped
+	capture(true);
+	distortionMeasure(&S, spectrum);
+	capture(false);
+	distortionMeasure(&S, spectrum);
+	capture(true);
+	distortionMeasure(&S, spectrum);
+	CHECK(S.frames == 2);
+	CHECK(distortionResults(&S, &result));
+	CHECK(fabsf(result.fundamentalHz - TONE_HZ) < 0.01f * TONE_HZ);
+	CHECK(fabsf(result.thd - HARMONIC_DB) < 1.0f);
+	CHECK(isfinite(result.snr) && result.snr > 40.0f);
+	CHECK(isfinite(result.enob));
+
+	// Nothing carries over once results are taken, valid or not
+	CHECK(S.frames == 0 && S.fundamentalPower == 0.0f);
+	CHECK(!distortionResults(&S, &result));
+	capture(true);
+	distortionMeasure(&S, spectrum);
+	CHECK(distortionResults(&S, &result));
+	CHECK(fabsf(result.fundamentalHz - TONE_HZ) < 0.01f * TONE_HZ);
+
+	// Powers relative to the fundamental: harmonics 2 .. 6 at 18, 17.1,
+	// 8.1, 0.9 and 9.9 kHz after folding, all clear of its lobe
+	for (h = 0; h < FOLDED_HARMONICS; h++)
+	{
+		harmonics += pow(10.0, harmonicDb[h] / 10.0);
+	}
+	noise = pow(10.0, NOISE_DB / 10.0);
+	thd = 10.0 * log10(harmonics);
+	snr = -NOISE_DB;
+	sinad = -10.0 * log10(harmonics + noise);
+
+	srand(1);
+	distortionInit(&S, N, RATE, &distortionWindowBlackmanHarris,
+			FOLDED_HARMONICS, power);
+	for (i = 0; i < AVERAGE_FRAMES; i++)
+	{
+		captureFolded();
+		distortionMeasure(&S, spectrum);
+	}
+	CHECK(distortionResults(&S, &result));
+	printf("THD %.2f dB (%.2f), SNR %.2f dB (%.2f), SINAD %.2f dB (%.2f), "
+			"ENOB %.2f\n", result.thd, thd, result.snr, snr, result.sinad,
+			sinad, result.enob);
+	CHECK(fabs(result.fundamentalHz - FOLDED_HZ) < 0.5 * RATE / N);
+	CHECK(fabs(result.thd - thd) < 0.2);
+	CHECK(fabs(result.snr - snr) < 0.2);
+	CHECK(fabs(result.sinad - sinad) < 0.2);
+	CHECK(fabs(result.enob - (sinad - 1.76) / 6.02) < 0.05);
+
+	// One measurement per frame, as runFFT() does
+	elapsed = now();
+	for (i = 0; i < BENCH_FRAMES; i++)
+	{
+		distortionMeasure(&S, spectrum);
+	}
+	elapsed = (now() - elapsed) / BENCH_FRAMES;
+	distortionResults(&S, &result);
+	printf("%u points at %.0f Hz: %.0f ns/frame, %.2f%% of the frame period\n",
+			N, RATE, 1e9 * elapsed, 100.0 * elapsed * RATE / N);
+
+	// "9999", "-9999", "0" and "-40"
+	CHECK(levelChars(INFINITY) == 4);
+	CHECK(levelChars(-INFINITY) == 5);
+	CHECK(levelChars(NAN) == 1);
+	CHECK(levelChars(-40.7f) == 3);
+
+	printf("test_distortion: %s\n", testFailures ? "FAILED" : "ok");
+	return testFailures != 0;
+}
@@ -0,0 +1,164 @@
+/*
+ * test_fastconv.c
+ *
+ *  Host test and benchmark of the overlap-save FIR against a
+ *  direct-form FIR, for 32 to 1024 taps.
+ *
+ *  Each tap count is checked at FFT sizes from the smallest that fits to
+ *  8x the taps, on a stream fed in frame-sized pieces. The timings are
+ *  host nanoseconds per sample, so only the ratio between the two
+ *  methods carries over to the target; build with SANITIZE= for them to
+ *  mean anything.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "arm_math.h"
+#include "fastconv.h"
+#include "fir_design.h"
+#include "dsp_config.h"
+#include "host_test.h"
+
+#define STREAM_LENGTH 32768
+#define MAX_TAPS 1024
+#define MAX_FFT 8192
+
+static float32_t input[STREAM_LENGTH];
+static float32_t direct[STREAM_LENGTH];
+static float32_t fast[STREAM_LENGTH];
+static uint32_t fastCount;
+
+static float32_t taps[MAX_TAPS];
+static float32_t spectrum[MAX_FFT];
+static float32_t history[MAX_FFT];
+static float32_t work[2 * MAX_FFT];
+
+static void collect(const float32_t *samples, uint32_t count, void *context)
+{
+	if (fastCount + count > STREAM_LENGTH)
+	{
+		count = STREAM_LENGTH - fastCount;
+	}
+	memcpy(&fast[fastCount], samples, count * sizeof(float32_t));
+	fastCount += count;
+}
+
+static double now(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+// y[n] = sum of taps[k] x[n - k], with silence before the stream
+static void directForm(uint32_t numTaps)
+{
+	uint32_t n, k, first;
+	float32_t sum;
+
+	for (n = 0; n < STREAM_LENGTH; n++)
+	{
+		sum = 0.0f;
+		first = (n + 1 < numTaps) ? n + 1 : numTaps;
+		for (k = 0; k < first; k++)
+		{
+			sum += taps[k] * input[n - k];
+		}
+		direct[n] = sum;
+	}
+}
+
+// Filters the stream in pieces of 1 to 1024 samples, as frames of
+// every configured size would arrive; returns the seconds taken
+static double overlapSave(uint32_t numTaps, uint32_t fftSize)
+{
+	arm_rfft_fast_instance_f32 plan = { { 0 } };
+	fastconvInstance S;
+	uint32_t offset, piece;
+	double start;
+
+	plan.Sint.fftLen = fftSize / 2;
+	plan.fftLenRFFT = fftSize;
+
+	fastconvFilterSpectrum(&plan, taps, numTaps, spectrum, work);
+	fastconvInit(&S, &plan, spectrum, numTaps, history, work, collect, 0);
+	fastCount = 0;
+
+	start = now();
+	for (offset = 0, piece = 1; offset < STREAM_LENGTH; offset += piece)
+	{
+		piece = (piece * 5 + 3) % 1024 + 1;
+		if (piece > STREAM_LENGTH - offset)
+		{
+			piece = STREAM_LENGTH - offset;
+		}
+		fastconvProcess(&S, &input[offset], piece);
+	}
+	return now() - start;
+}
+
+int main(void)
+{
+	uint32_t numTaps, fftSize, bestFft, n;
+	double directTime, fastTime, bestTime, err, peak;
+
+	for (n = 0; n < STREAM_LENGTH; n++)
+	{
+		input[n] = sinf(0.4f * n) + 0.5f * sinf(1.43f * n) +
+				0.25f * (float32_t)((n * 7919u) % 101) / 101.0f;
+	}
+
+	printf("taps  direct ns/sample  overlap-save ns/sample (best N)  speed-up\n");
+	for (numTaps = 32; numTaps <= MAX_TAPS; numTaps *= 2)
+	{
+		firDesignBandPass(taps, numTaps, DSP_FIR_LOW_HZ, DSP_FIR_HIGH_HZ,
+				SAMPLING_RATE);
+
+		directTime = now();
+		directForm(numTaps);
+		directTime = now() - directTime;
+
+		peak = 0.0;
+		for (n = 0; n < STREAM_LENGTH; n++)
+		{
+			peak = fmax(peak, fabs(direct[n]));
+		}
+
+		bestTime = 0.0;
+		bestFft = 0;
+		for (fftSize = 64; fftSize <= MAX_FFT && fftSize <= 8 * numTaps; fftSize *= 2)
+		{
+			if (fftSize <= numTaps)
+			{
+				continue;
+			}
+
+			fastTime = overlapSave(numTaps, fftSize);
+
+			// Outputs come a whole hop at a time; compare what was produced
+			CHECK(fastCount > STREAM_LENGTH - fftSize);
+			err = 0.0;
+			for (n = 0; n < fastCount; n++)
+			{
+				err = fmax(err, fabs(fast[n] - direct[n]));
+			}
+			CHECK(err < 1e-4 * peak);
+
+			if (!bestFft || fastTime < bestTime)
+			{
+				bestTime = fastTime;
+				bestFft = fftSize;
+			}
+		}
+
+		printf("%4u  %17.1f  %22.1f (%4u)  %7.1fx\n", numTaps,
+				1e9 * directTime / STREAM_LENGTH, 1e9 * bestTime / STREAM_LENGTH,
+				bestFft, directTime / bestTime);
+	}
+
+	printf("test_fastconv: %s\n", testFailures ? "FAILED" : "ok");
+	return testFailures != 0;
+}
@@ -0,0 +1,79 @@
+/*
+ * test_ramfunc.c
+ *
+ *  Host test of the flash to SRAM relocation on simulated regions.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "ramfunc.h"
+#include "host_test.h"
+
+// The linker symbols ramfuncInit() reads; only ramfuncRelocate() runs
+uint32_t ramfuncLoadStart, ramfuncRunStart, ramfuncSize;
+uint32_t ramconstLoadStart, ramconstRunStart, ramconstSize;
+
+static uint32_t flash[64];
+static uint32_t sram[64];
+
+static ramfuncRegion region(const uint32_t *load, uint32_t *run, uint32_t size)
+{
+	ramfuncRegion r;
+
+	r.name = "test";
+	r.load = load;
+	r.run = run;
+	r.size = size;
+
+	return r;
+}
+
+int main(void)
+{
+	ramfuncRegion regions[2];
+	uint32_t i;
+
+	for (i = 0; i < 64; i++)
+	{
+		flash[i] = 0x1000 + i;
+	}
+
+	// Both regions copied word for word, nothing else touched
+	memset(sram, 0, sizeof(sram));
+	regions[0] = region(flash, sram, 16 * sizeof(uint32_t));
+	regions[1] = region(&flash[16], &sram[32], 8 * sizeof(uint32_t));
+	CHECK(ramfuncRelocate(regions, 2) == RAMFUNC_OK);
+	CHECK(memcmp(sram, flash, 16 * sizeof(uint32_t)) == 0);
+	CHECK(memcmp(&sram[32], &flash[16], 8 * sizeof(uint32_t)) == 0);
+	CHECK(sram[16] == 0 && sram[40] == 0);
+
+	// Linked to run in place (DSP_NO_RAMFUNC): nothing to copy
+	regions[0] = region(flash, flash, 16 * sizeof(uint32_t));
+	CHECK(ramfuncRelocate(regions, 1) == RAMFUNC_OK);
+
+	// Empty sections are fine
+	regions[0] = region(flash, sram, 0);
+	regions[1] = region(flash, sram, 0);
+	CHECK(ramfuncRelocate(regions, 2) == RAMFUNC_OK);
+
+	// Bad links are refused before anything is copied
+	memset(sram, 0, sizeof(sram));
+	regions[0] = region(flash, sram, 16 * sizeof(uint32_t));
+	regions[1] = region(flash, &sram[1], 6);
+	CHECK(ramfuncRelocate(regions, 2) == RAMFUNC_MISALIGNED);
+	CHECK(sram[0] == 0);
+
+	regions[1] = region(flash, (uint32_t *)((uint8_t *)sram + 2), 8);
+	CHECK(ramfuncRelocate(regions, 2) == RAMFUNC_MISALIGNED);
+
+	regions[1] = region(flash, &sram[8], 16 * sizeof(uint32_t));
+	CHECK(ramfuncRelocate(regions, 2) == RAMFUNC_OVERLAP);
+	CHECK(sram[0] == 0);
+
+	regions[0] = region(flash, &flash[8], 16 * sizeof(uint32_t));
+	CHECK(ramfuncRelocate(regions, 1) == RAMFUNC_OVERLAP);
+
+	printf("test_ramfunc: %s\n", testFailures ? "FAILED" : "ok");
+	return testFailures != 0;
+}
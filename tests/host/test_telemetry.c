@@ -0,0 +1,158 @@
+/*
+ * test_telemetry.c
+ *
+ *  Host simulation of the firmware main loop and ADC ISR, injecting
+ *  overload to check the telemetry counters.
+ *
+ *  The whole firmware is compiled in, with its main() renamed. Time is
+ *  simulated (see hw_host.h): the main loop polls every LOOP_CYCLES, the
+ *  UART blocks for a character time at REPORT_BAUD_RATE, and the ADC ISR
+ *  runs whenever a sample period passes, including in the middle of a
+ *  report or an RFFT. The phases are
+ *
+ *  - real time: processing is free, so only the reports hold up the
+ *    main loop. They must cost dropped frames but no deadline misses.
+ *  - overload: every RFFT takes a whole frame period, so every frame
+ *    misses its deadline and frames are dropped.
+ *  - ADC FIFO overflow and underflow flagged for a known number of
+ *    samples.
+ *  - recovery: back to real time, no further deadline misses.
+ *
+ *  Throughout, every captured frame must be either processed, dropped
+ *  or still waiting to be.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+#define main firmwareMain
+#include "arm_fft_bin_example_f32.c"
+#undef main
+
+#include "hw_host.h"
+#include "host_test.h"
+
+#define SYSCLOCK 120000000
+#define LOOP_CYCLES 1000
+#define STACK_WORDS 256
+
+// Linker symbols of the firmware, unused here
+uint32_t __stack;
+uint32_t __STACK_TOP;
+
+static uint32_t stack[STACK_WORDS];
+static uint32_t sampleCount;
+static telemetryCounters counters;
+
+void ramfuncInit(void)
+{
+}
+
+void ramfuncReport(void)
+{
+}
+
+// A 1 kHz tone for the ADC, then the firmware ISR
+static void sampleTone(void)
+{
+	hostAdcValue = 2048 + (uint32_t)(1000.0f *
+			sinf(2.0f * PI * 1000.0f * sampleCount++ / SAMPLING_RATE));
+	ADC0_SampleHandler();
+}
+
+// Runs the main loop until count more frames have been processed
+static void runFrames(uint32_t count)
+{
+	uint32_t target;
+
+	telemetrySnapshot(&counters);
+	target = counters.framesCompleted + count;
+	while (counters.framesCompleted < target)
+	{
+		hostAdvance(LOOP_CYCLES);
+		serviceFrame();
+		stackCheckGuard();
+		telemetrySnapshot(&counters);
+	}
+}
+
+// Whole frames captured, less those processed or dropped, leaves at most
+// the one handed over and not yet taken
+static void checkAccounting(void)
+{
+	uint32_t captured = counters.samplesCaptured / current.fftSize;
+	uint32_t accounted = counters.framesCompleted + counters.framesDropped;
+
+	CHECK(captured >= accounted && captured <= accounted + 1);
+}
+
+int main(void)
+{
+	telemetryCounters before;
+	uint32_t budget, chars, reportCycles;
+
+	g_ui32SysClock = SYSCLOCK;
+	stackMonitorInit(stack, stack + STACK_WORDS);
+	reportInit(g_ui32SysClock);
+	allocateDSPMemory();
+	configureFilter();
+	configureAnalysis();
+	configureADC();
+
+	hostSampleInterrupt = sampleTone;
+	hostUartCharCycles = SYSCLOCK / (REPORT_BAUD_RATE / 10);
+	budget = current.fftSize * current.timerLoad;
+
+	// Real time: the reports block the main loop for several frames
+	telemetrySnapshot(&before);
+	chars = hostUartChars;
+	runFrames(3 * current.reportFrames);
+	chars = (hostUartChars - chars) / 3;
+	reportCycles = chars * hostUartCharCycles;
+	printf("report: %u chars, %.1f frame periods\n", chars,
+			(float)reportCycles / budget);
+	CHECK(chars > 0);
+	CHECK(counters.deadlineMisses == before.deadlineMisses);
+	CHECK(counters.framesDropped > before.framesDropped);
+	CHECK(counters.framesDropped - before.framesDropped <=
+			3 * (reportCycles / budget + 1));
+	checkAccounting();
+
+	// Overload: each frame takes several frame periods
+	hostRfftCycles = budget;
+	telemetrySnapshot(&before);
+	runFrames(100);
+	printf("overload: %u frames, %u deadline misses, %u dropped\n",
+			counters.framesCompleted - before.framesCompleted,
+			counters.deadlineMisses - before.deadlineMisses,
+			counters.framesDropped - before.framesDropped);
+	CHECK(counters.deadlineMisses - before.deadlineMisses ==
+			counters.framesCompleted - before.framesCompleted);
+	CHECK(counters.framesDropped - before.framesDropped >=
+			counters.framesCompleted - before.framesCompleted);
+	checkAccounting();
+	hostRfftCycles = 0;
+
+	// Sequencer FIFO errors on exactly ten samples each
+	telemetrySnapshot(&before);
+	hostAdcOverflow = true;
+	hostAdvance(10 * hostTimerLoad);
+	hostAdcOverflow = false;
+	hostAdcUnderflow = true;
+	hostAdvance(10 * hostTimerLoad);
+	hostAdcUnderflow = false;
+	telemetrySnapshot(&counters);
+	CHECK(counters.adcOverflows - before.adcOverflows == 10);
+	CHECK(counters.adcUnderflows - before.adcUnderflows == 10);
+
+	// Recovery
+	runFrames(1);
+	telemetrySnapshot(&before);
+	runFrames(2 * current.reportFrames);
+	CHECK(counters.deadlineMisses == before.deadlineMisses);
+	checkAccounting();
+
+	printf("test_telemetry: %s\n", testFailures ? "FAILED" : "ok");
+	return testFailures != 0;
+}
@@ -24,6 +24,17 @@ MEMORY
 /* --stack_size=256                                                          */
 /* --library=rtsv7M4_T_le_eabi.lib                                           */
 
+/* Hot DSP code and tables listed under .ramfunc and .ramconst below are    */
+/* loaded into flash and copied into SRAM by ramfuncInit(), so they run      */
+/* without flash wait states. Link with --define=DSP_NO_RAMFUNC to leave     */
+/* them in flash, e.g. to compare the per-stage cycle counts.                */
+
+#ifdef DSP_NO_RAMFUNC
+#define RAMFUNC_PLACEMENT > FLASH
+#else
+#define RAMFUNC_PLACEMENT LOAD = FLASH, RUN = SRAM
+#endif
+
 /* Section allocation in memory */
 
 SECTIONS
@@ -40,6 +51,75 @@ SECTIONS
     .bss    :   > SRAM
     .sysmem :   > SRAM
     .stack  :   > SRAM
+
+    /* One line per function subsection to run from SRAM                    */
+    .ramfunc :  {
+        *(.text:ADC0_SampleHandler)
+        *(.text:telemetrySample)
+        *(.text:telemetryFrameDropped)
+        *(.text:analysisTakeRequest)
+        *(.text:stackIsrEnter)
+        *(.text:stackIsrEnterAt)
+        *(.text:stackIsrExit)
+        *(.text:profileRecord)
+        *(.text:processFrame)
+        *(.text:runFFT)
+        *(.text:fastconvProcess)
+        *(.text:filterBlock)
+        *(.text:multiplyPacked)
+        *(.text:autocorrCompute)
+        *(.text:autocorrFindPeriod)
+        *(.text:arbfftRun)
+        *(.text:mixedRadix)
+        *(.text:butterfly2)
+        *(.text:butterfly4)
+        *(.text:butterflyGeneric)
+        *(.text:bandsApply)
+        *(.text:distortionMeasure)
+        *(.text:windowedPower)
+        *(.text:binAt)
+        *(.text:claimBins)
+        *(.text:cqtProcess)
+        *(.text:pushOctave)
+        *(.text:analyseOctave)
+        *(.text:arm_rfft_fast_f32)
+        *(.text:stage_rfft_f32)
+        *(.text:merge_rfft_f32)
+        *(.text:arm_cfft_f32)
+        *(.text:arm_cfft_radix8by2_f32)
+        *(.text:arm_cfft_radix8by4_f32)
+        *(.text:arm_radix8_butterfly_f32)
+        *(.text:arm_bitreversal_32)
+        *(.text:arm_cmplx_mult_cmplx_f32)
+        *(.text:arm_cmplx_mag_f32)
+        *(.text:arm_copy_f32)
+        *(.text:arm_max_f32)
+        *(.text:arm_mult_f32)
+        *(.text:arm_fir_decimate_f32)
+    } RAMFUNC_PLACEMENT, palign(4),
+      LOAD_START(ramfuncLoadStart), RUN_START(ramfuncRunStart),
+      SIZE(ramfuncSize)
+
+    /* Tables read by the functions above, for the start-up settings        */
+    /* TEST_LENGTH_SAMPLES = 256 at 44.1 kHz and DSP_FIR_FFT_SIZE = 512.     */
+    /* Tables for the other run-time sizes and rates are read from flash.    */
+    .ramconst : {
+        *(.const:fftTwiddle128)
+        *(.const:fftTwiddleRfft256)
+        *(.const:armBitRevIndexTable128)
+        *(.const:fftTwiddle256)
+        *(.const:fftTwiddleRfft512)
+        *(.const:armBitRevIndexTable256)
+        *(.const:fftArbTwiddle245)
+        *(.const:fftWindowHann256)
+        *(.const:fftBandRows256_44100)
+        *(.const:fftBandColumns256_44100)
+        *(.const:fftBandWeights256_44100)
+    } RAMFUNC_PLACEMENT, palign(4),
+      LOAD_START(ramconstLoadStart), RUN_START(ramconstRunStart),
+      SIZE(ramconstSize)
 }
 
-__STACK_TOP = __stack + 512;
+/* Use the full .stack section; ResetISR paints it and the stack monitor   */
+/* keeps a guard word at __stack.                                            */
+__STACK_TOP = __STACK_END;
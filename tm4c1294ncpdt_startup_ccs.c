@@ -24,6 +24,8 @@
 
 #include <stdint.h>
 
+#include "stack_monitor.h"
+
 //*****
 //
 // Interrupt handlers for program
@@ -50,13 +52,21 @@ static void IntDefaultHandler(void);
 //*****************************************************************************
 extern void _c_int00(void);
 
+//*****************************************************************************
+//
+// Starts the cycle counter, so that boot time can be measured.
+//
+//*****************************************************************************
+extern void profileInit(void);
+
 extern void ADC0_SampleHandler(void);
 
 //*****************************************************************************
 //
-// Linker variable that marks the top of the stack.
+// Linker variables that mark the bottom and the top of the stack.
 //
 //*****************************************************************************
+extern uint32_t __stack;
 extern uint32_t __STACK_TOP;
 
 //*****************************************************************************
@@ -222,6 +232,23 @@ void (* const g_pfnVectors[])(void) =
 void
 ResetISR(void)
 {
+    uint32_t *pui32Stack;
+
+    //
+    // Start counting cycles from reset.
+    //
+    profileInit();
+
+    //
+    // Paint the unused part of the stack so that the stack monitor can find
+    // the high-water mark.  Stop a few words short of this frame.
+    //
+    for(pui32Stack = &__stack; pui32Stack < (uint32_t *)&pui32Stack - 4;
+        pui32Stack++)
+    {
+        *pui32Stack = STACK_PAINT_WORD;
+    }
+
     //
     // Jump to the CCS C initialization routine.  This will enable the
     // floating-point unit as well, so that does not need to be done here.
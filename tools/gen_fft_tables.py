@@ -0,0 +1,471 @@
+#!/usr/bin/env python3
+"""Generate fft_tables.c / fft_tables.h for the configured FFT sizes.
+
+Only the sizes listed on the command line (default: the sizes in
+CONFIG_SIZES from dsp_config.h) get tables, so nothing else is linked and there is no
+runtime arm_rfft_fast_init_f32() call. For each RFFT length N this emits
+
+  fftTwiddle<N/2>       CFFT twiddles, same values as CMSIS twiddleCoef_<N/2>
+  fftTwiddleRfft<N>     RFFT split twiddles, as CMSIS twiddleCoef_rfft_<N>
+  fftWindowHann<N>      periodic Hann window, for the sizes in WINDOW_SIZES
+  fftPlan<N>            ready-made arm_rfft_fast_instance_f32
+
+When DSP_ARBFFT_LENGTH in dsp_config.h is non-zero, a plan for that
+length is added (see arbfft.h):
+
+  fftArbTwiddle<N>         exp(-2 pi i k / N), for a mixed-radix plan
+  fftArbChirp<N>           Bluestein chirp exp(-i pi n^2 / N)
+  fftArbChirpSpectrum<N>   CFFT of the conjugate chirp, wrapped to M
+  fftArbPlan<N>            ready-made arbfftPlan
+
+The sizes in BAND_SIZES also get the band weights selected by
+DSP_BANDS_SCALE, once for each of the DSP_SAMPLE_RATES (see bands.h):
+
+  fftBandRows<N>_<R>, fftBandColumns<N>_<R>, fftBandWeights<N>_<R>
+                           CSR weights
+  fftBandCenters<N>_<R>    band centre frequencies in Hz
+  fftBands<N>_<R>          ready-made bandsWeights
+
+The bit-reversal order depends on the internals of the CMSIS radix-8
+kernels, so plans point at the library's armBitRevIndexTable<N/2>; only
+the tables a plan references are linked.
+
+The generated header records the flash taken by the tables, next to
+what arm_rfft_fast_init_f32() links: its switch over RFFT sizes 32 to
+4096 references the twiddle, split twiddle and bit-reversal tables of
+every size. Code and the plan structs themselves are not counted.
+
+Run from the project root after changing the configured sizes:
+
+  python3 tools/gen_fft_tables.py [N ...]
+"""
+
+import math
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+
+# CFFT lengths CMSIS has bit-reversal tables for
+BITREV_LENGTH = {
+    16: 'ARMBITREVINDEXTABLE__16_TABLE_LENGTH',
+    32: 'ARMBITREVINDEXTABLE__32_TABLE_LENGTH',
+    64: 'ARMBITREVINDEXTABLE__64_TABLE_LENGTH',
+    128: 'ARMBITREVINDEXTABLE_128_TABLE_LENGTH',
+    256: 'ARMBITREVINDEXTABLE_256_TABLE_LENGTH',
+    512: 'ARMBITREVINDEXTABLE_512_TABLE_LENGTH',
+    1024: 'ARMBITREVINDEXTABLE1024_TABLE_LENGTH',
+    2048: 'ARMBITREVINDEXTABLE2048_TABLE_LENGTH',
+    4096: 'ARMBITREVINDEXTABLE4096_TABLE_LENGTH',
+}
+
+# Values of the above, for the flash footprint
+BITREV_COUNT = {16: 20, 32: 48, 64: 56, 128: 208, 256: 440, 512: 448,
+                1024: 1800, 2048: 3808, 4096: 4032}
+
+# RFFT sizes arm_rfft_fast_init_f32() links tables for
+CMSIS_RFFT_SIZES = [32, 64, 128, 256, 512, 1024, 2048, 4096]
+
+# dsp_config.h defines naming RFFT sizes that need a plan
+CONFIG_SIZES = ['DSP_FFT_SIZES', 'DSP_FIR_FFT_SIZE', 'DSP_CQT_FFT_SIZE',
+                'DSP_CQT_REFERENCE_SIZE']
+
+# dsp_config.h defines naming frame sizes whose autocorrelation needs a
+# plan for twice the size (see autocorr.h)
+ACF_SIZES = ['DSP_FFT_SIZES']
+
+# dsp_config.h defines naming RFFT sizes that get a Hann window
+WINDOW_SIZES = ['DSP_FFT_SIZES', 'DSP_CQT_FFT_SIZE', 'DSP_CQT_REFERENCE_SIZE']
+
+# dsp_config.h defines naming RFFT sizes that need band weights
+BAND_SIZES = ['DSP_FFT_SIZES']
+
+# Limits of the mixed-radix plan, mirroring arbfft.h
+ARBFFT_MAX_RADIX = 13
+ARBFFT_MAX_FACTORS = 12
+
+HEADER = """/*
+ * {name}
+ *
+ *  Generated by tools/gen_fft_tables.py for RFFT sizes {sizes}.
+ *  Do not edit; rerun the generator instead.
+ */
+"""
+
+FOOTPRINT = """/*
+ * Flash taken by tables: {fft} bytes of FFT twiddles and CMSIS
+ * bit-reversal tables, where arm_rfft_fast_init_f32() would link {cmsis},
+ * and {extra} bytes of windows, band weights and arbitrary-length plan.
+ */
+"""
+
+
+def config_define(name):
+    """Value of an integer define, following defines that name another."""
+    with open(os.path.join(ROOT, 'dsp_config.h')) as f:
+        match = re.search(r'^#define\s+%s\s+(\w+)' % name, f.read(), re.M)
+    if not match:
+        sys.exit('%s not found in dsp_config.h' % name)
+    value = match.group(1)
+    return int(value) if value.isdigit() else config_define(value)
+
+
+def config_list(name):
+    """Values of a define holding a comma separated list of integers."""
+    with open(os.path.join(ROOT, 'dsp_config.h')) as f:
+        match = re.search(r'^#define\s+%s\s+([\d ,]+)$' % name, f.read(), re.M)
+    if not match:
+        return [config_define(name)]
+    return [int(v) for v in match.group(1).split(',')]
+
+
+def fmt_floats(values, per_line=4):
+    lines = []
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        lines.append('\t' + ', '.join('%.9ef' % v for v in chunk) + ',')
+    return '\n'.join(lines)
+
+
+def emit_table(out, name, values):
+    out.append('#pragma DATA_SECTION(%s, ".const:%s")' % (name, name))
+    out.append('const float32_t %s[%d] =\n{' % (name, len(values)))
+    out.append(fmt_floats(values))
+    out.append('};\n')
+
+
+def cfft_twiddle(n):
+    values = []
+    for i in range(n):
+        values += [math.cos(2 * math.pi * i / n), math.sin(2 * math.pi * i / n)]
+    return values
+
+
+# twiddleCoef_rfft_<n> order: sin before cos, unlike the CFFT tables
+def rfft_twiddle(n):
+    values = []
+    for i in range(n // 2):
+        values += [math.sin(2 * math.pi * i / n), math.cos(2 * math.pi * i / n)]
+    return values
+
+
+def hann(n):
+    return [0.5 - 0.5 * math.cos(2 * math.pi * i / n) for i in range(n)]
+
+
+def factorize(n):
+    """Radices in the order arbfftRun applies them: 4s, then 2, then odd."""
+    factors = []
+    p = 4
+    while n > 1:
+        while n % p:
+            p = 2 if p == 4 else (3 if p == 2 else p + 2)
+        factors.append(p)
+        n //= p
+    return factors
+
+
+def dft(values):
+    """Forward DFT of a list of complex values; only run once per plan."""
+    n = len(values)
+    if n == 1:
+        return list(values)
+    even = dft(values[0::2])
+    odd = dft(values[1::2])
+    out = [0j] * n
+    for k in range(n // 2):
+        t = complex(math.cos(2 * math.pi * k / n),
+                    -math.sin(2 * math.pi * k / n)) * odd[k]
+        out[k] = even[k] + t
+        out[k + n // 2] = even[k] - t
+    return out
+
+
+def interleave(values):
+    out = []
+    for v in values:
+        out += [v.real, v.imag]
+    return out
+
+
+def arb_plan(c, h, n, emitted):
+    """Emits the arbfftPlan for length n; returns the work size in floats."""
+    factors = factorize(n)
+    if max(factors) <= ARBFFT_MAX_RADIX and len(factors) <= ARBFFT_MAX_FACTORS:
+        twiddle = [complex(math.cos(2 * math.pi * k / n),
+                           -math.sin(2 * math.pi * k / n)) for k in range(n)]
+        h.append('extern const float32_t fftArbTwiddle%d[%d];' % (n, 2 * n))
+        emit_table(c, 'fftArbTwiddle%d' % n, interleave(twiddle))
+        c.append('const arbfftPlan fftArbPlan%d =\n{' % n)
+        c.append('\t%d, ARBFFT_MIXED_RADIX,' % n)
+        c.append('\t%d, { %s },' % (len(factors), ', '.join(str(p) for p in factors)))
+        c.append('\tfftArbTwiddle%d, 0, 0, 0\n};\n' % n)
+        return 0
+
+    # Bluestein: the convolution needs a CFFT of at least 2N - 1 points
+    m = 1
+    while m < 2 * n - 1:
+        m *= 2
+    if m not in BITREV_LENGTH:
+        sys.exit('unsupported arbitrary FFT length %d' % n)
+
+    # Reduce n^2 mod 2N before scaling, so the angle stays accurate
+    chirp = [complex(math.cos(math.pi * (k * k % (2 * n)) / n),
+                     -math.sin(math.pi * (k * k % (2 * n)) / n)) for k in range(n)]
+    kernel = [0j] * m
+    for k in range(n):
+        kernel[k] = chirp[k].conjugate()
+        kernel[(m - k) % m] = chirp[k].conjugate()
+
+    h.append('extern const float32_t fftArbChirp%d[%d];' % (n, 2 * n))
+    h.append('extern const float32_t fftArbChirpSpectrum%d[%d];' % (n, 2 * m))
+    emit_table(c, 'fftArbChirp%d' % n, interleave(chirp))
+    emit_table(c, 'fftArbChirpSpectrum%d' % n, interleave(dft(kernel)))
+
+    if 'fftTwiddle%d' % m not in emitted:
+        h.append('extern const float32_t fftTwiddle%d[%d];' % (m, 2 * m))
+        emit_table(c, 'fftTwiddle%d' % m, cfft_twiddle(m))
+        emitted.add('fftTwiddle%d' % m)
+
+    c.append('static const arm_cfft_instance_f32 fftArbCfft%d =' % n)
+    c.append('\t{ %d, fftTwiddle%d, armBitRevIndexTable%d, %s };\n'
+             % (m, m, m, BITREV_LENGTH[m]))
+    c.append('const arbfftPlan fftArbPlan%d =\n{' % n)
+    c.append('\t%d, ARBFFT_BLUESTEIN,' % n)
+    c.append('\t0, { 0 },')
+    c.append('\t0, fftArbChirp%d, fftArbChirpSpectrum%d, &fftArbCfft%d\n};\n'
+             % (n, n, n))
+    return 2 * m
+
+
+def band_weights(n, rate):
+    """Per band (centre Hz, [(bin, weight)]) for the configured scale.
+
+    Bins 1 .. N/2 - 1 are used: DC and Nyquist share the first complex
+    slot of the packed RFFT output. Bands narrower than a bin may catch
+    none and are left out.
+    """
+    scale = config_define('DSP_BANDS_SCALE')
+    nyquist = rate / 2.0
+    freqs = [k * rate / float(n) for k in range(n // 2)]
+    bands = []
+
+    if scale == config_define('DSP_BANDS_MEL'):
+        count = config_define('DSP_BANDS_MEL_COUNT')
+
+        def mel(f):
+            return 2595.0 * math.log10(1.0 + f / 700.0)
+
+        def hz(m):
+            return 700.0 * (10.0 ** (m / 2595.0) - 1.0)
+
+        # Triangles with peak weight 1 between neighbouring mel centres
+        edges = [hz(mel(nyquist) * i / (count + 1)) for i in range(count + 2)]
+        for b in range(count):
+            lo, centre, hi = edges[b:b + 3]
+            row = []
+            for k in range(1, n // 2):
+                f = freqs[k]
+                if lo < f < hi:
+                    w = (f - lo) / (centre - lo) if f <= centre else (hi - f) / (hi - centre)
+                    row.append((k, w))
+            bands.append((centre, row))
+    else:
+        # Base-2 centres around 1 kHz; rectangular bands that tile the axis
+        per_octave = 3 if scale == config_define('DSP_BANDS_THIRD_OCTAVE') else 1
+        half = 2.0 ** (0.5 / per_octave)
+        i = -per_octave * 10
+        while True:
+            centre = 1000.0 * 2.0 ** (float(i) / per_octave)
+            lo, hi = centre / half, centre * half
+            if lo >= nyquist:
+                break
+            row = [(k, 1.0) for k in range(1, n // 2) if lo <= freqs[k] < hi]
+            bands.append((centre, row))
+            i += 1
+
+    return [(centre, row) for centre, row in bands if row]
+
+
+def emit_uint16(out, name, values):
+    out.append('#pragma DATA_SECTION(%s, ".const:%s")' % (name, name))
+    out.append('const uint16_t %s[%d] =\n{' % (name, len(values)))
+    for i in range(0, len(values), 8):
+        out.append('\t' + ', '.join(str(v) for v in values[i:i + 8]) + ',')
+    out.append('};\n')
+
+
+def band_plan(c, h, n, rate):
+    """Emits the bandsWeights for size n at rate; returns the band count."""
+    bands = band_weights(n, rate)
+    rows, columns, weights = [0], [], []
+    for _, row in bands:
+        columns += [k for k, _ in row]
+        weights += [w for _, w in row]
+        rows.append(len(columns))
+
+    tag = '%d_%d' % (n, rate)
+    h.append('extern const bandsWeights fftBands%s;' % tag)
+    emit_uint16(c, 'fftBandRows%s' % tag, rows)
+    emit_uint16(c, 'fftBandColumns%s' % tag, columns)
+    emit_table(c, 'fftBandWeights%s' % tag, weights)
+    emit_uint16(c, 'fftBandCenters%s' % tag, [int(round(f)) for f, _ in bands])
+    c.append('const bandsWeights fftBands%s =\n{' % tag)
+    c.append('\t%d, fftBandRows%s, fftBandColumns%s, fftBandWeights%s,'
+             % (len(bands), tag, tag, tag))
+    c.append('\tfftBandCenters%s\n};\n' % tag)
+    return len(bands)
+
+
+def table_bytes(lines, prefix=''):
+    """Bytes of the float32_t and uint16_t tables emitted into lines
+    whose name starts with prefix."""
+    total = 0
+    for line in lines:
+        match = re.match(r'const (float32_t|uint16_t) %s\w*\[(\d+)\]' % prefix, line)
+        if match:
+            total += int(match.group(2)) * (4 if match.group(1) == 'float32_t' else 2)
+    return total
+
+
+def cmsis_table_bytes():
+    """Bytes of the tables arm_rfft_fast_init_f32() links."""
+    total = 0
+    for n in CMSIS_RFFT_SIZES:
+        total += 4 * 2 * (n // 2) + 4 * n + 2 * BITREV_COUNT[n // 2]
+    return total
+
+
+def generate(sizes, arb_length, band_sizes, rates, window_sizes):
+    label = ', '.join(str(n) for n in sizes)
+    if arb_length:
+        label += ' and arbitrary length %d' % arb_length
+    if band_sizes:
+        label += ',\n *  bands at %s Hz' % ', '.join(str(r) for r in rates)
+    h = [HEADER.format(name='fft_tables.h', sizes=label)]
+    h.append('#ifndef FFT_TABLES_H_\n#define FFT_TABLES_H_\n')
+    h.append('#include <stdint.h>\n\n#include "arm_math.h"\n#include "arbfft.h"\n#include "bands.h"\n')
+
+    c = [HEADER.format(name='fft_tables.c', sizes=label)]
+    c.append('#include <stdint.h>\n')
+    c.append('#include "arm_math.h"\n#include "arm_common_tables.h"\n')
+    c.append('#include "fft_tables.h"\n#include "dsp_config.h"\n')
+
+    emitted = set()
+    for n in sizes:
+        half = n // 2
+        emitted.add('fftTwiddle%d' % half)
+        if half not in BITREV_LENGTH:
+            sys.exit('unsupported RFFT size %d' % n)
+
+        h.append('extern const float32_t fftTwiddle%d[%d];' % (half, 2 * half))
+        h.append('extern const float32_t fftTwiddleRfft%d[%d];' % (n, n))
+        if n in window_sizes:
+            h.append('extern const float32_t fftWindowHann%d[%d];' % (n, n))
+        h.append('extern const arm_rfft_fast_instance_f32 fftPlan%d;\n' % n)
+
+        emit_table(c, 'fftTwiddle%d' % half, cfft_twiddle(half))
+        emit_table(c, 'fftTwiddleRfft%d' % n, rfft_twiddle(n))
+        if n in window_sizes:
+            emit_table(c, 'fftWindowHann%d' % n, hann(n))
+
+        c.append('const arm_rfft_fast_instance_f32 fftPlan%d =\n{' % n)
+        c.append('\t{ %d, fftTwiddle%d, armBitRevIndexTable%d, %s },'
+                 % (half, half, half, BITREV_LENGTH[half]))
+        c.append('\t%d,\n\t(float32_t *)fftTwiddleRfft%d\n};\n' % (n, n))
+
+    cfft_lengths = set(n // 2 for n in sizes)
+    work = 0
+    if arb_length:
+        work = arb_plan(c, h, arb_length, emitted)
+        if work:
+            cfft_lengths.add(work // 2)
+        h.append('extern const arbfftPlan fftArbPlan%d;\n' % arb_length)
+
+    h.append('// Work buffer arbfftRun needs for the arbitrary-length plan')
+    h.append('#define FFT_ARB_WORK_FLOATS %d\n' % work)
+
+    max_bands = 0
+    for n in band_sizes:
+        for rate in rates:
+            max_bands = max(max_bands, band_plan(c, h, n, rate))
+    if band_sizes:
+        h.append('')
+
+    h.append('// Largest band count of the generated band weights')
+    h.append('#define FFT_BANDS_MAX %d\n' % max_bands)
+
+    h.append('const arm_rfft_fast_instance_f32 *fftPlanRfft(uint32_t size);')
+    h.append('const float32_t *fftWindowHann(uint32_t size);')
+    h.append('const arbfftPlan *fftPlanArb(uint32_t size);')
+    h.append('const bandsWeights *fftBands(uint32_t size, uint32_t rate);\n')
+    fft = table_bytes(c, 'fftTwiddle') + sum(2 * BITREV_COUNT[m] for m in cfft_lengths)
+    h.append(FOOTPRINT.format(fft=fft, cmsis=cmsis_table_bytes(),
+                              extra=table_bytes(c) - table_bytes(c, 'fftTwiddle')))
+    h.append('#endif /* FFT_TABLES_H_ */')
+
+    # DSP_RUNTIME_FFT_INIT builds the plans at run time instead, for the
+    # before figures; the tables above are then left unreferenced
+    c.append('#if DSP_RUNTIME_FFT_INIT')
+    c.append('static arm_rfft_fast_instance_f32 fftRuntimePlan[%d];\n' % len(sizes))
+    c.append('// Plan for size from arm_rfft_fast_init_f32(), on first use')
+    c.append('static const arm_rfft_fast_instance_f32 *fftPlanInit(\n'
+             '\t\tarm_rfft_fast_instance_f32 *plan, uint16_t size)\n{')
+    c.append('\tif (plan->fftLenRFFT != size &&\n'
+             '\t\t\tarm_rfft_fast_init_f32(plan, size) != ARM_MATH_SUCCESS)\n'
+             '\t{\n\t\treturn 0;\n\t}\n\treturn plan;\n}')
+    c.append('#endif\n')
+
+    c.append('const arm_rfft_fast_instance_f32 *fftPlanRfft(uint32_t size)\n{')
+    c.append('\tswitch (size)\n\t{')
+    for i, n in enumerate(sizes):
+        c.append('\tcase %d:' % n)
+        c.append('#if DSP_RUNTIME_FFT_INIT')
+        c.append('\t\treturn fftPlanInit(&fftRuntimePlan[%d], %d);' % (i, n))
+        c.append('#else')
+        c.append('\t\treturn &fftPlan%d;' % n)
+        c.append('#endif')
+    c.append('\tdefault:\n\t\treturn 0;\n\t}\n}\n')
+
+    c.append('const float32_t *fftWindowHann(uint32_t size)\n{')
+    c.append('\tswitch (size)\n\t{')
+    for n in window_sizes:
+        c.append('\tcase %d:\n\t\treturn fftWindowHann%d;' % (n, n))
+    c.append('\tdefault:\n\t\treturn 0;\n\t}\n}\n')
+
+    c.append('const arbfftPlan *fftPlanArb(uint32_t size)\n{')
+    c.append('\tswitch (size)\n\t{')
+    if arb_length:
+        c.append('\tcase %d:\n\t\treturn &fftArbPlan%d;' % (arb_length, arb_length))
+    c.append('\tdefault:\n\t\treturn 0;\n\t}\n}\n')
+
+    c.append('const bandsWeights *fftBands(uint32_t size, uint32_t rate)\n{')
+    for n in band_sizes:
+        for rate in rates:
+            c.append('\tif (size == %d && rate == %d)' % (n, rate))
+            c.append('\t{\n\t\treturn &fftBands%d_%d;\n\t}' % (n, rate))
+    c.append('\treturn 0;\n}')
+
+    for name, lines in (('fft_tables.h', h), ('fft_tables.c', c)):
+        with open(os.path.join(ROOT, name), 'w') as f:
+            f.write('\n'.join(lines) + '\n')
+
+
+def main():
+    if len(sys.argv) > 1:
+        sizes = sorted(set(int(arg) for arg in sys.argv[1:]))
+        window_sizes = sizes
+    else:
+        sizes = set(n for name in CONFIG_SIZES for n in config_list(name) if n)
+        sizes |= set(2 * n for name in ACF_SIZES for n in config_list(name))
+        sizes = sorted(sizes)
+        window_sizes = sorted(set(n for name in WINDOW_SIZES
+                                  for n in config_list(name) if n))
+    band_sizes = sorted(set(n for name in BAND_SIZES for n in config_list(name)))
+    generate(sizes, config_define('DSP_ARBFFT_LENGTH'), band_sizes,
+             config_list('DSP_SAMPLE_RATES'), window_sizes)
+
+
+if __name__ == '__main__':
+    main()